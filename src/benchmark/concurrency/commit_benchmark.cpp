@@ -0,0 +1,80 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+/**
+ * Measures the commits per second of small transactions that are committed concurrently. The transactions of
+ * BM_Commit and BM_CommitBatch do not modify any data, so that only the assignment and publication of commit ids is
+ * measured.
+ */
+static void BM_Commit(benchmark::State& state) {
+  auto& transaction_manager = TransactionManager::get();
+
+  while (state.KeepRunning()) {
+    auto transaction_context = transaction_manager.new_transaction_context();
+    transaction_context->commit();
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Commit)->ThreadRange(1, 64)->UseRealTime();
+
+// Commits the transactions in batches of state.range(0) transactions
+static void BM_CommitBatch(benchmark::State& state) {
+  auto& transaction_manager = TransactionManager::get();
+  const auto batch_size = static_cast<size_t>(state.range(0));
+
+  auto transaction_contexts = std::vector<std::shared_ptr<TransactionContext>>(batch_size);
+  while (state.KeepRunning()) {
+    for (auto& transaction_context : transaction_contexts) {
+      transaction_context = transaction_manager.new_transaction_context();
+    }
+    transaction_manager.commit_batch(transaction_contexts);
+  }
+
+  state.SetItemsProcessed(state.iterations() * batch_size);
+}
+BENCHMARK(BM_CommitBatch)->Arg(16)->ThreadRange(1, 64)->UseRealTime();
+
+// Each transaction inserts a single row, so that committing also sets the commit ids of its records
+static void BM_CommitInsert(benchmark::State& state) {
+  auto& transaction_manager = TransactionManager::get();
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int}};
+
+  // The table is shared by all threads and runs
+  static const auto table_name = [&]() {
+    const auto name = std::string{"commit_benchmark"};
+    const auto table = std::make_shared<Table>(column_definitions, TableType::Data, 100'000, UseMvcc::Yes);
+    StorageManager::get().add_table(name, table);
+    return name;
+  }();
+
+  auto values = std::make_shared<Table>(column_definitions, TableType::Data);
+  values->append({AllTypeVariant{1}});
+  const auto table_wrapper = std::make_shared<TableWrapper>(values);
+  table_wrapper->execute();
+
+  while (state.KeepRunning()) {
+    auto transaction_context = transaction_manager.new_transaction_context();
+    const auto insert = std::make_shared<Insert>(table_name, table_wrapper);
+    insert->set_transaction_context(transaction_context);
+    insert->execute();
+    transaction_context->commit();
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_CommitInsert)->ThreadRange(1, 64)->UseRealTime();
+
+}  // namespace opossum
@@ -1,33 +1,146 @@
+#include <pthread.h>
+#include <sched.h>
+
 #include <boost/asio/io_service.hpp>
+#include <boost/program_options.hpp>
 
-#include <cstdlib>
+#include <chrono>
+#include <cstdint>
 #include <iostream>
+#include <optional>
+#include <stdexcept>
+#include <string>
 
+#include "concurrency/garbage_collector.hpp"
+#include "logging/checkpoint.hpp"
+#include "logging/log_recovery.hpp"
+#include "logging/logger.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/node_queue_scheduler.hpp"
 #include "scheduler/topology.hpp"
 #include "server/server.hpp"
+#include "storage/delta_merger.hpp"
 #include "storage/storage_manager.hpp"
 #include "utils/load_table.hpp"
 
+namespace {
+
+struct ServerOptions {
+  uint16_t port;
+  std::optional<std::chrono::microseconds> statement_timeout;
+  std::string checkpoint_directory;
+  std::string log_file;
+  std::optional<std::chrono::milliseconds> delta_merge_interval;
+};
+
+// Throws if the arguments are invalid, instead of silently falling back to zero
+ServerOptions parse_options(int argc, char* argv[]) {
+  namespace po = boost::program_options;
+
+  // Unsigned values would accept negative numbers by wrapping them around
+  auto port = int32_t{5432};
+  auto statement_timeout_ms = int64_t{0};
+  auto checkpoint_directory = std::string{};
+  auto log_file = std::string{};
+  auto delta_merge_interval_ms = int64_t{opossum::DeltaMergerOptions{}.interval.count()};
+
+  auto description = po::options_description{"Usage: hyriseServer [port [statement_timeout_ms]] [options]"};
+  auto add_option = description.add_options();
+  add_option("port", po::value(&port)->default_value(port), "TCP port (1-65535)");
+  add_option("statement_timeout", po::value(&statement_timeout_ms),
+             "Cancel statements after this many milliseconds, disabled if not given");
+  add_option("checkpoint_directory", po::value(&checkpoint_directory),
+             "Load the tables from the last checkpoint in this directory");
+  add_option("log_file", po::value(&log_file), "Replay this redo log on startup and log all commits to it");
+  add_option("delta_merge_interval", po::value(&delta_merge_interval_ms)->default_value(delta_merge_interval_ms),
+             "Merge completed delta chunks into main chunks every this many milliseconds, disabled if 0");
+
+  auto positional_description = po::positional_options_description{};
+  positional_description.add("port", 1).add("statement_timeout", 1);
+
+  auto variables = po::variables_map{};
+  po::store(po::command_line_parser(argc, argv).options(description).positional(positional_description).run(),
+            variables);
+  po::notify(variables);
+
+  if (port < 1 || port > 65535) {
+    throw std::invalid_argument("Invalid port " + std::to_string(port));
+  }
+
+  auto options =
+      ServerOptions{static_cast<uint16_t>(port), std::nullopt, checkpoint_directory, log_file, std::nullopt};
+  if (variables.count("statement_timeout")) {
+    if (statement_timeout_ms <= 0) {
+      throw std::invalid_argument("Invalid statement timeout " + std::to_string(statement_timeout_ms));
+    }
+    options.statement_timeout = std::chrono::milliseconds{statement_timeout_ms};
+  }
+
+  if (delta_merge_interval_ms < 0) {
+    throw std::invalid_argument("Invalid delta merge interval " + std::to_string(delta_merge_interval_ms));
+  }
+  if (delta_merge_interval_ms > 0) options.delta_merge_interval = std::chrono::milliseconds{delta_merge_interval_ms};
+
+  return options;
+}
+
+}  // namespace
+
 int main(int argc, char* argv[]) {
+  auto options = ServerOptions{};
   try {
-    uint16_t port = 5432;
+    options = parse_options(argc, argv);
+  } catch (const std::exception& exception) {
+    std::cerr << "Invalid arguments: " << exception.what() << "\n";
+    return 1;
+  }
 
-    if (argc >= 2) {
-      port = static_cast<uint16_t>(std::atoi(argv[1]));
+  try {
+    // Set scheduler so that the server can execute the tasks on separate threads. One core is left to this thread,
+    // which handles the network IO.
+    auto topology_options = opossum::TopologyOptions{};
+    topology_options.num_reserved_cores = 1;
+    const auto topology = opossum::Topology::create_topology(topology_options);
+    opossum::CurrentScheduler::set(std::make_shared<opossum::NodeQueueScheduler>(topology));
+
+#if HYRISE_NUMA_SUPPORT
+    if (!topology->reserved_cpus().empty()) {
+      cpu_set_t cpuset;
+      CPU_ZERO(&cpuset);
+      for (const auto cpu_id : topology->reserved_cpus()) {
+        CPU_SET(cpu_id, &cpuset);
+      }
+      pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuset);
+    }
+#endif
+
+    // The checkpoint has to be loaded before the log is replayed, and no transaction may run before both are done
+    if (!options.checkpoint_directory.empty()) {
+      const auto checkpoint_commit_id = opossum::load_checkpoint(options.checkpoint_directory);
+      if (checkpoint_commit_id) std::cout << "Loaded checkpoint at commit id " << *checkpoint_commit_id << std::endl;
     }
+    if (!options.log_file.empty()) {
+      const auto num_transactions = opossum::recover_from_log(options.log_file);
+      std::cout << "Replayed " << num_transactions << " transactions from " << options.log_file << std::endl;
+      opossum::Logger::get().enable(options.log_file);
+    }
+
+    // Reclaims the space of deleted and updated rows while the server runs
+    opossum::GarbageCollector::get().start();
 
-    // Set scheduler so that the server can execute the tasks on separate threads.
-    opossum::CurrentScheduler::set(
-        std::make_shared<opossum::NodeQueueScheduler>(opossum::Topology::create_numa_topology()));
+    // Turns the chunks filled by inserts into encoded chunks with indexes and filters while the server runs
+    if (options.delta_merge_interval) {
+      auto delta_merger_options = opossum::DeltaMergerOptions{};
+      delta_merger_options.interval = *options.delta_merge_interval;
+      opossum::DeltaMerger::get().start(delta_merger_options);
+    }
 
     boost::asio::io_service io_service;
 
     // The server registers itself to the boost io_service. The io_service is the main IO control unit here and it lives
     // until the server doesn't request any IO any more, i.e. is has terminated. The server requests IO in its
     // constructor and then runs forever.
-    opossum::Server server{io_service, port};
+    opossum::Server server{io_service, options.port, options.statement_timeout};
 
     io_service.run();
   } catch (std::exception& e) {
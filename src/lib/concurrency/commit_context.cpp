@@ -23,19 +23,4 @@ void CommitContext::fire_callback() {
   if (_callback) _callback();
 }
 
-bool CommitContext::has_next() const { return next() != nullptr; }
-
-std::shared_ptr<CommitContext> CommitContext::next() { return std::atomic_load(&_next); }
-
-std::shared_ptr<const CommitContext> CommitContext::next() const { return std::atomic_load(&_next); }
-
-bool CommitContext::try_set_next(const std::shared_ptr<CommitContext>& next) {
-  DebugAssert((next->commit_id() == commit_id() + 1u), "Next commit context's commit id needs to be incremented by 1.");
-
-  if (has_next()) return false;
-
-  auto context_nullptr = std::shared_ptr<CommitContext>();
-  return std::atomic_compare_exchange_strong(&_next, &context_nullptr, next);
-}
-
 }  // namespace opossum
@@ -13,6 +13,10 @@ namespace opossum {
  * Its main purpose is to manage commit ids.
  * It is effectively part of the TransactionContext
  *
+ * Commit ids are handed out by the TransactionManager. Once the transaction has committed its records, the commit
+ * context is marked as pending and waits in the TransactionManager until all commits with smaller commit ids have been
+ * committed as well.
+ *
  * Should not be used outside the concurrency module!
  */
 class CommitContext : private Noncopyable {
@@ -36,22 +40,9 @@ class CommitContext : private Noncopyable {
    */
   void fire_callback();
 
-  bool has_next() const;
-
-  std::shared_ptr<CommitContext> next();
-  std::shared_ptr<const CommitContext> next() const;
-
-  /**
-   * Tries to set the next context. Returns false if it has already
-   * been set. Throws error if its commit id isn't equal to this context's
-   * commit id + 1.
-   */
-  bool try_set_next(const std::shared_ptr<CommitContext>& next);
-
  private:
   const CommitID _commit_id;
   std::atomic<bool> _pending;  // true if context is waiting to be committed
-  std::shared_ptr<CommitContext> _next;
   std::function<void()> _callback;
 };
 }  // namespace opossum
@@ -0,0 +1,154 @@
+#include "garbage_collector.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "operators/compact_chunks.hpp"
+#include "resolve_type.hpp"
+#include "storage/chunk.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "storage/value_column.hpp"
+#include "transaction_context.hpp"
+#include "transaction_manager.hpp"
+#include "utils/assert.hpp"
+#include "utils/pausable_loop_thread.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+std::shared_ptr<Chunk> create_empty_chunk(const Table& table) {
+  auto columns = ChunkColumns{};
+  for (const auto& column_definition : table.column_definitions()) {
+    resolve_data_type(column_definition.data_type, [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      columns.push_back(std::make_shared<ValueColumn<ColumnDataType>>(column_definition.nullable));
+    });
+  }
+
+  return std::make_shared<Chunk>(columns, std::make_shared<MvccColumns>(0u));
+}
+
+// Moves the remaining rows of the chunks into a new chunk. Returns false if a concurrent transaction modified them.
+bool compact_chunks(const std::string& table_name, const std::vector<ChunkID>& chunk_ids) {
+  const auto transaction_context = TransactionManager::get().new_transaction_context();
+
+  const auto compact_chunks = std::make_shared<CompactChunks>(table_name, chunk_ids);
+  compact_chunks->set_transaction_context(transaction_context);
+  compact_chunks->execute();
+
+  if (compact_chunks->execute_failed()) {
+    transaction_context->rollback();
+    return false;
+  }
+
+  transaction_context->commit();
+  return true;
+}
+
+}  // namespace
+
+namespace opossum {
+
+GarbageCollector& GarbageCollector::get() {
+  static GarbageCollector instance;
+  return instance;
+}
+
+void GarbageCollector::reset() { get().stop(); }
+
+GarbageCollector::~GarbageCollector() { stop(); }
+
+void GarbageCollector::start(const GarbageCollectorOptions& options) {
+  Assert(!is_running(), "GarbageCollector is already running");
+  Assert(options.min_invalidated_ratio > 0.0 && options.min_invalidated_ratio <= 1.0,
+         "min_invalidated_ratio must be in (0, 1]");
+
+  _options = options;
+  _loop_thread = std::make_unique<PausableLoopThread>(_options.interval, [this](size_t) { collect(); });
+}
+
+void GarbageCollector::stop() {
+  // The destructor waits for the current pass
+  _loop_thread.reset();
+  _options = GarbageCollectorOptions{};
+}
+
+bool GarbageCollector::is_running() const { return _loop_thread != nullptr; }
+
+size_t GarbageCollector::collect() {
+  std::lock_guard<std::mutex> lock(_collect_mutex);
+
+  auto num_collected_chunks = size_t{0};
+  for (const auto& table_name : StorageManager::get().table_names()) {
+    num_collected_chunks += _collect_table(table_name);
+  }
+  return num_collected_chunks;
+}
+
+size_t GarbageCollector::_collect_table(const std::string& table_name) {
+  const auto table = StorageManager::get().get_table(table_name);
+  if (table->has_mvcc() == UseMvcc::No) return 0;
+
+  // Rows that were invalidated at or before this commit id are invisible to all current and future transactions
+  const auto oldest_snapshot_commit_id = TransactionManager::get().oldest_active_snapshot_commit_id();
+
+  auto num_collected_chunks = size_t{0};
+
+  // Chunks are merged as long as their valid rows fit into one chunk
+  auto chunk_groups = std::vector<std::vector<ChunkID>>{};
+  auto valid_row_count_of_last_group = size_t{0};
+
+  // The last chunk might still receive inserts
+  const auto chunk_count = table->chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id + 1u < chunk_count; ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+    const auto chunk_size = chunk->size();
+    if (chunk_size == 0) continue;
+
+    auto invisible_row_count = size_t{0};
+    auto valid_row_count = size_t{0};
+    auto has_uncommitted_inserts = false;
+    {
+      const auto mvcc_columns = chunk->mvcc_columns();
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+        if (mvcc_columns->begin_cids[chunk_offset] == MvccColumns::MAX_COMMIT_ID) {
+          has_uncommitted_inserts = true;
+          break;
+        }
+        const auto end_cid = mvcc_columns->end_cids[chunk_offset];
+        if (end_cid <= oldest_snapshot_commit_id) ++invisible_row_count;
+        if (end_cid == MvccColumns::MAX_COMMIT_ID) ++valid_row_count;
+      }
+    }
+    if (has_uncommitted_inserts) continue;
+
+    if (invisible_row_count == chunk_size) {
+      table->replace_chunk(chunk_id, create_empty_chunk(*table));
+      ++num_collected_chunks;
+      continue;
+    }
+
+    // Chunks without valid rows, e.g., chunks that have been compacted already, only have to be freed later
+    if (valid_row_count == 0 || invisible_row_count < _options.min_invalidated_ratio * chunk_size) continue;
+
+    // Only valid rows are moved
+    if (chunk_groups.empty() || valid_row_count_of_last_group + valid_row_count > table->max_chunk_size()) {
+      chunk_groups.emplace_back();
+      valid_row_count_of_last_group = 0;
+    }
+    chunk_groups.back().emplace_back(chunk_id);
+    valid_row_count_of_last_group += valid_row_count;
+  }
+
+  // Chunks whose rows have been modified concurrently are tried again in the next pass
+  for (const auto& chunk_ids : chunk_groups) {
+    if (compact_chunks(table_name, chunk_ids)) num_collected_chunks += chunk_ids.size();
+  }
+
+  return num_collected_chunks;
+}
+
+}  // namespace opossum
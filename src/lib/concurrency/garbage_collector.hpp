@@ -0,0 +1,76 @@
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "types.hpp"
+
+namespace opossum {
+
+struct PausableLoopThread;
+
+struct GarbageCollectorOptions {
+  // How long the background thread sleeps between two passes
+  std::chrono::milliseconds interval{1'000};
+
+  // A chunk is compacted once this share of its rows is invisible to all transactions
+  double min_invalidated_ratio{0.5};
+};
+
+/**
+ * Delete and Update only invalidate rows by setting their end commit id, so invalidated rows would stay in their
+ * chunks forever and would have to be filtered by every Validate. The GarbageCollector removes rows that are invisible
+ * to all current and future transactions, i.e., rows whose end commit id is not greater than
+ * TransactionManager::oldest_active_snapshot_commit_id():
+ *
+ *  1. The remaining rows of chunks in which at least min_invalidated_ratio of the rows are invisible are moved into a
+ *     new, encoded chunk in a transaction of its own (see CompactChunks). As long as the remaining rows fit into one
+ *     chunk, several chunks of a table are merged.
+ *  2. Chunks in which all rows are invisible, e.g., compacted chunks once all transactions that started before their
+ *     compaction have finished, are replaced by an empty chunk, which frees their memory.
+ *
+ * Concurrent transactions might hold RowIDs into any chunk, which is why compaction moves rows instead of rewriting
+ * chunks in place and why freed chunks are kept as empty chunks. As a consequence, intermediate results must not be
+ * used anymore once their TransactionContext has been destroyed.
+ *
+ * The mutable last chunk of a table and chunks that still contain uncommitted inserts are never touched.
+ */
+class GarbageCollector : private Noncopyable {
+ public:
+  static GarbageCollector& get();
+
+  // Stops the background thread, used for tests
+  static void reset();
+
+  ~GarbageCollector();
+
+  // Starts running collect() in the background
+  void start(const GarbageCollectorOptions& options = {});
+
+  // Waits for the current pass to finish and stops the background thread
+  void stop();
+
+  bool is_running() const;
+
+  /**
+   * Runs a single pass over all tables of the StorageManager.
+   *
+   * @return the number of chunks that have been compacted or freed
+   */
+  size_t collect();
+
+ private:
+  GarbageCollector() = default;
+
+  size_t _collect_table(const std::string& table_name);
+
+  GarbageCollectorOptions _options;
+  std::unique_ptr<PausableLoopThread> _loop_thread;
+
+  // Passes of the background thread and direct calls to collect() do not run concurrently
+  std::mutex _collect_mutex;
+};
+
+}  // namespace opossum
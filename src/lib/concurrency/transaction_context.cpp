@@ -4,6 +4,8 @@
 #include <memory>
 
 #include "commit_context.hpp"
+#include "logging/log_entry.hpp"
+#include "logging/logger.hpp"
 #include "operators/abstract_read_write_operator.hpp"
 #include "transaction_manager.hpp"
 #include "utils/assert.hpp"
@@ -38,6 +40,8 @@ TransactionContext::~TransactionContext() {
                 return !has_registered_operators || committed_or_rolled_back;
               }()),
               "Has registered operators but has neither been committed nor rolled back.");
+
+  if (_is_registered) TransactionManager::get()._deregister_transaction(_snapshot_commit_id, _snapshot_shard);
 }
 
 TransactionID TransactionContext::transaction_id() const { return _transaction_id; }
@@ -49,6 +53,8 @@ CommitID TransactionContext::commit_id() const {
   return _commit_context->commit_id();
 }
 
+bool TransactionContext::is_read_only() const { return _transaction_id == READ_ONLY_TRANSACTION_ID; }
+
 TransactionPhase TransactionContext::phase() const { return _phase; }
 
 bool TransactionContext::aborted() const {
@@ -75,11 +81,16 @@ bool TransactionContext::commit_async(std::function<void(TransactionID)> callbac
 
   if (!success) return false;
 
-  for (const auto& op : _rw_operators) {
-    op->commit_records(commit_id());
+  // A read-only transaction has nothing to make visible, so it does not need a commit id
+  if (is_read_only()) {
+    _phase = TransactionPhase::Committed;
+    if (callback) callback(_transaction_id);
+    return true;
   }
 
-  _mark_as_pending_and_try_commit(callback);
+  _commit_context = TransactionManager::get()._new_commit_context();
+
+  if (_commit_records(callback)) _mark_as_pending_and_try_commit(callback);
 
   return true;
 }
@@ -93,6 +104,7 @@ bool TransactionContext::commit() {
   if (!success) return false;
 
   committed_future.wait();
+  if (_commit_error) std::rethrow_exception(_commit_error);
   return true;
 }
 
@@ -138,11 +150,67 @@ bool TransactionContext::_prepare_commit() {
 
   _wait_for_active_operators_to_finish();
 
-  _commit_context = TransactionManager::get()._new_commit_context();
   return true;
 }
 
+bool TransactionContext::_commit_records(std::function<void(TransactionID)> callback) {
+  auto& logger = Logger::get();
+  if (logger.is_enabled()) {
+    auto log_entry = LogEntry{_transaction_id, commit_id()};
+    for (const auto& op : _rw_operators) {
+      op->log_records(log_entry);
+    }
+
+    if (!log_entry.records.empty()) {
+      // The records are only committed once they are durable, so that no transaction can read data that might get
+      // lost and so that they can still be rolled back if the log cannot be written
+      auto context = shared_from_this();
+      logger.log_commit(log_entry, [context, callback](const std::exception_ptr& error) {
+        if (error) {
+          context->_fail_commit(error, callback);
+          return;
+        }
+
+        for (const auto& op : context->_rw_operators) {
+          op->commit_records(context->commit_id());
+        }
+        context->_mark_as_pending_and_try_commit(callback);
+      });
+
+      return false;
+    }
+  }
+
+  for (const auto& op : _rw_operators) {
+    op->commit_records(commit_id());
+  }
+
+  return true;
+}
+
+void TransactionContext::_fail_commit(const std::exception_ptr& error, std::function<void(TransactionID)> callback) {
+  for (const auto& op : _rw_operators) {
+    op->rollback_records();
+  }
+
+  _commit_error = error;
+  _mark_as_rolled_back();
+
+  // The commit id has been assigned already. It is published without any records, so that later transactions can
+  // commit.
+  _commit_context->make_pending(_transaction_id, [callback](auto transaction_id) {
+    if (callback) callback(transaction_id);
+  });
+  TransactionManager::get()._try_increment_last_commit_id({_commit_context});
+}
+
 void TransactionContext::_mark_as_pending_and_try_commit(std::function<void(TransactionID)> callback) {
+  _mark_as_pending(callback);
+
+  TransactionManager::get()._try_increment_last_commit_id({_commit_context});
+}
+
+void TransactionContext::_mark_as_pending(std::function<void(TransactionID)> callback) {
   DebugAssert(([this]() {
                 for (const auto& op : _rw_operators) {
                   if (op->state() != ReadWriteOperatorState::Committed) return false;
@@ -160,8 +228,11 @@ void TransactionContext::_mark_as_pending_and_try_commit(std::function<void(Tran
 
     if (callback) callback(transaction_id);
   });
+}
 
-  TransactionManager::get()._try_increment_last_commit_id(_commit_context);
+void TransactionContext::register_read_write_operator(std::shared_ptr<AbstractReadWriteOperator> op) {
+  Assert(!is_read_only(), "Cannot execute " + op->name() + " in a read-only transaction");
+  _rw_operators.push_back(op);
 }
 
 void TransactionContext::on_operator_started() { ++_num_active_operators; }
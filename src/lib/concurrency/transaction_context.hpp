@@ -2,6 +2,9 @@
 
 #include <atomic>
 #include <condition_variable>
+#include <exception>
+#include <functional>
+#include <limits>
 #include <memory>
 #include <vector>
 
@@ -51,6 +54,12 @@ class TransactionContext : public std::enable_shared_from_this<TransactionContex
   friend class TransactionManager;
 
  public:
+  /**
+   * Transaction id of read-only transactions (see TransactionManager::new_read_only_transaction_context()). It is
+   * never handed out to other transactions, so no row is locked by it.
+   */
+  static constexpr auto READ_ONLY_TRANSACTION_ID = std::numeric_limits<TransactionID>::max();
+
   TransactionContext(const TransactionID transaction_id, const CommitID snapshot_commit_id);
   ~TransactionContext();
 
@@ -72,6 +81,11 @@ class TransactionContext : public std::enable_shared_from_this<TransactionContex
    */
   CommitID commit_id() const;
 
+  /**
+   * True if the transaction can only read. Validate does not have to check for rows locked by it.
+   */
+  bool is_read_only() const;
+
   /**
    * Returns the current phase of the transaction
    */
@@ -90,9 +104,10 @@ class TransactionContext : public std::enable_shared_from_this<TransactionContex
   bool rollback();
 
   /**
-   * Commits the transaction.
+   * Commits the transaction. If the Logger is enabled, the transaction is only committed once its modifications have
+   * been written to the log. If they cannot be written, the transaction is rolled back instead (see aborted()).
    *
-   * @param callback called when transaction is actually committed
+   * @param callback called when transaction is actually committed or has been rolled back because of the log
    * @return false if called a second time
    */
   bool commit_async(std::function<void(TransactionID)> callback);
@@ -100,7 +115,8 @@ class TransactionContext : public std::enable_shared_from_this<TransactionContex
   /**
    * Commits the transaction.
    *
-   * Blocks until transaction is actually committed.
+   * Blocks until transaction is actually committed. Throws if its modifications could not be logged, the transaction
+   * is rolled back in that case.
    *
    * @return false if called a second time
    */
@@ -109,8 +125,9 @@ class TransactionContext : public std::enable_shared_from_this<TransactionContex
   /**
    * Add an operator to the list of read-write operators.
    * Update must not call this because it consists of a Delete and an Insert, which call this themselves.
+   * Fails for read-only transactions.
    */
-  void register_read_write_operator(std::shared_ptr<AbstractReadWriteOperator> op) { _rw_operators.push_back(op); }
+  void register_read_write_operator(std::shared_ptr<AbstractReadWriteOperator> op);
 
   /**
    * @defgroup Update the counter of active operators
@@ -141,15 +158,28 @@ class TransactionContext : public std::enable_shared_from_this<TransactionContex
 
   /**
    * Sets transaction phase to Committing.
-   * Creates a new commit context and assigns a new commit id.
    * All operators within this context must be finished and
    * none of the registered operators should have failed when
-   * calling this function.
+   * calling this function. Afterwards, the TransactionManager
+   * assigns a commit context.
    *
    * @return false if called a second time.
    */
   bool _prepare_commit();
 
+  /**
+   * Commits the records of all operators with the assigned commit id. If the Logger is enabled, the records are
+   * logged first and are only committed, and the transaction marked as pending, once they are durable.
+   *
+   * @return true if the transaction can be marked as pending right away
+   */
+  bool _commit_records(std::function<void(TransactionID)> callback);
+
+  /**
+   * Rolls back the records if they could not be logged and publishes the commit id without them.
+   */
+  void _fail_commit(const std::exception_ptr& error, std::function<void(TransactionID)> callback);
+
   /**
    * Sets transaction phase to Pending.
    * Tries to commit transaction and all following
@@ -161,6 +191,9 @@ class TransactionContext : public std::enable_shared_from_this<TransactionContex
    */
   void _mark_as_pending_and_try_commit(std::function<void(TransactionID)> callback);
 
+  // Marks the commit context as pending without trying to commit, see TransactionManager::commit_batch()
+  void _mark_as_pending(std::function<void(TransactionID)> callback);
+
   /**@}*/
 
   void _wait_for_active_operators_to_finish() const;
@@ -179,8 +212,16 @@ class TransactionContext : public std::enable_shared_from_this<TransactionContex
   std::atomic<TransactionPhase> _phase;
   std::shared_ptr<CommitContext> _commit_context;
 
+  // Set if the modifications could not be logged, rethrown by commit()
+  std::exception_ptr _commit_error;
+
   std::atomic_size_t _num_active_operators;
 
+  // True if the context was created by the TransactionManager, which keeps track of its snapshot commit id in the
+  // given shard
+  bool _is_registered{false};
+  size_t _snapshot_shard{0};
+
   mutable std::condition_variable _active_operators_cv;
   mutable std::mutex _active_operators_mutex;
 };
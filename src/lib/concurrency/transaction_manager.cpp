@@ -1,6 +1,11 @@
 #include "transaction_manager.hpp"
 
+#include <algorithm>
+#include <functional>
+#include <future>
 #include <memory>
+#include <thread>
+#include <vector>
 
 #include "commit_context.hpp"
 #include "transaction_context.hpp"
@@ -17,73 +22,192 @@ void TransactionManager::reset() {
   auto& manager = get();
   manager._next_transaction_id = INITIAL_TRANSACTION_ID;
   manager._last_commit_id = INITIAL_COMMIT_ID;
-  manager._last_commit_context = std::make_shared<CommitContext>(INITIAL_COMMIT_ID);
+  manager._next_commit_id = INITIAL_COMMIT_ID + 1;
+  for (auto& slot : manager._pending_commit_slots) {
+    slot.context = nullptr;
+    slot.commit_id = 0;
+  }
+
+  for (auto& shard : manager._active_snapshot_shards) {
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    shard.snapshot_commit_ids.clear();
+  }
 }
 
 TransactionManager::TransactionManager()
     : _next_transaction_id{INITIAL_TRANSACTION_ID},
       _last_commit_id{INITIAL_COMMIT_ID},
-      _last_commit_context{std::make_shared<CommitContext>(INITIAL_COMMIT_ID)} {}
+      _next_commit_id{INITIAL_COMMIT_ID + 1} {}
 
 CommitID TransactionManager::last_commit_id() const { return _last_commit_id; }
 
+void TransactionManager::set_last_commit_id(CommitID last_commit_id) {
+  Assert(_next_commit_id == _last_commit_id + 1, "Cannot set last commit id while transactions commit");
+
+  _last_commit_id = last_commit_id;
+  _next_commit_id = last_commit_id + 1;
+}
+
+CommitID TransactionManager::oldest_active_snapshot_commit_id() const {
+  auto locks = std::vector<std::unique_lock<std::mutex>>{};
+  locks.reserve(ACTIVE_SNAPSHOT_SHARD_COUNT);
+  for (auto& shard : _active_snapshot_shards) {
+    locks.emplace_back(shard.mutex);
+  }
+
+  auto oldest_snapshot_commit_id = _last_commit_id.load();
+  for (const auto& shard : _active_snapshot_shards) {
+    if (shard.snapshot_commit_ids.empty()) continue;
+    oldest_snapshot_commit_id = std::min(oldest_snapshot_commit_id, *shard.snapshot_commit_ids.begin());
+  }
+  return oldest_snapshot_commit_id;
+}
+
 std::shared_ptr<TransactionContext> TransactionManager::new_transaction_context() {
-  return std::make_shared<TransactionContext>(_next_transaction_id++, _last_commit_id);
+  return _new_registered_transaction_context(_next_transaction_id++);
 }
 
-/**
- * Logic of the lock-free algorithm
- *
- * Let’s say n threads call this method simultaneously. They all enter the main while-loop.
- * Eventually they reach the point where they try to set the successor of _last_commit_context
- * (pointed to by current_context). Only one of them will succeed and will be able to pass the
- * following if statement. The rest continues with the loop and will now try to get the latest
- * context, which does not have a successor. As long as the thread that succeeded setting
- * the next commit context has not finished updating _last_commit_context, they are stuck in
- * the small while-loop. As soon as it is done, _last_commit_context will point to a commit
- * context with no successor and they will be able to leave this loop.
- */
-std::shared_ptr<CommitContext> TransactionManager::_new_commit_context() {
-  auto current_context = std::atomic_load(&_last_commit_context);
-  auto next_context = std::shared_ptr<CommitContext>();
+std::shared_ptr<TransactionContext> TransactionManager::new_read_only_transaction_context() {
+  return _new_registered_transaction_context(TransactionContext::READ_ONLY_TRANSACTION_ID);
+}
+
+std::shared_ptr<TransactionContext> TransactionManager::_new_registered_transaction_context(
+    TransactionID transaction_id) {
+  const auto snapshot_shard = std::hash<std::thread::id>{}(std::this_thread::get_id()) % ACTIVE_SNAPSHOT_SHARD_COUNT;
+  auto& shard = _active_snapshot_shards[snapshot_shard];
+
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  const auto snapshot_commit_id = _last_commit_id.load();
+  shard.snapshot_commit_ids.insert(snapshot_commit_id);
 
-  auto success = false;
-  while (!success) {
-    while (current_context->has_next()) {
-      current_context = std::atomic_load(&_last_commit_context);
+  auto context = std::make_shared<TransactionContext>(transaction_id, snapshot_commit_id);
+  context->_snapshot_shard = snapshot_shard;
+  context->_is_registered = true;
+  return context;
+}
+
+void TransactionManager::_deregister_transaction(CommitID snapshot_commit_id, size_t snapshot_shard) {
+  auto& shard = _active_snapshot_shards[snapshot_shard];
+  std::lock_guard<std::mutex> lock(shard.mutex);
+
+  // The snapshot might be gone already if the TransactionManager has been reset in the meantime
+  const auto iter = shard.snapshot_commit_ids.find(snapshot_commit_id);
+  if (iter != shard.snapshot_commit_ids.end()) shard.snapshot_commit_ids.erase(iter);
+}
+
+void TransactionManager::commit_batch(const std::vector<std::shared_ptr<TransactionContext>>& transaction_contexts) {
+  auto committing_contexts = std::vector<std::shared_ptr<TransactionContext>>{};
+  for (const auto& transaction_context : transaction_contexts) {
+    // Read-only transactions do not need a commit id and commit right away
+    if (transaction_context->is_read_only()) {
+      transaction_context->commit();
+      continue;
     }
 
-    next_context = std::make_shared<CommitContext>(current_context->commit_id() + 1u);
+    if (transaction_context->_prepare_commit()) committing_contexts.emplace_back(transaction_context);
+  }
 
-    success = current_context->try_set_next(next_context);
+  if (committing_contexts.empty()) return;
 
-    if (!success) continue;
+  auto committed = std::promise<void>{};
+  const auto committed_future = committed.get_future();
+  auto remaining_count = std::atomic<size_t>{committing_contexts.size()};
+  const auto callback = [&committed, &remaining_count](TransactionID) {
+    if (--remaining_count == 0) committed.set_value();
+  };
 
-    /**
-     * Only one thread at a time can ever reach this code since only one thread
-     * succeeds to set _last_commit_context’s successor.
-     */
-    success = std::atomic_compare_exchange_strong(&_last_commit_context, &current_context, next_context);
+  const auto commit_contexts = _new_commit_contexts(committing_contexts.size());
 
-    Assert(success, "Invariant violated.");
+  // Transactions that wait for the log become pending on their own
+  auto pending_contexts = std::vector<std::shared_ptr<CommitContext>>{};
+  pending_contexts.reserve(commit_contexts.size());
+  for (auto index = size_t{0}; index < committing_contexts.size(); ++index) {
+    const auto& transaction_context = committing_contexts[index];
+    transaction_context->_commit_context = commit_contexts[index];
+
+    if (transaction_context->_commit_records(callback)) {
+      transaction_context->_mark_as_pending(callback);
+      pending_contexts.emplace_back(commit_contexts[index]);
+    }
   }
 
-  return next_context;
+  if (!pending_contexts.empty()) _try_increment_last_commit_id(pending_contexts);
+
+  committed_future.wait();
+}
+
+std::shared_ptr<CommitContext> TransactionManager::_new_commit_context() {
+  return std::make_shared<CommitContext>(_next_commit_id++);
+}
+
+std::vector<std::shared_ptr<CommitContext>> TransactionManager::_new_commit_contexts(size_t count) {
+  const auto first_commit_id = _next_commit_id.fetch_add(static_cast<CommitID>(count));
+
+  auto contexts = std::vector<std::shared_ptr<CommitContext>>{};
+  contexts.reserve(count);
+  for (auto commit_id = first_commit_id; commit_id < first_commit_id + count; ++commit_id) {
+    contexts.emplace_back(std::make_shared<CommitContext>(commit_id));
+  }
+  return contexts;
 }
 
-void TransactionManager::_try_increment_last_commit_id(std::shared_ptr<CommitContext> context) {
-  auto current_context = context;
+void TransactionManager::_try_increment_last_commit_id(const std::vector<std::shared_ptr<CommitContext>>& contexts) {
+  for (const auto& context : contexts) {
+    DebugAssert(context->is_pending(), "Only pending commit contexts can be committed");
+
+    const auto commit_id = context->commit_id();
+    auto& slot = _pending_commit_slots[commit_id % PENDING_COMMIT_SLOT_COUNT];
+
+    // The slot belongs to the commit id PENDING_COMMIT_SLOT_COUNT before this one until it has been published and the
+    // slot has been released. While waiting, this thread helps publishing, which also guarantees progress for batches
+    // with more commit ids than slots.
+    while (commit_id > _last_commit_id + PENDING_COMMIT_SLOT_COUNT || slot.commit_id != 0) {
+      _publish_pending_commits();
+      std::this_thread::yield();
+    }
+
+    slot.context = context;
+    slot.commit_id = commit_id;
+  }
 
-  while (current_context->is_pending()) {
-    auto expected_last_commit_id = current_context->commit_id() - 1;
+  _publish_pending_commits();
+}
+
+/**
+ * Logic of the lock-free algorithm
+ *
+ * A thread that publishes starts at the last commit id and looks for the longest run of consecutive commit ids that
+ * are pending. It then tries to advance the last commit id over the whole run with a single compare-and-swap. Since
+ * the last commit id only increases, the compare-and-swap only succeeds if no other thread has published in the
+ * meantime, in which case the slots of the run still hold the pending commit contexts. The thread that succeeds owns
+ * the slots of the run, fires the callbacks of their commit contexts and releases the slots. The others retry from
+ * the new last commit id.
+ *
+ * A pending commit context is stored in its slot before the storing thread tries to publish. Thus, either the storing
+ * thread finds the run up to its own commit id, or a thread that publishes the commit ids before it finds the stored
+ * commit context as part of its run.
+ */
+void TransactionManager::_publish_pending_commits() {
+  while (true) {
+    auto last_commit_id = _last_commit_id.load();
+
+    auto new_last_commit_id = last_commit_id;
+    while (_pending_commit_slots[(new_last_commit_id + 1) % PENDING_COMMIT_SLOT_COUNT].commit_id ==
+           new_last_commit_id + 1) {
+      ++new_last_commit_id;
+    }
 
-    if (!_last_commit_id.compare_exchange_strong(expected_last_commit_id, current_context->commit_id())) return;
+    if (new_last_commit_id == last_commit_id) return;
 
-    current_context->fire_callback();
+    if (!_last_commit_id.compare_exchange_strong(last_commit_id, new_last_commit_id)) continue;
 
-    if (!current_context->has_next()) return;
+    for (auto commit_id = last_commit_id + 1; commit_id <= new_last_commit_id; ++commit_id) {
+      auto& slot = _pending_commit_slots[commit_id % PENDING_COMMIT_SLOT_COUNT];
+      const auto context = std::move(slot.context);
+      slot.commit_id = 0;
 
-    current_context = current_context->next();
+      context->fire_callback();
+    }
   }
 }
 
@@ -1,8 +1,12 @@
 #pragma once
 
+#include <array>
 #include <atomic>
 #include <functional>
 #include <memory>
+#include <mutex>
+#include <set>
+#include <vector>
 
 #include "types.hpp"
 
@@ -32,6 +36,11 @@
  * TransactionContext contains data used by a transaction, mainly its ID, the snapshot commit ID explained above, and,
  * when it enters the commit phase, the TransactionManager gives it a CommitContext, which contains
  * a new commit ID that is used to make its changes visible to others.
+ *
+ * Commit IDs are taken from an atomic counter, several at once for a batch of transactions (see commit_batch()).
+ * Transactions can finish committing their records in any order. The last commit ID, however, only advances over
+ * commit IDs of transactions that have finished. Whichever transaction finds a run of finished transactions after the
+ * last commit ID publishes all of them at once.
  */
 
 namespace opossum {
@@ -52,11 +61,42 @@ class TransactionManager : private Noncopyable {
 
   CommitID last_commit_id() const;
 
+  /**
+   * Continues assigning commit ids after last_commit_id. Used when a database is restored from a checkpoint and the
+   * log (see logging/checkpoint.hpp), so that the restored commit ids stay valid. Must not be called while
+   * transactions are active.
+   */
+  void set_last_commit_id(CommitID last_commit_id);
+
+  /**
+   * The smallest snapshot commit id of all transaction contexts that still exist, or last_commit_id() if there are
+   * none. Rows that have been invalidated at or before this commit id are invisible to all current and future
+   * transactions and can be removed (see concurrency/garbage_collector.hpp).
+   */
+  CommitID oldest_active_snapshot_commit_id() const;
+
   /**
    * Creates a new transaction context
    */
   std::shared_ptr<TransactionContext> new_transaction_context();
 
+  /**
+   * Creates a transaction context for a transaction that only reads, e.g., an auto-commit SELECT. It consists of not
+   * much more than a snapshot commit id: it does not take a transaction id from the global counter, read-write
+   * operators cannot be executed in it, and committing it neither assigns nor waits for a commit id.
+   */
+  std::shared_ptr<TransactionContext> new_read_only_transaction_context();
+
+  /**
+   * Commits several transactions, e.g., the transactions that a server has collected from its clients. Their commit
+   * ids are assigned at once and, unless they have to wait for the log, the transactions become visible at once.
+   * Transactions that have been committed or rolled back before are skipped. Transactions whose modifications could not
+   * be logged are rolled back (see TransactionContext::commit_async()).
+   *
+   * Blocks until all transactions are committed or rolled back.
+   */
+  void commit_batch(const std::vector<std::shared_ptr<TransactionContext>>& transaction_contexts);
+
  private:
   friend class TransactionContext;
 
@@ -66,7 +106,24 @@ class TransactionManager : private Noncopyable {
   TransactionManager& operator=(TransactionManager&&) = delete;
 
   std::shared_ptr<CommitContext> _new_commit_context();
-  void _try_increment_last_commit_id(std::shared_ptr<CommitContext> context);
+
+  // Creates commit contexts with consecutive commit ids
+  std::vector<std::shared_ptr<CommitContext>> _new_commit_contexts(size_t count);
+
+  /**
+   * Adds pending commit contexts with ascending commit ids and publishes them as soon as all commit contexts with
+   * smaller commit ids are pending as well.
+   */
+  void _try_increment_last_commit_id(const std::vector<std::shared_ptr<CommitContext>>& contexts);
+
+  // Advances the last commit id over all consecutive pending commit contexts and fires their callbacks
+  void _publish_pending_commits();
+
+  // Creates a transaction context and registers its snapshot commit id, see _active_snapshot_shards
+  std::shared_ptr<TransactionContext> _new_registered_transaction_context(TransactionID transaction_id);
+
+  // Called when a TransactionContext created by the TransactionManager is destroyed
+  void _deregister_transaction(CommitID snapshot_commit_id, size_t snapshot_shard);
 
  private:
   std::atomic<TransactionID> _next_transaction_id;
@@ -78,6 +135,34 @@ class TransactionManager : private Noncopyable {
   // been there "from the beginning of time".
   static constexpr auto INITIAL_COMMIT_ID = CommitID{1};
 
-  std::shared_ptr<CommitContext> _last_commit_context;
+  std::atomic<CommitID> _next_commit_id;
+
+  /**
+   * Pending commit contexts that have not been published yet. The commit context with commit id c is stored in the
+   * slot c % PENDING_COMMIT_SLOT_COUNT. A slot is free if its commit id is 0, which is never handed out. Once a commit
+   * id has been published, the publishing thread releases the slot. Commit contexts wait for their slot if there are
+   * PENDING_COMMIT_SLOT_COUNT unpublished commit ids before them.
+   */
+  struct PendingCommitSlot {
+    std::atomic<CommitID> commit_id{0};
+    std::shared_ptr<CommitContext> context;
+  };
+
+  static constexpr auto PENDING_COMMIT_SLOT_COUNT = CommitID{4096};
+  std::array<PendingCommitSlot, PENDING_COMMIT_SLOT_COUNT> _pending_commit_slots;
+
+  /**
+   * Snapshot commit ids of all existing transaction contexts. A transaction reads last_commit_id and registers its
+   * snapshot while holding the mutex of a shard, so that oldest_active_snapshot_commit_id(), which holds the mutexes
+   * of all shards, never misses a starting transaction. Transactions of different threads usually register in
+   * different shards and do not contend for the same mutex.
+   */
+  struct ActiveSnapshotShard {
+    std::mutex mutex;
+    std::multiset<CommitID> snapshot_commit_ids;
+  };
+
+  static constexpr auto ACTIVE_SNAPSHOT_SHARD_COUNT = size_t{32};
+  mutable std::array<ActiveSnapshotShard, ACTIVE_SNAPSHOT_SHARD_COUNT> _active_snapshot_shards;
 };
 }  // namespace opossum
@@ -0,0 +1,565 @@
+#include "table_snapshot.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "import_export/binary.hpp"
+#include "resolve_type.hpp"
+#include "statistics/chunk_statistics/chunk_column_statistics.hpp"
+#include "statistics/chunk_statistics/chunk_statistics.hpp"
+#include "storage/chunk.hpp"
+#include "storage/index/base_filter.hpp"
+#include "storage/index/counting_quotient_filter/counting_quotient_filter.hpp"
+#include "storage/resolve_encoded_column_type.hpp"
+#include "storage/table.hpp"
+#include "storage/value_column.hpp"
+#include "storage/vector_compression/fixed_size_byte_aligned/fixed_size_byte_aligned_vector.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
+#include "storage/vector_compression/simd_bp128/simd_bp128_vector.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+constexpr auto SNAPSHOT_MAGIC = uint32_t{0x48595253};  // "HYRS"
+constexpr auto SNAPSHOT_FORMAT_VERSION = uint32_t{1};
+
+// Arrays are aligned so that they can be accessed in place in the mapped file, including SimdBp128's 128-bit blocks
+constexpr auto ARRAY_ALIGNMENT = size_t{16};
+
+template <typename Container>
+constexpr bool is_contiguous_vector_v =
+    std::is_same_v<Container, std::vector<typename Container::value_type, typename Container::allocator_type>>;
+
+class SnapshotWriter {
+ public:
+  explicit SnapshotWriter(const std::string& file_path) {
+    _stream.exceptions(std::ofstream::failbit | std::ofstream::badbit);
+    _stream.open(file_path, std::ios::binary | std::ios::trunc);
+  }
+
+  template <typename T>
+  void write_value(const T& value) {
+    static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable values can be written directly");
+    _write(&value, sizeof(T));
+  }
+
+  // Writes the number of elements, followed by the aligned elements. Strings and bools are stored in a fixed-size
+  // format, concurrent vectors are copied into a contiguous vector first.
+  template <typename Container>
+  void write_values(const Container& values) {
+    using T = typename Container::value_type;
+
+    if constexpr (std::is_same_v<T, std::string>) {
+      auto string_lengths = std::vector<StringLength>{};
+      auto characters = std::vector<char>{};
+      string_lengths.reserve(values.size());
+      for (const auto& value : values) {
+        string_lengths.emplace_back(static_cast<StringLength>(value.size()));
+        characters.insert(characters.end(), value.begin(), value.end());
+      }
+      write_values(string_lengths);
+      write_values(characters);
+    } else if constexpr (std::is_same_v<T, bool>) {
+      write_values(std::vector<BoolAsByteType>(values.begin(), values.end()));
+    } else if constexpr (!is_contiguous_vector_v<Container>) {
+      write_values(std::vector<T>(values.begin(), values.end()));
+    } else {
+      static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable values can be written directly");
+      write_value(static_cast<uint64_t>(values.size()));
+      _align();
+      _write(values.data(), values.size() * sizeof(T));
+    }
+  }
+
+  void write_string(const std::string& string) { write_values(std::vector<char>(string.begin(), string.end())); }
+
+  void close() { _stream.close(); }
+
+ private:
+  void _write(const void* data, const size_t size) {
+    _stream.write(reinterpret_cast<const char*>(data), size);
+    _offset += size;
+  }
+
+  void _align() {
+    static constexpr char padding[ARRAY_ALIGNMENT]{};
+    _write(padding, (ARRAY_ALIGNMENT - _offset % ARRAY_ALIGNMENT) % ARRAY_ALIGNMENT);
+  }
+
+  std::ofstream _stream;
+  size_t _offset{0};
+};
+
+// Maps the snapshot file into memory, so that arrays can be copied into the columns without going through a stream
+class SnapshotReader : private Noncopyable {
+ public:
+  explicit SnapshotReader(const std::string& file_path) : _file_path(file_path) {
+    const auto file_descriptor = ::open(file_path.c_str(), O_RDONLY);
+    Assert(file_descriptor >= 0, "Cannot open snapshot " + file_path);
+
+    struct stat file_stat {};
+    Assert(::fstat(file_descriptor, &file_stat) == 0, "Cannot read size of snapshot " + file_path);
+    _size = static_cast<size_t>(file_stat.st_size);
+
+    if (_size > 0) {
+      auto* const mapping = ::mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+      Assert(mapping != MAP_FAILED, "Cannot map snapshot " + file_path);
+      _data = static_cast<const char*>(mapping);
+      ::madvise(mapping, _size, MADV_SEQUENTIAL);
+    }
+
+    // The mapping stays valid after the file is closed
+    ::close(file_descriptor);
+  }
+
+  ~SnapshotReader() {
+    if (_data) ::munmap(const_cast<char*>(_data), _size);
+  }
+
+  template <typename T>
+  T read_value() {
+    static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable values can be read directly");
+    auto value = T{};
+    std::memcpy(&value, _consume(sizeof(T)), sizeof(T));
+    return value;
+  }
+
+  // Counterpart of SnapshotWriter::write_values()
+  template <typename Container>
+  Container read_values() {
+    using T = typename Container::value_type;
+
+    if constexpr (std::is_same_v<T, std::string>) {
+      const auto string_lengths = read_values<std::vector<StringLength>>();
+      const auto [characters, num_characters] = read_array<char>();
+
+      auto values = Container(string_lengths.size());
+      auto character_offset = size_t{0};
+      for (auto value_idx = size_t{0}; value_idx < string_lengths.size(); ++value_idx) {
+        Assert(character_offset + string_lengths[value_idx] <= num_characters,
+               "Snapshot " + _file_path + " is corrupt");
+        values[value_idx].assign(characters + character_offset, string_lengths[value_idx]);
+        character_offset += string_lengths[value_idx];
+      }
+      return values;
+    } else if constexpr (std::is_same_v<T, bool>) {
+      const auto [bools, count] = read_array<BoolAsByteType>();
+      return _make_container<Container>(bools, bools + count);
+    } else {
+      const auto [values, count] = read_array<T>();
+      return _make_container<Container>(values, values + count);
+    }
+  }
+
+  std::string read_string() {
+    const auto [characters, count] = read_array<char>();
+    return std::string(characters, count);
+  }
+
+  // Returns the elements of an array written by SnapshotWriter::write_values() in place, i.e., within the mapping
+  template <typename T>
+  std::pair<const T*, size_t> read_array() {
+    const auto count = read_value<uint64_t>();
+    _offset += (ARRAY_ALIGNMENT - _offset % ARRAY_ALIGNMENT) % ARRAY_ALIGNMENT;
+    return {reinterpret_cast<const T*>(_consume(count * sizeof(T))), count};
+  }
+
+ private:
+  // pmr_concurrent_vector cannot be constructed from an iterator range
+  template <typename Container, typename Iterator>
+  static Container _make_container(const Iterator begin, const Iterator end) {
+    if constexpr (is_contiguous_vector_v<Container>) {
+      return Container(begin, end);
+    } else {
+      auto container = Container{};
+      container.grow_by(begin, end);
+      return container;
+    }
+  }
+
+  const char* _consume(const size_t size) {
+    Assert(_offset + size <= _size, "Snapshot " + _file_path + " is truncated");
+    const auto* const data = _data + _offset;
+    _offset += size;
+    return data;
+  }
+
+  const std::string _file_path;
+  const char* _data{nullptr};
+  size_t _size{0};
+  size_t _offset{0};
+};
+
+void write_compressed_vector(SnapshotWriter& writer, const BaseCompressedVector& vector) {
+  writer.write_value(vector.type());
+
+  resolve_compressed_vector_type(vector, [&](const auto& typed_vector) {
+    using VectorType = std::decay_t<decltype(typed_vector)>;
+
+    if constexpr (std::is_same_v<VectorType, SimdBp128Vector>) {
+      writer.write_value(static_cast<uint64_t>(typed_vector.size()));
+    }
+    writer.write_values(typed_vector.data());
+  });
+}
+
+std::unique_ptr<const BaseCompressedVector> read_compressed_vector(SnapshotReader& reader) {
+  const auto type = reader.read_value<CompressedVectorType>();
+
+  switch (type) {
+    case CompressedVectorType::FixedSize4ByteAligned:
+      return std::make_unique<FixedSizeByteAlignedVector<uint32_t>>(reader.read_values<pmr_vector<uint32_t>>());
+    case CompressedVectorType::FixedSize2ByteAligned:
+      return std::make_unique<FixedSizeByteAlignedVector<uint16_t>>(reader.read_values<pmr_vector<uint16_t>>());
+    case CompressedVectorType::FixedSize1ByteAligned:
+      return std::make_unique<FixedSizeByteAlignedVector<uint8_t>>(reader.read_values<pmr_vector<uint8_t>>());
+    case CompressedVectorType::SimdBp128: {
+      const auto size = reader.read_value<uint64_t>();
+      return std::make_unique<SimdBp128Vector>(reader.read_values<pmr_vector<uint128_t>>(), size);
+    }
+    default:
+      Fail("Cannot read compressed vector of unknown type");
+  }
+}
+
+// Values of rows that are not part of the snapshot are not read, since they might be written concurrently
+template <typename T>
+void write_value_column(SnapshotWriter& writer, const ValueColumn<T>& column,
+                        const std::vector<bool>& row_is_included) {
+  const auto row_count = row_is_included.size();
+
+  if (column.is_nullable()) {
+    auto null_values = std::vector<bool>(row_count, false);
+    for (auto chunk_offset = size_t{0}; chunk_offset < row_count; ++chunk_offset) {
+      if (row_is_included[chunk_offset]) null_values[chunk_offset] = column.null_values()[chunk_offset];
+    }
+    writer.write_values(null_values);
+  }
+
+  auto values = std::vector<T>(row_count);
+  for (auto chunk_offset = size_t{0}; chunk_offset < row_count; ++chunk_offset) {
+    if (row_is_included[chunk_offset]) values[chunk_offset] = column.values()[chunk_offset];
+  }
+  writer.write_values(values);
+}
+
+template <typename T>
+std::shared_ptr<BaseColumn> read_value_column(SnapshotReader& reader, const bool is_nullable) {
+  if (is_nullable) {
+    auto null_values = reader.read_values<pmr_concurrent_vector<bool>>();
+    auto values = reader.read_values<pmr_concurrent_vector<T>>();
+    return std::make_shared<ValueColumn<T>>(std::move(values), std::move(null_values));
+  }
+
+  return std::make_shared<ValueColumn<T>>(reader.read_values<pmr_concurrent_vector<T>>());
+}
+
+template <typename T>
+void write_encoded_column(SnapshotWriter& writer, const DictionaryColumn<T>& column) {
+  writer.write_values(*column.dictionary());
+  write_compressed_vector(writer, *column.attribute_vector());
+  writer.write_value(column.null_value_id());
+}
+
+template <typename T>
+void write_encoded_column(SnapshotWriter& writer, const RunLengthColumn<T>& column) {
+  writer.write_values(*column.values());
+  writer.write_values(*column.null_values());
+  writer.write_values(*column.end_positions());
+}
+
+template <typename T>
+void write_encoded_column(SnapshotWriter& writer, const FrameOfReferenceColumn<T>& column) {
+  writer.write_values(column.block_minima());
+  writer.write_values(column.null_values());
+  write_compressed_vector(writer, column.offset_values());
+}
+
+template <typename T>
+std::shared_ptr<BaseColumn> read_dictionary_column(SnapshotReader& reader) {
+  auto dictionary = std::make_shared<pmr_vector<T>>(reader.read_values<pmr_vector<T>>());
+  std::shared_ptr<const BaseCompressedVector> attribute_vector = read_compressed_vector(reader);
+  const auto null_value_id = reader.read_value<ValueID>();
+  return std::make_shared<DictionaryColumn<T>>(dictionary, attribute_vector, null_value_id);
+}
+
+template <typename T>
+std::shared_ptr<BaseColumn> read_run_length_column(SnapshotReader& reader) {
+  auto values = std::make_shared<pmr_vector<T>>(reader.read_values<pmr_vector<T>>());
+  auto null_values = std::make_shared<pmr_vector<bool>>(reader.read_values<pmr_vector<bool>>());
+  auto end_positions = std::make_shared<pmr_vector<ChunkOffset>>(reader.read_values<pmr_vector<ChunkOffset>>());
+  return std::make_shared<RunLengthColumn<T>>(values, null_values, end_positions);
+}
+
+template <typename T>
+std::shared_ptr<BaseColumn> read_frame_of_reference_column(SnapshotReader& reader) {
+  if constexpr (hana::value(encoding_supports_data_type(enum_c<EncodingType, EncodingType::FrameOfReference>,
+                                                        hana::type_c<T>))) {
+    auto block_minima = reader.read_values<pmr_vector<T>>();
+    auto null_values = reader.read_values<pmr_vector<bool>>();
+    auto offset_values = read_compressed_vector(reader);
+    return std::make_shared<FrameOfReferenceColumn<T>>(std::move(block_minima), std::move(null_values),
+                                                       std::move(offset_values));
+  } else {
+    Fail("FrameOfReference encoding does not support this data type");
+  }
+}
+
+void write_column(SnapshotWriter& writer, const BaseColumn& base_column, const DataType data_type,
+                  const std::vector<bool>& row_is_included) {
+  resolve_data_type(data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    if (const auto* value_column = dynamic_cast<const ValueColumn<ColumnDataType>*>(&base_column)) {
+      writer.write_value(EncodingType::Unencoded);
+      write_value_column(writer, *value_column, row_is_included);
+      return;
+    }
+
+    const auto* encoded_column = dynamic_cast<const BaseEncodedColumn*>(&base_column);
+    Assert(encoded_column, "Only ValueColumns and encoded columns can be stored in a snapshot");
+
+    writer.write_value(encoded_column->encoding_type());
+    resolve_encoded_column_type<ColumnDataType>(
+        *encoded_column, [&](const auto& typed_column) { write_encoded_column(writer, typed_column); });
+  });
+}
+
+std::shared_ptr<BaseColumn> read_column(SnapshotReader& reader, const DataType data_type, const bool is_nullable) {
+  const auto encoding_type = reader.read_value<EncodingType>();
+
+  auto column = std::shared_ptr<BaseColumn>{};
+  resolve_data_type(data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    switch (encoding_type) {
+      case EncodingType::Unencoded:
+        column = read_value_column<ColumnDataType>(reader, is_nullable);
+        break;
+      case EncodingType::Dictionary:
+        column = read_dictionary_column<ColumnDataType>(reader);
+        break;
+      case EncodingType::RunLength:
+        column = read_run_length_column<ColumnDataType>(reader);
+        break;
+      case EncodingType::FrameOfReference:
+        column = read_frame_of_reference_column<ColumnDataType>(reader);
+        break;
+    }
+  });
+
+  Assert(column, "Cannot read column with unknown encoding");
+  return column;
+}
+
+// The filter is stored as it is in memory, so that its values do not have to be hashed and inserted again
+void write_quotient_filter(SnapshotWriter& writer, const BaseFilter& filter, const DataType data_type) {
+  writer.write_value(filter.quotient_bits());
+  writer.write_value(filter.remainder_bits());
+
+  resolve_data_type(data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    const auto* typed_filter = dynamic_cast<const CountingQuotientFilter<ColumnDataType>*>(&filter);
+    Assert(typed_filter, "Only CountingQuotientFilters can be stored in a snapshot");
+    writer.write_values(typed_filter->serialize());
+  });
+}
+
+std::shared_ptr<BaseFilter> read_quotient_filter(SnapshotReader& reader, const DataType data_type) {
+  const auto quotient_bits = reader.read_value<uint8_t>();
+  const auto remainder_bits = reader.read_value<uint8_t>();
+  const auto [data, size] = reader.read_array<char>();
+
+  auto filter = std::shared_ptr<BaseFilter>{};
+  resolve_data_type(data_type, [&, data = data, size = size](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    filter = CountingQuotientFilter<ColumnDataType>::deserialize(quotient_bits, remainder_bits, data, size);
+  });
+  return filter;
+}
+
+void write_chunk(SnapshotWriter& writer, const Table& table, const Chunk& chunk, const CommitID snapshot_commit_id) {
+  // Inserts that are still running might have grown some of the vectors already. Their rows are not part of the
+  // snapshot anyway.
+  auto row_count = size_t{chunk.size()};
+  for (auto column_id = ColumnID{0}; column_id < chunk.column_count(); ++column_id) {
+    row_count = std::min(row_count, chunk.get_column(column_id)->size());
+  }
+
+  auto row_is_included = std::vector<bool>(row_count, true);
+
+  auto begin_cids = std::vector<CommitID>{};
+  auto end_cids = std::vector<CommitID>{};
+  if (chunk.has_mvcc_columns()) {
+    const auto mvcc_columns = chunk.mvcc_columns();
+    row_count = std::min(row_count, mvcc_columns->size());
+    row_is_included.resize(row_count);
+
+    // Changes of transactions that committed after the snapshot commit id are not part of the snapshot
+    begin_cids.resize(row_count);
+    end_cids.resize(row_count);
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+      const auto begin_cid = mvcc_columns->begin_cids[chunk_offset];
+      const auto end_cid = mvcc_columns->end_cids[chunk_offset];
+
+      row_is_included[chunk_offset] = begin_cid <= snapshot_commit_id;
+      begin_cids[chunk_offset] = row_is_included[chunk_offset] ? begin_cid : MvccColumns::MAX_COMMIT_ID;
+      end_cids[chunk_offset] = !row_is_included[chunk_offset] ? CommitID{0}
+                               : end_cid <= snapshot_commit_id ? end_cid
+                                                               : MvccColumns::MAX_COMMIT_ID;
+    }
+  }
+
+  writer.write_value(static_cast<ChunkOffset>(row_count));
+
+  for (auto column_id = ColumnID{0}; column_id < chunk.column_count(); ++column_id) {
+    write_column(writer, *chunk.get_column(column_id), table.column_data_type(column_id), row_is_included);
+  }
+
+  if (chunk.has_mvcc_columns()) {
+    writer.write_values(begin_cids);
+    writer.write_values(end_cids);
+  }
+
+  writer.write_value(static_cast<BoolAsByteType>(chunk.statistics() != nullptr));
+
+  auto art_index_column_ids = std::vector<ColumnID>{};
+  auto filter_column_ids = std::vector<ColumnID>{};
+  for (auto column_id = ColumnID{0}; column_id < chunk.column_count(); ++column_id) {
+    if (chunk.get_art_index(column_id)) art_index_column_ids.emplace_back(column_id);
+    if (chunk.get_filter(column_id)) filter_column_ids.emplace_back(column_id);
+  }
+  writer.write_values(art_index_column_ids);
+
+  writer.write_values(filter_column_ids);
+  for (const auto column_id : filter_column_ids) {
+    write_quotient_filter(writer, *chunk.get_filter(column_id), table.column_data_type(column_id));
+  }
+}
+
+void read_chunk(SnapshotReader& reader, Table& table) {
+  const auto row_count = reader.read_value<ChunkOffset>();
+
+  auto columns = ChunkColumns{};
+  for (auto column_id = ColumnID{0}; column_id < table.column_count(); ++column_id) {
+    columns.emplace_back(read_column(reader, table.column_data_type(column_id), table.column_is_nullable(column_id)));
+    Assert(columns.back()->size() == row_count, "Snapshot column does not match its chunk");
+  }
+
+  table.append_chunk(columns);
+  const auto chunk = table.get_chunk(static_cast<ChunkID>(table.chunk_count() - 1));
+
+  if (table.has_mvcc() == UseMvcc::Yes) {
+    const auto [begin_cids, num_begin_cids] = reader.read_array<CommitID>();
+    const auto [end_cids, num_end_cids] = reader.read_array<CommitID>();
+    Assert(num_begin_cids == row_count && num_end_cids == row_count, "Snapshot MVCC data does not match chunk");
+
+    {
+      auto mvcc_columns = chunk->mvcc_columns();
+      std::copy(begin_cids, begin_cids + row_count, mvcc_columns->begin_cids.begin());
+      std::copy(end_cids, end_cids + row_count, mvcc_columns->end_cids.begin());
+      mvcc_columns->update_summary();
+    }
+
+    // Like ChunkEncoder, move the MVCC columns of encoded chunks into contiguous memory
+    if (!chunk->is_mutable()) chunk->shrink_mvcc_columns();
+  }
+
+  const auto has_statistics = reader.read_value<BoolAsByteType>();
+  if (has_statistics) {
+    auto column_statistics = std::vector<std::shared_ptr<ChunkColumnStatistics>>{};
+    for (auto column_id = ColumnID{0}; column_id < chunk->column_count(); ++column_id) {
+      const auto column = chunk->get_mutable_column(column_id);
+      const auto is_encoded = std::dynamic_pointer_cast<BaseEncodedColumn>(column) != nullptr;
+      column_statistics.emplace_back(
+          is_encoded ? ChunkColumnStatistics::build_statistics(table.column_data_type(column_id), column) : nullptr);
+    }
+    chunk->set_statistics(std::make_shared<ChunkStatistics>(column_statistics));
+  }
+
+  for (const auto column_id : reader.read_values<std::vector<ColumnID>>()) {
+    chunk->populate_art_index(column_id);
+  }
+
+  for (const auto column_id : reader.read_values<std::vector<ColumnID>>()) {
+    chunk->set_quotient_filter(column_id, read_quotient_filter(reader, table.column_data_type(column_id)));
+  }
+}
+
+}  // namespace
+
+namespace opossum {
+
+void write_table_snapshot(const std::shared_ptr<const Table>& table, const CommitID snapshot_commit_id,
+                          const std::string& file_path) {
+  Assert(table->type() == TableType::Data, "Only data tables can be stored in a snapshot");
+
+  auto writer = SnapshotWriter{file_path};
+
+  writer.write_value(SNAPSHOT_MAGIC);
+  writer.write_value(SNAPSHOT_FORMAT_VERSION);
+  writer.write_value(snapshot_commit_id);
+  writer.write_value(table->max_chunk_size());
+  writer.write_value(table->has_mvcc());
+
+  writer.write_value(static_cast<uint16_t>(table->column_count()));
+  for (const auto& column_definition : table->column_definitions()) {
+    writer.write_string(column_definition.name);
+    writer.write_value(column_definition.data_type);
+    writer.write_value(static_cast<BoolAsByteType>(column_definition.nullable));
+  }
+
+  const auto chunk_count = table->chunk_count();
+  writer.write_value(chunk_count);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    write_chunk(writer, *table, *table->get_chunk(chunk_id), snapshot_commit_id);
+  }
+
+  writer.close();
+}
+
+std::shared_ptr<Table> read_table_snapshot(const std::string& file_path) {
+  auto reader = SnapshotReader{file_path};
+
+  Assert(reader.read_value<uint32_t>() == SNAPSHOT_MAGIC, file_path + " is not a table snapshot");
+  Assert(reader.read_value<uint32_t>() == SNAPSHOT_FORMAT_VERSION, "Unsupported snapshot version in " + file_path);
+  reader.read_value<CommitID>();
+
+  const auto max_chunk_size = reader.read_value<uint32_t>();
+  const auto use_mvcc = reader.read_value<UseMvcc>();
+
+  const auto column_count = reader.read_value<uint16_t>();
+  auto column_definitions = TableColumnDefinitions{};
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    auto name = reader.read_string();
+    const auto data_type = reader.read_value<DataType>();
+    const auto nullable = reader.read_value<BoolAsByteType>() != 0;
+    column_definitions.emplace_back(std::move(name), data_type, nullable);
+  }
+
+  auto table = std::make_shared<Table>(column_definitions, TableType::Data, max_chunk_size, use_mvcc);
+
+  const auto chunk_count = reader.read_value<ChunkID>();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    read_chunk(reader, *table);
+  }
+
+  return table;
+}
+
+}  // namespace opossum
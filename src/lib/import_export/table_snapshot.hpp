@@ -0,0 +1,41 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+/**
+ * Table snapshots store a table as it is laid out in memory, so that it can be restored without parsing or encoding
+ * the data again (unlike ImportCsv or ImportBinary).
+ *
+ * A snapshot consists of:
+ *  - a header with the snapshot commit id, the maximum chunk size, the MVCC setting, and the column definitions
+ *  - per chunk: its size, its columns (ValueColumns and all encoded columns including dictionaries and compressed
+ *    vectors), its MVCC begin and end commit ids, and the secondary structures (ART indices and counting quotient
+ *    filters) that exist on its columns
+ *
+ * All arrays are aligned to 16 bytes within the file. read_table_snapshot() maps the file into memory and copies each
+ * array once, straight from the mapping into the vectors of the columns. The arrays are not used in place: columns own
+ * their memory in pmr vectors (which a memory resource might place on a NUMA node) and have to outlive the mapping.
+ *
+ * The snapshot is consistent as of snapshot_commit_id, even if transactions modify the table concurrently: rows
+ * inserted after the snapshot commit id are stored as invisible, rows deleted after it are stored as not deleted.
+ * RowIDs are preserved, so that log entries with later commit ids can be replayed on top of it (see
+ * logging/log_recovery.hpp).
+ *
+ * Counting quotient filters are stored as they are laid out in memory and restored without inserting the values again.
+ * ART indices are stored by their definition and rebuilt when the snapshot is read. Their nodes are allocated one by
+ * one and linked by pointers, so restoring them would allocate every node again, which is what the bulk insert of
+ * AdaptiveRadixTreeIndex does anyway.
+ */
+void write_table_snapshot(const std::shared_ptr<const Table>& table, const CommitID snapshot_commit_id,
+                          const std::string& file_path);
+
+std::shared_ptr<Table> read_table_snapshot(const std::string& file_path);
+
+}  // namespace opossum
@@ -0,0 +1,131 @@
+#include "checkpoint.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "json.hpp"
+
+#include "concurrency/transaction_manager.hpp"
+#include "import_export/table_snapshot.hpp"
+#include "logger.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+#include "utils/filesystem.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+const auto MANIFEST_FILE_NAME = std::string{"checkpoint.json"};
+
+// Makes sure that the file (or directory) is written to disk, not only to the OS
+void sync_file(const std::string& file_path) {
+  const auto file_descriptor = ::open(file_path.c_str(), O_RDONLY);
+  Assert(file_descriptor >= 0, "Cannot open " + file_path);
+  const auto result = ::fsync(file_descriptor);
+  ::close(file_descriptor);
+  Assert(result == 0, "Cannot sync " + file_path);
+}
+
+std::optional<nlohmann::json> read_manifest(const std::string& directory) {
+  const auto manifest_path = directory + "/" + MANIFEST_FILE_NAME;
+  if (!filesystem::exists(manifest_path)) return std::nullopt;
+
+  auto manifest_file = std::ifstream{manifest_path};
+  auto manifest = nlohmann::json{};
+  manifest_file >> manifest;
+  return manifest;
+}
+
+}  // namespace
+
+namespace opossum {
+
+CommitID create_checkpoint(const std::string& directory) {
+  const auto snapshot_commit_id = TransactionManager::get().last_commit_id();
+
+  // Each checkpoint is written into a new subdirectory, so that the previous one stays valid until it is replaced
+  const auto previous_manifest = read_manifest(directory);
+  const auto sequence_number = previous_manifest ? previous_manifest->at("sequence_number").get<size_t>() + 1 : 0;
+  const auto snapshot_directory_name = "checkpoint_" + std::to_string(sequence_number);
+  const auto snapshot_directory = directory + "/" + snapshot_directory_name;
+  filesystem::create_directories(snapshot_directory);
+
+  auto manifest = nlohmann::json{};
+  manifest["sequence_number"] = sequence_number;
+  manifest["commit_id"] = snapshot_commit_id;
+  manifest["directory"] = snapshot_directory_name;
+  manifest["tables"] = nlohmann::json::array();
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (const auto& table_name : StorageManager::get().table_names()) {
+    const auto file_name = std::to_string(jobs.size()) + ".snapshot";
+    const auto file_path = snapshot_directory + "/" + file_name;
+    manifest["tables"].push_back({{"name", table_name}, {"file", file_name}});
+
+    const auto table = StorageManager::get().get_table(table_name);
+    jobs.emplace_back(std::make_shared<JobTask>([table, snapshot_commit_id, file_path]() {
+      write_table_snapshot(table, snapshot_commit_id, file_path);
+      sync_file(file_path);
+    }));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+  sync_file(snapshot_directory);
+
+  // Replacing the manifest completes the checkpoint
+  const auto manifest_path = directory + "/" + MANIFEST_FILE_NAME;
+  const auto new_manifest_path = manifest_path + ".new";
+  {
+    auto manifest_file = std::ofstream{new_manifest_path};
+    manifest_file << manifest.dump(2);
+  }
+  sync_file(new_manifest_path);
+  Assert(std::rename(new_manifest_path.c_str(), manifest_path.c_str()) == 0, "Cannot replace " + manifest_path);
+  sync_file(directory);
+
+  if (previous_manifest) {
+    filesystem::remove_all(directory + "/" + previous_manifest->at("directory").get<std::string>());
+  }
+
+  auto& logger = Logger::get();
+  if (logger.is_enabled()) logger.truncate(snapshot_commit_id);
+
+  return snapshot_commit_id;
+}
+
+std::optional<CommitID> load_checkpoint(const std::string& directory) {
+  const auto manifest = read_manifest(directory);
+  if (!manifest) return std::nullopt;
+
+  const auto snapshot_directory = directory + "/" + manifest->at("directory").get<std::string>();
+  const auto& table_entries = manifest->at("tables");
+
+  // Tables are read in parallel and added to the StorageManager afterwards
+  auto tables = std::vector<std::shared_ptr<Table>>(table_entries.size());
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto table_idx = size_t{0}; table_idx < table_entries.size(); ++table_idx) {
+    const auto file_path = snapshot_directory + "/" + table_entries[table_idx].at("file").get<std::string>();
+    jobs.emplace_back(std::make_shared<JobTask>(
+        [&tables, table_idx, file_path]() { tables[table_idx] = read_table_snapshot(file_path); }));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+  for (auto table_idx = size_t{0}; table_idx < table_entries.size(); ++table_idx) {
+    StorageManager::get().add_table(table_entries[table_idx].at("name").get<std::string>(), tables[table_idx]);
+  }
+
+  const auto commit_id = manifest->at("commit_id").get<CommitID>();
+  TransactionManager::get().set_last_commit_id(commit_id);
+  return commit_id;
+}
+
+}  // namespace opossum
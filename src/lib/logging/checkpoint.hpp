@@ -0,0 +1,34 @@
+#pragma once
+
+#include <optional>
+#include <string>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * A checkpoint stores a snapshot of all tables of the StorageManager (see import_export/table_snapshot.hpp) that is
+ * consistent as of TransactionManager::last_commit_id(). Restarting from a checkpoint is much faster than importing and
+ * encoding the tables again, and only the log entries of transactions that committed afterwards have to be replayed.
+ *
+ * The directory contains a manifest that names the checkpoint commit id and the snapshot of each table. Snapshots are
+ * written into a new subdirectory and the manifest is replaced atomically once they are durable, so that a crash
+ * during a checkpoint leaves the previous checkpoint intact. Afterwards, older checkpoints are removed and the log is
+ * truncated (see Logger::truncate()).
+ *
+ * Checkpoints can be created while transactions are running. Views are not part of checkpoints.
+ *
+ * @return the commit id of the checkpoint
+ */
+CommitID create_checkpoint(const std::string& directory);
+
+/**
+ * Adds the tables of the checkpoint in directory to the StorageManager and continues with its commit id. Has to be
+ * called on startup, before recover_from_log() (see logging/log_recovery.hpp).
+ *
+ * @return the commit id of the checkpoint, or nullopt if there is no checkpoint in directory
+ */
+std::optional<CommitID> load_checkpoint(const std::string& directory);
+
+}  // namespace opossum
@@ -0,0 +1,163 @@
+#include "log_entry.hpp"
+
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "utils/assert.hpp"
+#include "utils/murmur_hash.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+constexpr auto CHECKSUM_SEED = 0u;
+
+template <typename T>
+void write_value(std::vector<char>& buffer, const T& value) {
+  const auto offset = buffer.size();
+  buffer.resize(offset + sizeof(T));
+  std::memcpy(buffer.data() + offset, &value, sizeof(T));
+}
+
+template <>
+void write_value(std::vector<char>& buffer, const std::string& value) {
+  write_value(buffer, static_cast<uint32_t>(value.size()));
+  buffer.insert(buffer.end(), value.begin(), value.end());
+}
+
+// Only called for entries whose checksum matched, so running out of bytes is a bug
+template <typename T>
+T read_value(const std::vector<char>& buffer, size_t& offset) {
+  DebugAssert(offset + sizeof(T) <= buffer.size(), "Log entry ended unexpectedly");
+  T value;
+  std::memcpy(&value, buffer.data() + offset, sizeof(T));
+  offset += sizeof(T);
+  return value;
+}
+
+template <>
+std::string read_value(const std::vector<char>& buffer, size_t& offset) {
+  const auto size = read_value<uint32_t>(buffer, offset);
+  DebugAssert(offset + size <= buffer.size(), "Log entry ended unexpectedly");
+  auto value = std::string{buffer.data() + offset, size};
+  offset += size;
+  return value;
+}
+
+void write_all_type_variant(std::vector<char>& buffer, const AllTypeVariant& value) {
+  const auto data_type = data_type_from_all_type_variant(value);
+  write_value(buffer, data_type);
+  if (data_type == DataType::Null) return;
+
+  resolve_data_type(data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    write_value(buffer, boost::get<ColumnDataType>(value));
+  });
+}
+
+AllTypeVariant read_all_type_variant(const std::vector<char>& buffer, size_t& offset) {
+  const auto data_type = read_value<DataType>(buffer, offset);
+  if (data_type == DataType::Null) return NULL_VALUE;
+
+  auto value = AllTypeVariant{};
+  resolve_data_type(data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    value = read_value<ColumnDataType>(buffer, offset);
+  });
+  return value;
+}
+
+}  // namespace
+
+namespace opossum {
+
+LogEntry::LogEntry(const TransactionID transaction_id, const CommitID commit_id)
+    : transaction_id(transaction_id), commit_id(commit_id) {}
+
+void LogEntry::add_insert(const std::string& table_name, const RowID row_id, std::vector<AllTypeVariant> values) {
+  records.emplace_back(LogRecord{LogRecordType::Insert, table_name, row_id, std::move(values)});
+}
+
+void LogEntry::add_delete(const std::string& table_name, const RowID row_id) {
+  records.emplace_back(LogRecord{LogRecordType::Delete, table_name, row_id, {}});
+}
+
+void LogEntry::serialize(std::vector<char>& buffer) const {
+  const auto header_offset = buffer.size();
+  write_value(buffer, uint32_t{0});
+  write_value(buffer, uint32_t{0});
+
+  const auto payload_offset = buffer.size();
+  write_value(buffer, transaction_id);
+  write_value(buffer, commit_id);
+  write_value(buffer, static_cast<uint32_t>(records.size()));
+
+  for (const auto& record : records) {
+    write_value(buffer, record.type);
+    write_value(buffer, record.table_name);
+    write_value(buffer, record.row_id.chunk_id);
+    write_value(buffer, record.row_id.chunk_offset);
+
+    if (record.type == LogRecordType::Insert) {
+      write_value(buffer, static_cast<uint16_t>(record.values.size()));
+      for (const auto& value : record.values) {
+        write_all_type_variant(buffer, value);
+      }
+    }
+  }
+
+  const auto payload_size = static_cast<uint32_t>(buffer.size() - payload_offset);
+  const auto checksum = murmur_hash2(buffer.data() + payload_offset, static_cast<int>(payload_size), CHECKSUM_SEED);
+  std::memcpy(buffer.data() + header_offset, &payload_size, sizeof(uint32_t));
+  std::memcpy(buffer.data() + header_offset + sizeof(uint32_t), &checksum, sizeof(uint32_t));
+}
+
+std::optional<LogEntry> LogEntry::deserialize(const std::vector<char>& buffer, size_t& offset) {
+  constexpr auto HEADER_SIZE = 2 * sizeof(uint32_t);
+  if (offset + HEADER_SIZE > buffer.size()) return std::nullopt;
+
+  auto header_offset = offset;
+  const auto payload_size = read_value<uint32_t>(buffer, header_offset);
+  const auto checksum = read_value<uint32_t>(buffer, header_offset);
+
+  const auto payload_offset = offset + HEADER_SIZE;
+  if (payload_offset + payload_size > buffer.size()) return std::nullopt;
+  if (murmur_hash2(buffer.data() + payload_offset, static_cast<int>(payload_size), CHECKSUM_SEED) != checksum) {
+    return std::nullopt;
+  }
+
+  auto read_offset = payload_offset;
+  const auto transaction_id = read_value<TransactionID>(buffer, read_offset);
+  const auto commit_id = read_value<CommitID>(buffer, read_offset);
+  auto entry = LogEntry{transaction_id, commit_id};
+
+  const auto num_records = read_value<uint32_t>(buffer, read_offset);
+  entry.records.reserve(num_records);
+  for (auto record_idx = uint32_t{0}; record_idx < num_records; ++record_idx) {
+    const auto type = read_value<LogRecordType>(buffer, read_offset);
+    auto table_name = read_value<std::string>(buffer, read_offset);
+    const auto chunk_id = read_value<ChunkID>(buffer, read_offset);
+    const auto chunk_offset = read_value<ChunkOffset>(buffer, read_offset);
+
+    auto values = std::vector<AllTypeVariant>{};
+    if (type == LogRecordType::Insert) {
+      const auto num_values = read_value<uint16_t>(buffer, read_offset);
+      values.reserve(num_values);
+      for (auto value_idx = uint16_t{0}; value_idx < num_values; ++value_idx) {
+        values.emplace_back(read_all_type_variant(buffer, read_offset));
+      }
+    }
+
+    entry.records.emplace_back(
+        LogRecord{type, std::move(table_name), RowID{chunk_id, chunk_offset}, std::move(values)});
+  }
+
+  DebugAssert(read_offset == payload_offset + payload_size, "Log entry is longer than its records");
+  offset = payload_offset + payload_size;
+  return entry;
+}
+
+}  // namespace opossum
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+enum class LogRecordType : uint8_t { Insert = 0, Delete = 1 };
+
+/**
+ * A single modified row. Rows are identified by their RowID, which is why recovery has to start from the same table
+ * state that was present when logging was enabled (see logging/log_recovery.hpp).
+ */
+struct LogRecord {
+  LogRecordType type;
+  std::string table_name;
+  RowID row_id;
+
+  // Only set for inserts
+  std::vector<AllTypeVariant> values;
+};
+
+/**
+ * The redo information of a single committed transaction, written to the log by the Logger.
+ *
+ * Serialized format:
+ *   entry:  uint32 payload size | uint32 checksum of the payload | payload
+ *   payload: TransactionID | CommitID | uint32 number of records | records
+ *   record: LogRecordType | string table name | ChunkID | ChunkOffset | (inserts only) uint16 value count | values
+ *   value:  DataType | raw value
+ * Strings are prefixed with their uint32 length.
+ */
+struct LogEntry {
+  LogEntry(const TransactionID transaction_id, const CommitID commit_id);
+
+  void add_insert(const std::string& table_name, const RowID row_id, std::vector<AllTypeVariant> values);
+  void add_delete(const std::string& table_name, const RowID row_id);
+
+  // Appends the serialized entry to the buffer
+  void serialize(std::vector<char>& buffer) const;
+
+  /**
+   * Reads the entry starting at offset and advances offset past it. Returns std::nullopt if the entry is incomplete or
+   * its checksum does not match, which happens if the process crashed while the entry was written.
+   */
+  static std::optional<LogEntry> deserialize(const std::vector<char>& buffer, size_t& offset);
+
+  TransactionID transaction_id;
+  CommitID commit_id;
+  std::vector<LogRecord> records;
+};
+
+}  // namespace opossum
@@ -0,0 +1,166 @@
+#include "log_recovery.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "concurrency/transaction_manager.hpp"
+#include "log_entry.hpp"
+#include "resolve_type.hpp"
+#include "storage/chunk.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "storage/value_column.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+#include "utils/filesystem.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+/**
+ * Makes sure that the table has a slot for row_id. Rows are not necessarily logged in the order of their RowIDs, e.g.,
+ * if a transaction that inserted later committed earlier. Slots that are added for rows that are replayed later or
+ * that belong to transactions that never committed are invisible to all transactions.
+ */
+std::shared_ptr<Chunk> get_or_create_row(Table& table, const RowID row_id) {
+  while (table.chunk_count() <= row_id.chunk_id) {
+    table.append_mutable_chunk();
+  }
+
+  const auto chunk = table.get_chunk(row_id.chunk_id);
+  Assert(chunk->is_mutable(), "Cannot recover rows of immutable chunk " + std::to_string(row_id.chunk_id));
+
+  const auto old_size = chunk->size();
+  if (row_id.chunk_offset < old_size) return chunk;
+
+  const auto new_size = row_id.chunk_offset + 1u;
+  for (auto column_id = ColumnID{0}; column_id < chunk->column_count(); ++column_id) {
+    resolve_data_type(table.column_data_type(column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      const auto value_column = std::dynamic_pointer_cast<ValueColumn<ColumnDataType>>(
+          chunk->get_mutable_column(column_id));
+      Assert(value_column, "Recovered rows can only be added to ValueColumns");
+
+      value_column->values().resize(new_size);
+      if (value_column->is_nullable()) value_column->null_values().resize(new_size);
+    });
+  }
+
+  if (chunk->has_mvcc_columns()) {
+    auto mvcc_columns = chunk->mvcc_columns();
+    mvcc_columns->grow_by(new_size - old_size, 0u);
+    for (auto chunk_offset = old_size; chunk_offset < new_size; ++chunk_offset) {
+      mvcc_columns->end_cids[chunk_offset] = 0u;
+    }
+  }
+
+  return chunk;
+}
+
+void replay_insert(Table& table, const LogRecord& record, const CommitID commit_id) {
+  Assert(record.values.size() == table.column_count(), "Logged row does not match table " + record.table_name);
+
+  const auto chunk = get_or_create_row(table, record.row_id);
+  const auto chunk_offset = record.row_id.chunk_offset;
+
+  for (auto column_id = ColumnID{0}; column_id < chunk->column_count(); ++column_id) {
+    resolve_data_type(table.column_data_type(column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      const auto value_column = std::static_pointer_cast<ValueColumn<ColumnDataType>>(
+          chunk->get_mutable_column(column_id));
+
+      const auto& value = record.values[column_id];
+      if (variant_is_null(value)) {
+        Assert(value_column->is_nullable(), "Cannot recover NULL into NOT NULL column");
+        value_column->values()[chunk_offset] = ColumnDataType{};
+        value_column->null_values()[chunk_offset] = true;
+      } else {
+        value_column->values()[chunk_offset] = type_cast<ColumnDataType>(value);
+        if (value_column->is_nullable()) value_column->null_values()[chunk_offset] = false;
+      }
+    });
+  }
+
+  if (chunk->has_mvcc_columns()) {
+    auto mvcc_columns = chunk->mvcc_columns();
+    mvcc_columns->begin_cids[chunk_offset] = commit_id;
+    mvcc_columns->end_cids[chunk_offset] = MvccColumns::MAX_COMMIT_ID;
+    mvcc_columns->tids[chunk_offset] = 0u;
+  }
+}
+
+void replay_delete(Table& table, const LogRecord& record, const CommitID commit_id) {
+  Assert(record.row_id.chunk_id < table.chunk_count() &&
+             record.row_id.chunk_offset < table.get_chunk(record.row_id.chunk_id)->size(),
+         "Logged row to delete does not exist in table " + record.table_name);
+
+  const auto chunk = table.get_chunk(record.row_id.chunk_id);
+  Assert(chunk->has_mvcc_columns(), "Cannot recover deletes without MVCC columns");
+  chunk->mvcc_columns()->end_cids[record.row_id.chunk_offset] = commit_id;
+}
+
+}  // namespace
+
+namespace opossum {
+
+size_t recover_from_log(const std::string& file_path) {
+  if (!filesystem::exists(file_path)) return 0;
+
+  auto file = std::ifstream{file_path, std::ios::binary};
+  Assert(file.is_open(), "Cannot open log file " + file_path);
+  const auto buffer = std::vector<char>{std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+  file.close();
+
+  auto& storage_manager = StorageManager::get();
+  auto& transaction_manager = TransactionManager::get();
+
+  // Transactions that committed before the checkpoint are already part of it
+  const auto checkpoint_commit_id = transaction_manager.last_commit_id();
+  auto last_commit_id = checkpoint_commit_id;
+
+  // The MVCC columns of these chunks are written directly, so their summaries are rebuilt afterwards
+  auto recovered_chunks = std::set<std::shared_ptr<Chunk>>{};
+
+  auto offset = size_t{0};
+  auto num_transactions = size_t{0};
+  while (const auto entry = LogEntry::deserialize(buffer, offset)) {
+    if (entry->commit_id <= checkpoint_commit_id) continue;
+
+    for (const auto& record : entry->records) {
+      Assert(storage_manager.has_table(record.table_name), "Cannot recover unknown table " + record.table_name);
+      auto& table = *storage_manager.get_table(record.table_name);
+
+      switch (record.type) {
+        case LogRecordType::Insert:
+          replay_insert(table, record, entry->commit_id);
+          break;
+        case LogRecordType::Delete:
+          replay_delete(table, record, entry->commit_id);
+          break;
+      }
+      recovered_chunks.emplace(table.get_chunk(record.row_id.chunk_id));
+    }
+    last_commit_id = std::max(last_commit_id, entry->commit_id);
+    ++num_transactions;
+  }
+
+  for (const auto& chunk : recovered_chunks) {
+    if (chunk->has_mvcc_columns()) chunk->mvcc_columns()->update_summary();
+  }
+
+  // New transactions see the recovered rows and continue with the commit ids of the log
+  transaction_manager.set_last_commit_id(last_commit_id);
+
+  // Drop the incomplete entry of a group that was not completely written before the crash
+  if (offset < buffer.size()) filesystem::resize_file(file_path, offset);
+
+  return num_transactions;
+}
+
+}  // namespace opossum
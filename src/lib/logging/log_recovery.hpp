@@ -0,0 +1,25 @@
+#pragma once
+
+#include <string>
+
+namespace opossum {
+
+/**
+ * Replays the redo log written by the Logger into the tables of the StorageManager. Has to be called before the
+ * Logger is enabled and before any transaction is executed, but after a checkpoint was loaded (see
+ * logging/checkpoint.hpp). Only transactions that committed after TransactionManager::last_commit_id(), i.e., after
+ * the checkpoint, are replayed. Afterwards, the TransactionManager continues with the commit ids of the log.
+ *
+ * Since log records identify rows by their RowID, the tables have to be in the state in which they were when the log
+ * was started, e.g., loaded from the same files or from the checkpoint. Recovered rows are placed at their original
+ * RowIDs with their original commit ids. Rows of transactions that did not commit before the crash are left as
+ * invisible gaps, just like rolled back inserts.
+ *
+ * If the process crashed while writing a group, the log ends with an incomplete entry. Those transactions were never
+ * acknowledged, so recovery stops there and truncates the file, so that new entries can be appended.
+ *
+ * @return the number of replayed transactions
+ */
+size_t recover_from_log(const std::string& file_path);
+
+}  // namespace opossum
@@ -0,0 +1,203 @@
+#include "logger.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "log_entry.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+Logger& Logger::get() {
+  static Logger instance;
+  return instance;
+}
+
+void Logger::reset() { get().disable(); }
+
+void Logger::enable(const std::string& file_path, const LoggerOptions& options) {
+  Assert(!is_enabled(), "Logger is already enabled");
+
+  _file_descriptor = ::open(file_path.c_str(), O_WRONLY | O_CREAT | O_APPEND, 0644);
+  Assert(_file_descriptor >= 0, "Cannot open log file " + file_path + ": " + std::strerror(errno));
+
+  _file_path = file_path;
+  _options = options;
+  _shutdown_requested = false;
+  _log_writer_running = true;
+  _error = nullptr;
+  _log_writer = std::thread{&Logger::_write_groups, this};
+  _enabled = true;
+}
+
+void Logger::disable() {
+  if (!is_enabled()) return;
+
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _shutdown_requested = true;
+  }
+  _group_cv.notify_one();
+  _log_writer.join();
+
+  _enabled = false;
+  ::close(_file_descriptor);
+  _file_descriptor = -1;
+}
+
+bool Logger::is_enabled() const { return _enabled; }
+
+void Logger::log_commit(const LogEntry& entry, std::function<void(const std::exception_ptr&)> on_durable) {
+  std::unique_lock<std::mutex> lock(_mutex);
+
+  // The transaction decided to log its commit before the Logger was disabled. It must not be acknowledged now that
+  // nobody writes the entry anymore.
+  if (!_log_writer_running || _error) {
+    const auto error = _error ? _error
+                              : std::make_exception_ptr(std::runtime_error("Logger was disabled before logging"));
+    lock.unlock();
+    on_durable(error);
+    return;
+  }
+
+  const auto starts_group = _group.empty();
+  entry.serialize(_group);
+  _group_callbacks.emplace_back(std::move(on_durable));
+  ++_num_logged_entries;
+
+  // The log writer waits for the first entry of a group and, while the group commit interval runs, for a full group
+  if (starts_group || _group.size() >= _options.max_group_size_bytes) _group_cv.notify_one();
+}
+
+void Logger::flush() {
+  std::unique_lock<std::mutex> lock(_mutex);
+  const auto num_logged_entries = _num_logged_entries;
+  _flush_requested = true;
+  _group_cv.notify_one();
+  _durable_cv.wait(lock, [&]() { return _num_durable_entries >= num_logged_entries; });
+
+  if (_error) std::rethrow_exception(_error);
+}
+
+void Logger::truncate(const CommitID commit_id) {
+  Assert(is_enabled(), "Logger is not enabled");
+
+  std::lock_guard<std::mutex> file_lock(_file_mutex);
+
+  auto log_file = std::ifstream{_file_path, std::ios::binary};
+  Assert(log_file.is_open(), "Cannot open log file " + _file_path);
+  const auto log = std::vector<char>{std::istreambuf_iterator<char>{log_file}, std::istreambuf_iterator<char>{}};
+  log_file.close();
+
+  // Entries are copied as they are, without serializing them again
+  auto truncated_log = std::vector<char>{};
+  auto offset = size_t{0};
+  auto entry_begin = offset;
+  while (const auto entry = LogEntry::deserialize(log, offset)) {
+    if (entry->commit_id > commit_id) {
+      truncated_log.insert(truncated_log.end(), log.begin() + entry_begin, log.begin() + offset);
+    }
+    entry_begin = offset;
+  }
+
+  // The truncated log replaces the old one atomically, so that a crash leaves either of them
+  const auto truncated_file_path = _file_path + ".truncated";
+  const auto truncated_file_descriptor = ::open(truncated_file_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  Assert(truncated_file_descriptor >= 0, "Cannot create log file " + truncated_file_path + ": " + std::strerror(errno));
+  ::close(_file_descriptor);
+  _file_descriptor = truncated_file_descriptor;
+
+  _write_group(truncated_log);
+  _sync();
+  Assert(std::rename(truncated_file_path.c_str(), _file_path.c_str()) == 0,
+         std::string{"Cannot replace log file: "} + std::strerror(errno));
+
+  ::close(_file_descriptor);
+  _file_descriptor = ::open(_file_path.c_str(), O_WRONLY | O_APPEND);
+  Assert(_file_descriptor >= 0, "Cannot open log file " + _file_path + ": " + std::strerror(errno));
+}
+
+size_t Logger::num_group_commits() const { return _num_group_commits; }
+
+void Logger::_write_groups() {
+  std::unique_lock<std::mutex> lock(_mutex);
+
+  while (true) {
+    _group_cv.wait(lock, [&]() { return _shutdown_requested || !_group.empty(); });
+    if (_group.empty()) {
+      // Entries that are passed to log_commit() from now on are rejected
+      _log_writer_running = false;
+      break;
+    }
+
+    // Give concurrently committing transactions the chance to join the group
+    _group_cv.wait_for(lock, _options.group_commit_interval, [&]() {
+      return _shutdown_requested || _flush_requested || _group.size() >= _options.max_group_size_bytes;
+    });
+    _flush_requested = false;
+
+    auto group = std::vector<char>{};
+    auto group_callbacks = std::vector<std::function<void(const std::exception_ptr&)>>{};
+    group.swap(_group);
+    group_callbacks.swap(_group_callbacks);
+    const auto num_logged_entries = _num_logged_entries;
+    auto error = _error;
+
+    lock.unlock();
+
+    // Groups that were collected before a previous group failed are not written either
+    if (!error) {
+      try {
+        std::lock_guard<std::mutex> file_lock(_file_mutex);
+        _write_group(group);
+        if (_options.sync_policy == LogSyncPolicy::FSync) _sync();
+      } catch (const std::exception&) {
+        error = std::current_exception();
+      }
+    }
+
+    if (error) {
+      // log_commit() rejects entries from now on, before the transactions of this group learn about the error
+      lock.lock();
+      _error = error;
+      lock.unlock();
+    }
+
+    for (const auto& callback : group_callbacks) {
+      callback(error);
+    }
+
+    lock.lock();
+    _num_durable_entries = num_logged_entries;
+    ++_num_group_commits;
+    _durable_cv.notify_all();
+  }
+}
+
+void Logger::_write_group(const std::vector<char>& group) {
+  auto num_written_bytes = size_t{0};
+  while (num_written_bytes < group.size()) {
+    const auto result = ::write(_file_descriptor, group.data() + num_written_bytes, group.size() - num_written_bytes);
+    if (result < 0 && errno == EINTR) continue;
+    if (result < 0) throw std::runtime_error(std::string{"Cannot write to log file: "} + std::strerror(errno));
+    num_written_bytes += static_cast<size_t>(result);
+  }
+}
+
+void Logger::_sync() {
+  if (::fsync(_file_descriptor) != 0) {
+    throw std::runtime_error(std::string{"Cannot sync log file: "} + std::strerror(errno));
+  }
+}
+
+}  // namespace opossum
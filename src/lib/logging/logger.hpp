@@ -0,0 +1,121 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+struct LogEntry;
+
+enum class LogSyncPolicy {
+  None,  // Groups are only handed to the OS. Survives crashes of the process, but not of the machine.
+  FSync  // Every group is synced to disk before its transactions are acknowledged
+};
+
+struct LoggerOptions {
+  // How long the log writer waits for further transactions to join a group before writing it
+  std::chrono::microseconds group_commit_interval{1'000};
+
+  // A group is written early once it reaches this size
+  size_t max_group_size_bytes{1'000'000};
+
+  LogSyncPolicy sync_policy{LogSyncPolicy::FSync};
+};
+
+/**
+ * Write-ahead redo log for committed transactions. Disabled by default, in which case commits are not persisted at
+ * all.
+ *
+ * When a transaction commits, its read/write operators add their modified rows to a LogEntry that is handed to
+ * log_commit(). A dedicated log writer thread collects the entries of concurrently committing transactions into a
+ * group and writes (and, depending on the LogSyncPolicy, syncs) the whole group at once, so that the cost of a sync is
+ * shared by all transactions of the group (group commit). Only afterwards, the transactions become visible to others
+ * and their commit is acknowledged. Thus, no transaction can read data that might get lost.
+ *
+ * If the log cannot be written or synced, the transactions of the group are rolled back and their commit fails. The log
+ * might end with a partially written group afterwards, which would hide all later groups from recovery. Thus, all
+ * further commits fail as well until the Logger is enabled again.
+ *
+ * The log is replayed on startup by recover_from_log() (see logging/log_recovery.hpp). Checkpoints allow to truncate
+ * it, so that only transactions that committed after the last checkpoint need to be replayed.
+ */
+class Logger : private Noncopyable {
+ public:
+  static Logger& get();
+
+  // Disables the Logger, used for tests
+  static void reset();
+
+  // Starts appending to the log file at file_path. The file is created if it does not exist.
+  void enable(const std::string& file_path, const LoggerOptions& options = {});
+
+  // Writes all pending entries and stops the log writer
+  void disable();
+
+  bool is_enabled() const;
+
+  /**
+   * Adds the entry to the current group. on_durable is called by the log writer once the group has been written, with
+   * nullptr on success. If the group could not be written, or if the Logger has been disabled in the meantime, it is
+   * called with the error instead, and the commit must not be acknowledged.
+   */
+  void log_commit(const LogEntry& entry, std::function<void(const std::exception_ptr&)> on_durable);
+
+  // Blocks until all entries passed to log_commit() so far are durable. Throws if the log could not be written.
+  void flush();
+
+  /**
+   * Removes the entries of all transactions that committed at or before commit_id from the log, e.g., because they are
+   * part of a checkpoint (see logging/checkpoint.hpp). Transactions can continue to commit in the meantime.
+   */
+  void truncate(const CommitID commit_id);
+
+  size_t num_group_commits() const;
+
+ private:
+  Logger() = default;
+
+  void _write_groups();
+  void _write_group(const std::vector<char>& group);
+  void _sync();
+
+  std::atomic_bool _enabled{false};
+  LoggerOptions _options;
+  std::string _file_path;
+  std::thread _log_writer;
+
+  // Protects the log file, which is replaced when the log is truncated
+  std::mutex _file_mutex;
+  int _file_descriptor{-1};
+
+  std::mutex _mutex;
+  std::condition_variable _group_cv;
+  std::condition_variable _durable_cv;
+  bool _shutdown_requested{false};
+  bool _flush_requested{false};
+
+  // Entries are only accepted while the log writer runs, it writes all of them before it stops
+  bool _log_writer_running{false};
+
+  // Set once the log could not be written, all further commits fail with it
+  std::exception_ptr _error;
+
+  // The group that is currently collected
+  std::vector<char> _group;
+  std::vector<std::function<void(const std::exception_ptr&)>> _group_callbacks;
+
+  uint64_t _num_logged_entries{0};
+  uint64_t _num_durable_entries{0};
+  std::atomic<size_t> _num_group_commits{0};
+};
+
+}  // namespace opossum
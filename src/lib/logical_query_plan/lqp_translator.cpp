@@ -1,5 +1,6 @@
 #include "lqp_translator.hpp"
 
+#include <algorithm>
 #include <iostream>
 #include <memory>
 #include <string>
@@ -34,6 +35,7 @@
 #include "operators/sort.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "operators/top_n.hpp"
 #include "operators/union_positions.hpp"
 #include "operators/update.hpp"
 #include "operators/validate.hpp"
@@ -48,8 +50,102 @@
 #include "utils/performance_warning.hpp"
 #include "validate_node.hpp"
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Only read-only nodes whose shallow_equals() fully describes their operator may be shared between subplans
+bool is_shareable_node(const AbstractLQPNode& node) {
+  switch (node.type()) {
+    case LQPNodeType::Aggregate:
+    case LQPNodeType::DummyTable:
+    case LQPNodeType::Limit:
+    case LQPNodeType::Predicate:
+    case LQPNodeType::Sort:
+    case LQPNodeType::StoredTable:
+    case LQPNodeType::Union:
+    case LQPNodeType::Validate:
+      return true;
+
+    case LQPNodeType::Join: {
+      const auto join_mode = static_cast<const JoinNode&>(node).join_mode();
+      return join_mode != JoinMode::Semi && join_mode != JoinMode::Anti;
+    }
+
+    case LQPNodeType::Projection: {
+      const auto& column_expressions = static_cast<const ProjectionNode&>(node).column_expressions();
+      return std::none_of(column_expressions.begin(), column_expressions.end(),
+                          [](const auto& column_expression) { return column_expression->is_subselect(); });
+    }
+
+    default:
+      return false;
+  }
+}
+
+bool have_identical_values(const std::shared_ptr<const LQPExpression>& lhs,
+                           const std::shared_ptr<const LQPExpression>& rhs) {
+  if (!lhs || !rhs) return !lhs && !rhs;
+  if (lhs->type() != rhs->type()) return false;
+
+  if (lhs->type() == ExpressionType::Literal && !(lhs->value() == rhs->value())) return false;
+  if (lhs->type() == ExpressionType::Placeholder && !(lhs->value_placeholder() == rhs->value_placeholder())) {
+    return false;
+  }
+
+  const auto& lhs_arguments = lhs->aggregate_function_arguments();
+  const auto& rhs_arguments = rhs->aggregate_function_arguments();
+  if (lhs_arguments.size() != rhs_arguments.size()) return false;
+  for (auto argument_idx = size_t{0}; argument_idx < lhs_arguments.size(); ++argument_idx) {
+    if (!have_identical_values(lhs_arguments[argument_idx], rhs_arguments[argument_idx])) return false;
+  }
+
+  return have_identical_values(lhs->left_child(), rhs->left_child()) &&
+         have_identical_values(lhs->right_child(), rhs->right_child());
+}
+
+bool have_identical_values(const std::vector<std::shared_ptr<LQPExpression>>& lhs,
+                           const std::vector<std::shared_ptr<LQPExpression>>& rhs) {
+  if (lhs.size() != rhs.size()) return false;
+  for (auto expression_idx = size_t{0}; expression_idx < lhs.size(); ++expression_idx) {
+    if (!have_identical_values(lhs[expression_idx], rhs[expression_idx])) return false;
+  }
+  return true;
+}
+
+/**
+ * shallow_equals() is meant to compare plans: PredicateNodes compare floating point values with a tolerance, and
+ * expressions consider any two literals or placeholders equal. Two nodes can only share an operator if their values
+ * are identical.
+ */
+bool have_identical_values(const AbstractLQPNode& lhs, const AbstractLQPNode& rhs) {
+  switch (lhs.type()) {
+    case LQPNodeType::Predicate: {
+      const auto& lhs_predicate = static_cast<const PredicateNode&>(lhs);
+      const auto& rhs_predicate = static_cast<const PredicateNode&>(rhs);
+      return lhs_predicate.value() == rhs_predicate.value() && lhs_predicate.value2() == rhs_predicate.value2();
+    }
+
+    case LQPNodeType::Projection:
+      return have_identical_values(static_cast<const ProjectionNode&>(lhs).column_expressions(),
+                                   static_cast<const ProjectionNode&>(rhs).column_expressions());
+
+    case LQPNodeType::Aggregate:
+      return have_identical_values(static_cast<const AggregateNode&>(lhs).aggregate_expressions(),
+                                   static_cast<const AggregateNode&>(rhs).aggregate_expressions());
+
+    default:
+      return true;
+  }
+}
+
+}  // namespace
+
 namespace opossum {
 
+LQPTranslator::LQPTranslator(const std::optional<size_t>& sort_memory_budget)
+    : _sort_memory_budget(sort_memory_budget) {}
+
 std::shared_ptr<AbstractOperator> LQPTranslator::translate_node(const std::shared_ptr<AbstractLQPNode>& node) const {
   /**
    * Translate a node (i.e. call `_translate_by_node_type`) only if it hasn't been translated before, otherwise just
@@ -75,6 +171,38 @@ std::shared_ptr<AbstractOperator> LQPTranslator::translate_node(const std::share
   }
 
   const auto pqp = _translate_by_node_type(node->type(), node);
+
+  /**
+   * Different LQP nodes might still describe the same subplan, e.g., when a query reads the same table in a subselect
+   * and in its outer query. Such common subexpressions are translated into a single operator, so that they are only
+   * executed once. Since the inputs were translated first, two nodes are equivalent if they are equal themselves and
+   * their inputs were translated into the same operators.
+   */
+  if (is_shareable_node(*node)) {
+    const auto input_operator = [&](const std::shared_ptr<AbstractLQPNode>& input) {
+      if (!input) return std::shared_ptr<AbstractOperator>{};
+      const auto input_iter = _operator_by_lqp_node.find(input);
+      return input_iter != _operator_by_lqp_node.end() ? input_iter->second : nullptr;
+    };
+
+    const auto left_input_operator = input_operator(node->left_input());
+    const auto right_input_operator = input_operator(node->right_input());
+
+    // Inputs that were not translated themselves (e.g., a Sort that became part of a TopN) cannot be compared
+    if (static_cast<bool>(node->left_input()) == static_cast<bool>(left_input_operator) &&
+        static_cast<bool>(node->right_input()) == static_cast<bool>(right_input_operator)) {
+      for (const auto& [translated_node, translated_operator] : _operator_by_lqp_node) {
+        if (translated_node->type() != node->type() || translated_operator->type() != pqp->type()) continue;
+        if (input_operator(translated_node->left_input()) != left_input_operator) continue;
+        if (input_operator(translated_node->right_input()) != right_input_operator) continue;
+        if (!translated_node->shallow_equals(*node) || !have_identical_values(*translated_node, *node)) continue;
+
+        _operator_by_lqp_node.emplace(node, translated_operator);
+        return translated_operator;
+      }
+    }
+  }
+
   _operator_by_lqp_node.emplace(node, pqp);
   return pqp;
 }
@@ -204,7 +332,7 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_sort_node(
   for (auto it = definitions.rbegin(); it != definitions.rend(); it++) {
     const auto& definition = *it;
     result_operator = std::make_shared<Sort>(input_operator, node->get_output_column_id(definition.column_reference),
-                                             definition.order_by_mode);
+                                             definition.order_by_mode, Chunk::MAX_SIZE, _sort_memory_budget);
     input_operator = result_operator;
   }
 
@@ -344,8 +472,23 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_aggregate_node(
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_limit_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
-  const auto input_operator = translate_node(node->left_input());
   auto limit_node = std::dynamic_pointer_cast<LimitNode>(node);
+
+  /**
+   * A Limit on top of a Sort by a single column is executed as a TopN, which does not need to sort the entire input.
+   * This is only possible if the sorted result is not needed by any other node. Multi-column ORDER BYs are translated
+   * into a chain of stable Sorts (see _translate_sort_node()), which cannot be combined with a Limit.
+   */
+  const auto sort_node = std::dynamic_pointer_cast<SortNode>(node->left_input());
+  if (sort_node && sort_node->order_by_definitions().size() == 1 && sort_node->output_count() == 1 &&
+      !_operator_by_lqp_node.count(sort_node)) {
+    const auto& definition = sort_node->order_by_definitions().front();
+    const auto input_operator = translate_node(sort_node->left_input());
+    return std::make_shared<TopN>(input_operator, sort_node->get_output_column_id(definition.column_reference),
+                                  definition.order_by_mode, limit_node->num_rows());
+  }
+
+  const auto input_operator = translate_node(node->left_input());
   return std::make_shared<Limit>(input_operator, limit_node->num_rows());
 }
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <unordered_map>
 
 #include "abstract_lqp_node.hpp"
@@ -21,6 +22,12 @@ class PQPExpression;
  */
 class LQPTranslator : private Noncopyable {
  public:
+  /**
+   * @param sort_memory_budget  is passed on to all Sort operators, which spill sorted runs to disk once their
+   *                            materialized sort column exceeds it (see Sort)
+   */
+  explicit LQPTranslator(const std::optional<size_t>& sort_memory_budget = std::nullopt);
+
   virtual std::shared_ptr<AbstractOperator> translate_node(const std::shared_ptr<AbstractLQPNode>& node) const;
 
   virtual ~LQPTranslator() = default;
@@ -62,6 +69,8 @@ class LQPTranslator : private Noncopyable {
   // Cache operator subtrees by LQP node to avoid executing operators below a diamond shape multiple times
   mutable std::unordered_map<std::shared_ptr<const AbstractLQPNode>, std::shared_ptr<AbstractOperator>>
       _operator_by_lqp_node;
+
+  const std::optional<size_t> _sort_memory_budget;
 };
 
 }  // namespace opossum
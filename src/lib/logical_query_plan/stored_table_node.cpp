@@ -60,7 +60,8 @@ bool StoredTableNode::shallow_equals(const AbstractLQPNode& rhs) const {
   Assert(rhs.type() == type(), "Can only compare nodes of the same type()");
   const auto& stored_table_node = static_cast<const StoredTableNode&>(rhs);
 
-  return _table_name == stored_table_node._table_name;
+  return _table_name == stored_table_node._table_name &&
+         _excluded_chunk_ids == stored_table_node._excluded_chunk_ids;
 }
 
 void StoredTableNode::_on_input_changed() { Fail("StoredTableNode cannot have inputs."); }
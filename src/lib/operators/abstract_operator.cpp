@@ -7,6 +7,7 @@
 
 #include "abstract_read_only_operator.hpp"
 #include "concurrency/transaction_context.hpp"
+#include "scheduler/cancellation_token.hpp"
 #include "storage/table.hpp"
 #include "utils/assert.hpp"
 #include "utils/format_duration.hpp"
@@ -22,6 +23,9 @@ AbstractOperator::AbstractOperator(const OperatorType type, const std::shared_pt
 OperatorType AbstractOperator::type() const { return _type; }
 
 void AbstractOperator::execute() {
+  // The output of a cancelled query is discarded anyway. The inputs might not have been executed in that case.
+  if (_is_cancelled()) return;
+
   DebugAssert(!_input_left || _input_left->get_output(), "Left input has not yet been executed");
   DebugAssert(!_input_right || _input_right->get_output(), "Right input has not yet been executed");
   DebugAssert(!_output, "Operator has already been executed");
@@ -98,8 +102,30 @@ void AbstractOperator::set_transaction_context_recursively(std::weak_ptr<Transac
 
   if (_input_left != nullptr) mutable_input_left()->set_transaction_context_recursively(transaction_context);
   if (_input_right != nullptr) mutable_input_right()->set_transaction_context_recursively(transaction_context);
+  for (const auto& subselect_operator : subselect_operators()) {
+    subselect_operator->set_transaction_context_recursively(transaction_context);
+  }
+}
+
+std::shared_ptr<const CancellationToken> AbstractOperator::cancellation_token() const { return _cancellation_token; }
+
+void AbstractOperator::set_cancellation_token(const std::shared_ptr<const CancellationToken>& cancellation_token) {
+  _cancellation_token = cancellation_token;
 }
 
+void AbstractOperator::set_cancellation_token_recursively(
+    const std::shared_ptr<const CancellationToken>& cancellation_token) {
+  set_cancellation_token(cancellation_token);
+
+  if (_input_left != nullptr) mutable_input_left()->set_cancellation_token_recursively(cancellation_token);
+  if (_input_right != nullptr) mutable_input_right()->set_cancellation_token_recursively(cancellation_token);
+  for (const auto& subselect_operator : subselect_operators()) {
+    subselect_operator->set_cancellation_token_recursively(cancellation_token);
+  }
+}
+
+bool AbstractOperator::_is_cancelled() const { return _cancellation_token && _cancellation_token->is_cancelled(); }
+
 std::shared_ptr<AbstractOperator> AbstractOperator::mutable_input_left() const {
   return std::const_pointer_cast<AbstractOperator>(_input_left);
 }
@@ -108,6 +134,8 @@ std::shared_ptr<AbstractOperator> AbstractOperator::mutable_input_right() const
   return std::const_pointer_cast<AbstractOperator>(_input_right);
 }
 
+std::vector<std::shared_ptr<AbstractOperator>> AbstractOperator::subselect_operators() const { return {}; }
+
 const BaseOperatorPerformanceData& AbstractOperator::base_performance_data() const { return _base_performance_data; }
 
 std::shared_ptr<const AbstractOperator> AbstractOperator::input_left() const { return _input_left; }
@@ -141,8 +169,25 @@ void AbstractOperator::print(std::ostream& stream) const {
   print_directed_acyclic_graph<const AbstractOperator>(shared_from_this(), get_children_fn, node_print_fn, stream);
 }
 
+bool AbstractOperator::is_pipelineable() const { return false; }
+
+bool AbstractOperator::pipeline_outputs_data_columns() const { return false; }
+
 void AbstractOperator::_on_cleanup() {}
 
+std::shared_ptr<Table> AbstractOperator::_on_pipeline_begin(const std::shared_ptr<const Table>& input_table) {
+  Fail("Operator " + name() + " does not support pipelined execution.");
+}
+
+ChunkColumns AbstractOperator::_on_execute_chunk(const std::shared_ptr<const Table>& input_table,
+                                                 const ChunkID chunk_id) {
+  Fail("Operator " + name() + " does not support pipelined execution.");
+}
+
+bool AbstractOperator::_pipeline_requires_order() const { return false; }
+
+bool AbstractOperator::_pipeline_is_exhausted() const { return false; }
+
 std::shared_ptr<AbstractOperator> AbstractOperator::_recreate_impl(
     std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& recreated_ops,
     const std::vector<AllParameterVariant>& args) const {
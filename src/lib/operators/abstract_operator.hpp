@@ -7,16 +7,20 @@
 
 #include "all_parameter_variant.hpp"
 #include "base_operator_performance_data.hpp"
+#include "storage/chunk.hpp"
 #include "types.hpp"
 
 namespace opossum {
 
+class CancellationToken;
+class OperatorPipeline;
 class OperatorTask;
 class Table;
 class TransactionContext;
 
 enum class OperatorType {
   Aggregate,
+  CompactChunks,
   Delete,
   Difference,
   ExportBinary,
@@ -38,6 +42,7 @@ enum class OperatorType {
   Sort,
   TableScan,
   TableWrapper,
+  TopN,
   UnionAll,
   UnionPositions,
   Update,
@@ -88,9 +93,16 @@ class AbstractOperator : public std::enable_shared_from_this<AbstractOperator>,
   std::shared_ptr<TransactionContext> transaction_context() const;
   void set_transaction_context(std::weak_ptr<TransactionContext> transaction_context);
 
-  // Calls set_transaction_context on itself and both input operators recursively
+  // Calls set_transaction_context on itself, both input operators and all subselect operators recursively
   void set_transaction_context_recursively(std::weak_ptr<TransactionContext> transaction_context);
 
+  // Operators stop early once the token is cancelled, their output is incomplete then. nullptr if not cancellable.
+  std::shared_ptr<const CancellationToken> cancellation_token() const;
+  void set_cancellation_token(const std::shared_ptr<const CancellationToken>& cancellation_token);
+
+  // Calls set_cancellation_token on itself, both input operators and all subselect operators recursively
+  void set_cancellation_token_recursively(const std::shared_ptr<const CancellationToken>& cancellation_token);
+
   // Returns a new instance of the same operator with the same configuration.
   // The given arguments are used to replace the ValuePlaceholder objects within the new operator, if applicable.
   // Recursively recreates the input operators and passes the argument list along.
@@ -106,6 +118,10 @@ class AbstractOperator : public std::enable_shared_from_this<AbstractOperator>,
   std::shared_ptr<AbstractOperator> mutable_input_left() const;
   std::shared_ptr<AbstractOperator> mutable_input_right() const;
 
+  // Roots of the subselect plans that have to be executed before this operator. Scheduled as predecessors of this
+  // operator by OperatorTask::make_tasks_from_operator(), so that they run concurrently with its inputs.
+  virtual std::vector<std::shared_ptr<AbstractOperator>> subselect_operators() const;
+
   // Return the output tables of the inputs
   std::shared_ptr<const Table> input_table_left() const;
   std::shared_ptr<const Table> input_table_right() const;
@@ -116,7 +132,18 @@ class AbstractOperator : public std::enable_shared_from_this<AbstractOperator>,
 
   void print(std::ostream& stream = std::cout) const;
 
+  // Returns true if the operator can process its (left) input chunk by chunk, without ever seeing the entire input
+  // table. Chains of such operators can be fused into an OperatorPipeline. See operators/operator_pipeline.hpp.
+  virtual bool is_pipelineable() const;
+
+  // Returns true if the operator may create data columns when it is pipelined. Within a pipeline, every output chunk
+  // is wrapped in a table of its own, so a later operator would reference a different table in every output chunk.
+  // Thus, such an operator can only be the last operator of a pipeline.
+  virtual bool pipeline_outputs_data_columns() const;
+
  protected:
+  friend class OperatorPipeline;
+
   // abstract method to actually execute the operator
   // execute and get_output are split into two methods to allow for easier
   // asynchronous execution
@@ -127,6 +154,25 @@ class AbstractOperator : public std::enable_shared_from_this<AbstractOperator>,
   // clean up after execution (if it makes sense)
   virtual void _on_cleanup();
 
+  /**
+   * @defgroup Pipelined execution, only called for operators that are pipelineable
+   * _on_pipeline_begin() is called once before any chunk is pushed into the operator. It gets a table with the column
+   * definitions and type of the input (which might not contain any chunks) and returns the still empty output table.
+   * Afterwards, _on_execute_chunk() is called for chunks of the input (the morsels) and returns the columns of the
+   * corresponding output chunk or no columns at all if the chunk does not contain any qualifying rows. It might be
+   * called concurrently for different morsels, unless _pipeline_requires_order() is true. In that case, the morsels
+   * are pushed in the order of the input table until _pipeline_is_exhausted() returns true.
+   * @{
+   */
+  virtual std::shared_ptr<Table> _on_pipeline_begin(const std::shared_ptr<const Table>& input_table);
+  virtual ChunkColumns _on_execute_chunk(const std::shared_ptr<const Table>& input_table, const ChunkID chunk_id);
+  virtual bool _pipeline_requires_order() const;
+  virtual bool _pipeline_is_exhausted() const;
+  /**@}*/
+
+  // To be checked by operators before processing the next chunk, partition, etc.
+  bool _is_cancelled() const;
+
   void _print_impl(std::ostream& out, std::vector<bool>& levels,
                    std::unordered_map<const AbstractOperator*, size_t>& id_by_operator, size_t& id_counter) const;
 
@@ -151,6 +197,8 @@ class AbstractOperator : public std::enable_shared_from_this<AbstractOperator>,
   // Weak pointer breaks cyclical dependency between operators and context
   std::optional<std::weak_ptr<TransactionContext>> _transaction_context;
 
+  std::shared_ptr<const CancellationToken> _cancellation_token;
+
   BaseOperatorPerformanceData _base_performance_data;
 
   std::weak_ptr<OperatorTask> _operator_task;
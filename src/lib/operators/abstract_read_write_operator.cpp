@@ -51,6 +51,13 @@ void AbstractReadWriteOperator::rollback_records() {
   _state = ReadWriteOperatorState::RolledBack;
 }
 
+void AbstractReadWriteOperator::log_records(LogEntry& log_entry) const {
+  // Records are logged before they are committed, see TransactionContext::_commit_records()
+  Assert(_state == ReadWriteOperatorState::Executed, "Operator needs to have state Executed in order to be logged.");
+
+  _on_log_records(log_entry);
+}
+
 bool AbstractReadWriteOperator::execute_failed() const {
   return _state == ReadWriteOperatorState::Failed || _state == ReadWriteOperatorState::RolledBack;
 }
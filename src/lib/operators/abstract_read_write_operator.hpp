@@ -13,6 +13,8 @@
 
 namespace opossum {
 
+struct LogEntry;
+
 enum class ReadWriteOperatorState {
   Pending,     // The operator has been instantiated.
   Executed,    // Execution succeeded.
@@ -46,6 +48,12 @@ class AbstractReadWriteOperator : public AbstractOperator {
    */
   void rollback_records();
 
+  /**
+   * Adds the modifications to the redo log entry of the transaction (see logging/logger.hpp). Called before
+   * commit_records.
+   */
+  void log_records(LogEntry& log_entry) const;
+
   /**
    * Returns true if a previous call to _on_execute produced an error.
    */
@@ -84,6 +92,12 @@ class AbstractReadWriteOperator : public AbstractOperator {
    */
   virtual void _on_rollback_records() = 0;
 
+  /**
+   * Called by log_records. Operators that only consist of other read/write operators, which log their records
+   * themselves, do not need to override this.
+   */
+  virtual void _on_log_records(LogEntry& log_entry) const {}
+
   /**
    * This method is used in sub classes in their _on_execute() method.
    *
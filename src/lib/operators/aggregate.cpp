@@ -366,6 +366,8 @@ std::shared_ptr<const Table> Aggregate::_on_execute() {
 
   for (ChunkID chunk_id{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
     jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id, this]() {
+      if (_is_cancelled()) return;
+
       auto chunk_in = input_table->get_chunk(chunk_id);
 
       auto hash_keys = std::make_shared<std::vector<AggregateKey>>(chunk_in->size());
@@ -394,11 +396,14 @@ std::shared_ptr<const Table> Aggregate::_on_execute() {
 
       _keys_per_chunk[chunk_id] = hash_keys;
     }));
-    jobs.back()->schedule();
+    jobs.back()->schedule(input_table->get_chunk(chunk_id)->numa_node_id());
   }
 
   CurrentScheduler::wait_for_tasks(jobs);
 
+  // The group keys of some chunks are missing. The output of a cancelled query is discarded anyway.
+  if (_is_cancelled()) return nullptr;
+
   /*
   AGGREGATION PHASE
   */
@@ -442,6 +447,8 @@ std::shared_ptr<const Table> Aggregate::_on_execute() {
 
   // Process Chunks and perform aggregations
   for (ChunkID chunk_id{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
+    if (_is_cancelled()) return nullptr;
+
     auto chunk_in = input_table->get_chunk(chunk_id);
 
     auto hash_keys = _keys_per_chunk[chunk_id];
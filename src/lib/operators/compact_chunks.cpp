@@ -0,0 +1,247 @@
+#include "compact_chunks.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "concurrency/transaction_context.hpp"
+#include "logging/log_entry.hpp"
+#include "resolve_type.hpp"
+#include "storage/base_encoded_column.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/materialize.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/value_column.hpp"
+#include "storage/vector_compression/compressed_vector_type.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+ColumnEncodingSpec encoding_spec_of_column(const std::shared_ptr<const BaseColumn>& column) {
+  const auto encoded_column = std::dynamic_pointer_cast<const BaseEncodedColumn>(column);
+  if (!encoded_column) return ColumnEncodingSpec{EncodingType::Unencoded};
+
+  switch (encoded_column->compressed_vector_type()) {
+    case CompressedVectorType::FixedSize4ByteAligned:
+    case CompressedVectorType::FixedSize2ByteAligned:
+    case CompressedVectorType::FixedSize1ByteAligned:
+      return ColumnEncodingSpec{encoded_column->encoding_type(), VectorCompressionType::FixedSizeByteAligned};
+    case CompressedVectorType::SimdBp128:
+      return ColumnEncodingSpec{encoded_column->encoding_type(), VectorCompressionType::SimdBp128};
+    case CompressedVectorType::Invalid:
+      return ColumnEncodingSpec{encoded_column->encoding_type()};
+  }
+  Fail("Unknown compressed vector type");
+}
+
+}  // namespace
+
+namespace opossum {
+
+CompactChunks::CompactChunks(const std::string& table_name, const std::vector<ChunkID>& chunk_ids)
+    : AbstractReadWriteOperator{OperatorType::CompactChunks}, _table_name{table_name}, _chunk_ids{chunk_ids} {}
+
+const std::string CompactChunks::name() const { return "CompactChunks"; }
+
+ChunkID CompactChunks::compacted_chunk_id() const { return _compacted_chunk_id; }
+
+std::shared_ptr<const Table> CompactChunks::_on_execute(std::shared_ptr<TransactionContext> context) {
+  DebugAssert(!_chunk_ids.empty(), "No chunks to compact");
+
+  context->register_read_write_operator(std::static_pointer_cast<AbstractReadWriteOperator>(shared_from_this()));
+
+  _table = StorageManager::get().get_table(_table_name);
+  _transaction_id = context->transaction_id();
+  const auto snapshot_commit_id = context->snapshot_commit_id();
+
+  Assert(_table->has_mvcc() == UseMvcc::Yes, "Only tables with MVCC columns can be compacted");
+
+  // Lock the visible rows like Delete does. Rows that are invisible to this transaction stay where they are.
+  for (const auto chunk_id : _chunk_ids) {
+    const auto chunk = _table->get_chunk(chunk_id);
+    auto mvcc_columns = chunk->mvcc_columns();
+
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk->size(); ++chunk_offset) {
+      const auto is_visible = mvcc_columns->begin_cids[chunk_offset] <= snapshot_commit_id &&
+                              snapshot_commit_id < mvcc_columns->end_cids[chunk_offset];
+      if (!is_visible) continue;
+
+      mvcc_columns->add_uncommitted_rows(1u);
+
+      auto expected = 0u;
+      const auto success = mvcc_columns->tids[chunk_offset].compare_exchange_strong(expected, _transaction_id);
+
+      // The row has been deleted or updated concurrently and the transaction needs to be rolled back
+      if (!success) {
+        mvcc_columns->remove_uncommitted_rows(1u);
+        _mark_as_failed();
+        return nullptr;
+      }
+
+      _moved_rows.emplace_back(RowID{chunk_id, chunk_offset});
+    }
+  }
+
+  if (_moved_rows.empty()) return nullptr;
+
+  Assert(_moved_rows.size() <= _table->max_chunk_size(), "Compacted rows do not fit into a single chunk");
+
+  const auto compacted_chunk = _create_compacted_chunk();
+  {
+    auto scoped_lock = _table->acquire_append_mutex();
+    _table->append_chunk(compacted_chunk);
+    _compacted_chunk_id = static_cast<ChunkID>(_table->chunk_count() - 1);
+  }
+
+  return nullptr;
+}
+
+std::shared_ptr<Chunk> CompactChunks::_create_compacted_chunk() const {
+  const auto first_chunk = _table->get_chunk(_chunk_ids.front());
+  const auto row_count = _moved_rows.size();
+
+  // Materialize the moved rows into ValueColumns
+  auto columns = ChunkColumns{};
+  auto encoding_spec = ChunkEncodingSpec{};
+  for (auto column_id = ColumnID{0}; column_id < _table->column_count(); ++column_id) {
+    resolve_data_type(_table->column_data_type(column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      const auto is_nullable = _table->column_is_nullable(column_id);
+      auto values = pmr_concurrent_vector<ColumnDataType>(row_count);
+      auto null_values = pmr_concurrent_vector<bool>(is_nullable ? row_count : 0u);
+
+      auto source_values_and_nulls = std::vector<std::pair<bool, ColumnDataType>>{};
+      auto source_chunk_id = INVALID_CHUNK_ID;
+      for (auto row_idx = size_t{0}; row_idx < row_count; ++row_idx) {
+        const auto& row_id = _moved_rows[row_idx];
+
+        // The moved rows are ordered by chunk, so each column of the old chunks is only materialized once
+        if (row_id.chunk_id != source_chunk_id) {
+          source_chunk_id = row_id.chunk_id;
+          source_values_and_nulls.clear();
+          materialize_values_and_nulls(*_table->get_chunk(source_chunk_id)->get_column(column_id),
+                                       source_values_and_nulls);
+        }
+
+        const auto& [is_null, value] = source_values_and_nulls[row_id.chunk_offset];
+        values[row_idx] = value;
+        if (is_nullable) null_values[row_idx] = is_null;
+      }
+
+      if (is_nullable) {
+        columns.push_back(std::make_shared<ValueColumn<ColumnDataType>>(std::move(values), std::move(null_values)));
+      } else {
+        columns.push_back(std::make_shared<ValueColumn<ColumnDataType>>(std::move(values)));
+      }
+    });
+
+    encoding_spec.emplace_back(encoding_spec_of_column(first_chunk->get_column(column_id)));
+  }
+
+  // The rows become visible when the transaction commits
+  auto mvcc_columns = std::make_shared<MvccColumns>(row_count);
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+    mvcc_columns->tids[chunk_offset] = _transaction_id;
+    mvcc_columns->begin_cids[chunk_offset] = MvccColumns::MAX_COMMIT_ID;
+  }
+  mvcc_columns->add_uncommitted_rows(row_count);
+
+  const auto chunk = std::make_shared<Chunk>(columns, mvcc_columns);
+
+  const auto is_encoded = std::any_of(encoding_spec.cbegin(), encoding_spec.cend(), [](const auto& column_spec) {
+    return column_spec.encoding_type != EncodingType::Unencoded;
+  });
+  if (is_encoded) ChunkEncoder::encode_chunk(chunk, _table->column_data_types(), encoding_spec);
+
+  for (auto column_id = ColumnID{0}; column_id < _table->column_count(); ++column_id) {
+    if (first_chunk->get_art_index(column_id)) chunk->populate_art_index(column_id);
+
+    if (const auto filter = first_chunk->get_filter(column_id)) {
+      chunk
+          ->populate_quotient_filter(column_id, _table->column_data_type(column_id), filter->quotient_bits(),
+                                     filter->remainder_bits())
+          ->execute();
+    }
+  }
+
+  return chunk;
+}
+
+void CompactChunks::_on_commit_records(const CommitID cid) {
+  for (const auto& row_id : _moved_rows) {
+    // We do not unlock the rows so subsequent transactions properly fail when attempting to update these rows.
+    auto mvcc_columns = _table->get_chunk(row_id.chunk_id)->mvcc_columns();
+    mvcc_columns->end_cids[row_id.chunk_offset] = cid;
+    mvcc_columns->update_min_end_cid(cid);
+    mvcc_columns->remove_uncommitted_rows(1u);
+  }
+
+  if (_compacted_chunk_id == INVALID_CHUNK_ID) return;
+
+  auto mvcc_columns = _table->get_chunk(_compacted_chunk_id)->mvcc_columns();
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < _moved_rows.size(); ++chunk_offset) {
+    mvcc_columns->begin_cids[chunk_offset] = cid;
+    mvcc_columns->tids[chunk_offset] = 0u;
+  }
+  mvcc_columns->update_max_begin_cid(cid);
+  mvcc_columns->remove_uncommitted_rows(_moved_rows.size());
+}
+
+void CompactChunks::_on_rollback_records() {
+  for (const auto& row_id : _moved_rows) {
+    auto chunk = _table->get_chunk(row_id.chunk_id);
+
+    // Unlike in Delete, only rows that have been locked successfully are stored
+    auto expected = _transaction_id;
+    chunk->mvcc_columns()->tids[row_id.chunk_offset].compare_exchange_strong(expected, 0u);
+    chunk->mvcc_columns()->remove_uncommitted_rows(1u);
+  }
+
+  if (_compacted_chunk_id == INVALID_CHUNK_ID) return;
+
+  // Like for a rolled back Insert, the rows of the new chunk become invisible for everyone. The chunk is freed by the
+  // GarbageCollector.
+  auto mvcc_columns = _table->get_chunk(_compacted_chunk_id)->mvcc_columns();
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < _moved_rows.size(); ++chunk_offset) {
+    mvcc_columns->end_cids[chunk_offset] = 0u;
+    std::atomic_thread_fence(std::memory_order_release);
+    mvcc_columns->begin_cids[chunk_offset] = 0u;
+    mvcc_columns->tids[chunk_offset] = 0u;
+  }
+  mvcc_columns->update_min_end_cid(0u);
+  mvcc_columns->remove_uncommitted_rows(_moved_rows.size());
+}
+
+void CompactChunks::_on_log_records(LogEntry& log_entry) const {
+  for (const auto& row_id : _moved_rows) {
+    log_entry.add_delete(_table_name, row_id);
+  }
+
+  if (_compacted_chunk_id == INVALID_CHUNK_ID) return;
+
+  // Recovery replays the moved rows into a ValueColumn chunk with the same ChunkID. If the new chunk is not encoded,
+  // Inserts might have appended rows to it in the meantime, which they log themselves.
+  const auto chunk = _table->get_chunk(_compacted_chunk_id);
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < _moved_rows.size(); ++chunk_offset) {
+    auto values = std::vector<AllTypeVariant>{};
+    values.reserve(chunk->column_count());
+    for (auto column_id = ColumnID{0}; column_id < chunk->column_count(); ++column_id) {
+      values.emplace_back((*chunk->get_column(column_id))[chunk_offset]);
+    }
+
+    log_entry.add_insert(_table_name, RowID{_compacted_chunk_id, chunk_offset}, std::move(values));
+  }
+}
+
+std::shared_ptr<AbstractOperator> CompactChunks::_on_recreate(
+    const std::vector<AllParameterVariant>& args, const std::shared_ptr<AbstractOperator>& recreated_input_left,
+    const std::shared_ptr<AbstractOperator>& recreated_input_right) const {
+  return std::make_shared<CompactChunks>(_table_name, _chunk_ids);
+}
+
+}  // namespace opossum
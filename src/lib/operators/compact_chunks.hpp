@@ -0,0 +1,52 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_read_write_operator.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+/**
+ * Operator that moves all rows of the given chunks that are visible to its transaction into a new chunk, which is
+ * appended to the table. In the old chunks, the moved rows are invalidated like by Delete, so that the old chunks can
+ * be freed once no transaction can see them anymore (see concurrency/garbage_collector.hpp). RowIDs of other rows do
+ * not change, so intermediate results of concurrent transactions stay valid.
+ *
+ * The new chunk is encoded like the first of the old chunks, and its statistics, ART indices and quotient filters are
+ * rebuilt.
+ *
+ * Fails if one of the rows has been locked by another transaction. All moved rows must fit into a single chunk.
+ */
+class CompactChunks : public AbstractReadWriteOperator {
+ public:
+  explicit CompactChunks(const std::string& table_name, const std::vector<ChunkID>& chunk_ids);
+
+  const std::string name() const override;
+
+  // The id of the new chunk, INVALID_CHUNK_ID if there were no rows to move
+  ChunkID compacted_chunk_id() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute(std::shared_ptr<TransactionContext> context) override;
+  std::shared_ptr<AbstractOperator> _on_recreate(
+      const std::vector<AllParameterVariant>& args, const std::shared_ptr<AbstractOperator>& recreated_input_left,
+      const std::shared_ptr<AbstractOperator>& recreated_input_right) const override;
+  void _on_commit_records(const CommitID cid) override;
+  void _on_rollback_records() override;
+  void _on_log_records(LogEntry& log_entry) const override;
+
+ private:
+  std::shared_ptr<Chunk> _create_compacted_chunk() const;
+
+ private:
+  const std::string _table_name;
+  const std::vector<ChunkID> _chunk_ids;
+  std::shared_ptr<Table> _table;
+  TransactionID _transaction_id;
+  PosList _moved_rows;
+  ChunkID _compacted_chunk_id{INVALID_CHUNK_ID};
+};
+}  // namespace opossum
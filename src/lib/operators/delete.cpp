@@ -4,6 +4,7 @@
 #include <string>
 
 #include "concurrency/transaction_context.hpp"
+#include "logging/log_entry.hpp"
 #include "statistics/table_statistics.hpp"
 #include "storage/reference_column.hpp"
 #include "storage/storage_manager.hpp"
@@ -37,14 +38,18 @@ std::shared_ptr<const Table> Delete::_on_execute(std::shared_ptr<TransactionCont
 
     for (const auto& row_id : *pos_list) {
       auto referenced_chunk = _table->get_chunk(row_id.chunk_id);
+      auto mvcc_columns = referenced_chunk->mvcc_columns();
+
+      // The row is counted as uncommitted before it is locked so that Validate does not skip the chunk
+      mvcc_columns->add_uncommitted_rows(1u);
 
       auto expected = 0u;
       // Actual row lock for delete happens here
-      const auto success = referenced_chunk->mvcc_columns()->tids[row_id.chunk_offset].compare_exchange_strong(
-          expected, _transaction_id);
+      const auto success = mvcc_columns->tids[row_id.chunk_offset].compare_exchange_strong(expected, _transaction_id);
 
       // the row is already locked and the transaction needs to be rolled back
       if (!success) {
+        mvcc_columns->remove_uncommitted_rows(1u);
         _mark_as_failed();
         return nullptr;
       }
@@ -59,8 +64,11 @@ void Delete::_on_commit_records(const CommitID cid) {
     for (const auto& row_id : *pos_list) {
       auto chunk = _table->get_chunk(row_id.chunk_id);
 
-      chunk->mvcc_columns()->end_cids[row_id.chunk_offset] = cid;
+      auto mvcc_columns = chunk->mvcc_columns();
+      mvcc_columns->end_cids[row_id.chunk_offset] = cid;
       // We do not unlock the rows so subsequent transactions properly fail when attempting to update these rows.
+      mvcc_columns->update_min_end_cid(cid);
+      mvcc_columns->remove_uncommitted_rows(1u);
     }
   }
 }
@@ -76,6 +84,14 @@ void Delete::_finish_commit() {
   }
 }
 
+void Delete::_on_log_records(LogEntry& log_entry) const {
+  for (const auto& pos_list : _pos_lists) {
+    for (const auto& row_id : *pos_list) {
+      log_entry.add_delete(_table_name, row_id);
+    }
+  }
+}
+
 void Delete::_on_rollback_records() {
   for (const auto& pos_list : _pos_lists) {
     for (const auto& row_id : *pos_list) {
@@ -90,6 +106,8 @@ void Delete::_on_rollback_records() {
       // the reason why the rollback was initiated. Since _on_execute stopped at this row, we can stop
       // unlocking rows here as well.
       if (!result) return;
+
+      chunk->mvcc_columns()->remove_uncommitted_rows(1u);
     }
   }
 }
@@ -30,6 +30,7 @@ class Delete : public AbstractReadWriteOperator {
   void _on_commit_records(const CommitID cid) override;
   void _finish_commit() override;
   void _on_rollback_records() override;
+  void _on_log_records(LogEntry& log_entry) const override;
 
  private:
   /**
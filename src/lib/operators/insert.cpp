@@ -3,9 +3,12 @@
 #include <algorithm>
 #include <memory>
 #include <string>
+#include <tuple>
+#include <utility>
 #include <vector>
 
 #include "concurrency/transaction_context.hpp"
+#include "logging/log_entry.hpp"
 #include "resolve_type.hpp"
 #include "storage/base_encoded_column.hpp"
 #include "storage/storage_manager.hpp"
@@ -19,7 +22,7 @@ namespace opossum {
 class AbstractTypedColumnProcessor {
  public:
   virtual ~AbstractTypedColumnProcessor() = default;
-  virtual void resize_vector(std::shared_ptr<BaseColumn> column, size_t new_size) = 0;
+  virtual void grow_vector(std::shared_ptr<BaseColumn> column, size_t new_size) = 0;
   virtual void copy_data(std::shared_ptr<const BaseColumn> source, size_t source_start_index,
                          std::shared_ptr<BaseColumn> target, size_t target_start_index, size_t length) = 0;
 };
@@ -27,15 +30,16 @@ class AbstractTypedColumnProcessor {
 template <typename T>
 class TypedColumnProcessor : public AbstractTypedColumnProcessor {
  public:
-  void resize_vector(std::shared_ptr<BaseColumn> column, size_t new_size) override {
+  // Grows the vectors to at least new_size. Unlike resize(), this can be called by concurrent Inserts.
+  void grow_vector(std::shared_ptr<BaseColumn> column, size_t new_size) override {
     auto val_column = std::dynamic_pointer_cast<ValueColumn<T>>(column);
     DebugAssert(static_cast<bool>(val_column), "Type mismatch");
     auto& values = val_column->values();
 
-    values.resize(new_size);
+    values.grow_to_at_least(new_size);
 
     if (val_column->is_nullable()) {
-      val_column->null_values().resize(new_size);
+      val_column->null_values().grow_to_at_least(new_size);
     }
   }
 
@@ -110,67 +114,64 @@ std::shared_ptr<const Table> Insert::_on_execute(std::shared_ptr<TransactionCont
 
   auto total_rows_to_insert = static_cast<uint32_t>(input_table_left()->row_count());
 
-  // First, allocate space for all the rows to insert. Do so while locking the table to prevent multiple threads
-  // modifying the table's size simultaneously.
-  auto start_index = 0u;
-  auto start_chunk_id = ChunkID{0};
-  auto total_chunks_inserted = 0u;
-  {
-    auto scoped_lock = _target_table->acquire_append_mutex();
-
-    start_chunk_id = _target_table->chunk_count() - 1;
-    auto last_chunk = _target_table->get_chunk(start_chunk_id);
-    start_index = last_chunk->size();
-
-    // If last chunk is compressed, add a new uncompressed chunk
-    if (!last_chunk->is_mutable()) {
-      _target_table->append_mutable_chunk();
-      total_chunks_inserted++;
+  // First, reserve rows in the last chunk of the table. Concurrent Inserts reserve their rows without a lock (see
+  // MvccColumns::reserve_rows()). Only if the last chunk is full or has been encoded, a new chunk is appended while
+  // holding the append mutex.
+  struct ReservedRows {
+    ChunkID chunk_id;
+    ChunkOffset first_row;
+    ChunkOffset row_count;
+  };
+  auto reserved_rows = std::vector<ReservedRows>{};
+
+  auto remaining_rows = total_rows_to_insert;
+  while (remaining_rows > 0) {
+    const auto chunk_count = _target_table->chunk_count();
+
+    auto chunk = std::shared_ptr<Chunk>{};
+    auto first_row = ChunkOffset{0};
+    auto row_count = ChunkOffset{0};
+    if (chunk_count > 0) {
+      chunk = _target_table->get_chunk(static_cast<ChunkID>(chunk_count - 1));
+      if (chunk->is_mutable()) {
+        std::tie(first_row, row_count) =
+            chunk->mvcc_columns()->reserve_rows(remaining_rows, _target_table->max_chunk_size());
+      }
     }
 
-    auto remaining_rows = total_rows_to_insert;
-    while (remaining_rows > 0) {
-      auto current_chunk = _target_table->get_chunk(static_cast<ChunkID>(_target_table->chunk_count() - 1));
-      auto rows_to_insert_this_loop = std::min(_target_table->max_chunk_size() - current_chunk->size(), remaining_rows);
-
-      // Resize MVCC vectors.
-      current_chunk->mvcc_columns()->grow_by(rows_to_insert_this_loop, MvccColumns::MAX_COMMIT_ID);
+    if (row_count == 0) {
+      auto scoped_lock = _target_table->acquire_append_mutex();
 
-      // Resize current chunk to full size.
-      auto old_size = current_chunk->size();
-      for (ColumnID column_id{0}; column_id < current_chunk->column_count(); ++column_id) {
-        typed_column_processors[column_id]->resize_vector(current_chunk->get_mutable_column(column_id),
-                                                          old_size + rows_to_insert_this_loop);
-      }
+      // Another Insert might have appended a chunk in the meantime
+      if (_target_table->chunk_count() == chunk_count) _target_table->append_mutable_chunk();
+      continue;
+    }
 
-      remaining_rows -= rows_to_insert_this_loop;
+    const auto chunk_id = static_cast<ChunkID>(chunk_count - 1);
 
-      // Create new chunk if necessary.
-      if (remaining_rows > 0) {
-        _target_table->append_mutable_chunk();
-        total_chunks_inserted++;
-      }
+    // Grow the columns to include the reserved rows. The MVCC columns have grown already, so that the first thing to
+    // exist in a row is its MVCC data.
+    for (ColumnID column_id{0}; column_id < chunk->column_count(); ++column_id) {
+      typed_column_processors[column_id]->grow_vector(chunk->get_mutable_column(column_id), first_row + row_count);
     }
+
+    reserved_rows.emplace_back(ReservedRows{chunk_id, first_row, row_count});
+    remaining_rows -= row_count;
   }
   // TODO(all): make compress chunk thread-safe; if it gets called here by another thread, things will likely break.
 
   // Then, actually insert the data.
-  auto input_offset = 0u;
   auto source_chunk_id = ChunkID{0};
   auto source_chunk_start_index = 0u;
 
-  for (auto target_chunk_id = start_chunk_id; target_chunk_id <= start_chunk_id + total_chunks_inserted;
-       target_chunk_id++) {
+  for (const auto& [target_chunk_id, first_row, row_count] : reserved_rows) {
     auto target_chunk = _target_table->get_chunk(target_chunk_id);
 
-    const auto current_num_rows_to_insert =
-        std::min(target_chunk->size() - start_index, total_rows_to_insert - input_offset);
-
-    auto target_start_index = start_index;
-    auto still_to_insert = current_num_rows_to_insert;
+    auto target_start_index = first_row;
+    auto still_to_insert = row_count;
 
-    // while target chunk is not full
-    while (target_start_index != target_chunk->size()) {
+    // while the reserved rows are not filled
+    while (still_to_insert > 0) {
       const auto source_chunk = input_table_left()->get_chunk(source_chunk_id);
       auto num_to_insert = std::min(source_chunk->size() - source_chunk_start_index, still_to_insert);
       for (ColumnID column_id{0}; column_id < target_chunk->column_count(); ++column_id) {
@@ -190,18 +191,16 @@ std::shared_ptr<const Table> Insert::_on_execute(std::shared_ptr<TransactionCont
       }
     }
 
-    for (auto i = start_index; i < start_index + current_num_rows_to_insert; i++) {
+    auto mvcc_columns = target_chunk->mvcc_columns();
+    for (auto i = first_row; i < first_row + row_count; i++) {
       // we do not need to check whether other operators have locked the rows, we have just created them
       // and they are not visible for other operators.
       // the transaction IDs are set here and not during the resize, because
       // tbb::concurrent_vector::grow_to_at_least(n, t)" does not work with atomics, since their copy constructor is
       // deleted.
-      target_chunk->mvcc_columns()->tids[i] = context->transaction_id();
+      mvcc_columns->tids[i] = context->transaction_id();
       _inserted_rows.emplace_back(RowID{target_chunk_id, i});
     }
-
-    input_offset += current_num_rows_to_insert;
-    start_index = 0u;
   }
 
   return nullptr;
@@ -214,6 +213,8 @@ void Insert::_on_commit_records(const CommitID cid) {
     auto mvcc_columns = chunk->mvcc_columns();
     mvcc_columns->begin_cids[row_id.chunk_offset] = cid;
     mvcc_columns->tids[row_id.chunk_offset] = 0u;
+    mvcc_columns->update_max_begin_cid(cid);
+    mvcc_columns->remove_uncommitted_rows(1u);
   }
 }
 
@@ -227,6 +228,22 @@ void Insert::_on_rollback_records() {
     chunk->mvcc_columns()->begin_cids[row_id.chunk_offset] = 0u;
 
     chunk->mvcc_columns()->tids[row_id.chunk_offset] = 0u;
+    chunk->mvcc_columns()->update_min_end_cid(0u);
+    chunk->mvcc_columns()->remove_uncommitted_rows(1u);
+  }
+}
+
+void Insert::_on_log_records(LogEntry& log_entry) const {
+  for (const auto& row_id : _inserted_rows) {
+    const auto chunk = _target_table->get_chunk(row_id.chunk_id);
+
+    auto values = std::vector<AllTypeVariant>{};
+    values.reserve(chunk->column_count());
+    for (auto column_id = ColumnID{0}; column_id < chunk->column_count(); ++column_id) {
+      values.emplace_back((*chunk->get_column(column_id))[row_id.chunk_offset]);
+    }
+
+    log_entry.add_insert(_target_table_name, row_id, std::move(values));
   }
 }
 
@@ -32,6 +32,7 @@ class Insert : public AbstractReadWriteOperator {
       const std::shared_ptr<AbstractOperator>& recreated_input_right) const override;
   void _on_commit_records(const CommitID cid) override;
   void _on_rollback_records() override;
+  void _on_log_records(LogEntry& log_entry) const override;
 
  private:
   const std::string _target_table_name;
@@ -10,6 +10,7 @@
 
 #include "join_hash/hash_traits.hpp"
 #include "resolve_type.hpp"
+#include "scheduler/cancellation_token.hpp"
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/job_task.hpp"
@@ -76,7 +77,7 @@ std::shared_ptr<const Table> JoinHash::_on_execute() {
 
   _impl = make_unique_by_data_types<AbstractReadOnlyOperatorImpl, JoinHashImpl>(
       build_input->column_data_type(build_column_id), probe_input->column_data_type(probe_column_id), build_operator,
-      probe_operator, _mode, adjusted_column_ids, _predicate_condition, inputs_swapped);
+      probe_operator, _mode, adjusted_column_ids, _predicate_condition, inputs_swapped, _cancellation_token);
   return _impl->_on_execute();
 }
 
@@ -91,13 +92,14 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
  public:
   JoinHashImpl(const std::shared_ptr<const AbstractOperator> left, const std::shared_ptr<const AbstractOperator> right,
                const JoinMode mode, const ColumnIDPair& column_ids, const PredicateCondition predicate_condition,
-               const bool inputs_swapped)
+               const bool inputs_swapped, const std::shared_ptr<const CancellationToken>& cancellation_token)
       : _left(left),
         _right(right),
         _mode(mode),
         _column_ids(column_ids),
         _predicate_condition(predicate_condition),
-        _inputs_swapped(inputs_swapped) {}
+        _inputs_swapped(inputs_swapped),
+        _cancellation_token(cancellation_token) {}
 
   virtual ~JoinHashImpl() = default;
 
@@ -107,9 +109,13 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
   const ColumnIDPair _column_ids;
   const PredicateCondition _predicate_condition;
   const bool _inputs_swapped;
+  const std::shared_ptr<const CancellationToken> _cancellation_token;
 
   std::shared_ptr<Table> _output_table;
 
+  // See AbstractOperator::_is_cancelled()
+  bool _is_cancelled() const { return _cancellation_token && _cancellation_token->is_cancelled(); }
+
   const unsigned int _partitioning_seed = 13;
   const size_t _radix_bits = 9;
 
@@ -262,7 +268,8 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
           }
         }
       }));
-      jobs.back()->schedule();
+      // Materialize the chunk on the node that holds its memory
+      jobs.back()->schedule(in_table->get_chunk(chunk_id)->numa_node_id());
     }
 
     CurrentScheduler::wait_for_tasks(jobs);
@@ -351,6 +358,8 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
     for (size_t current_partition_id = 0; current_partition_id < (radix_container.partition_offsets.size() - 1);
          ++current_partition_id) {
       jobs.emplace_back(std::make_shared<JobTask>([&, current_partition_id]() {
+        if (_is_cancelled()) return;
+
         auto& partition_left = static_cast<Partition<LeftType>&>(*radix_container.elements);
         const auto& partition_left_begin = radix_container.partition_offsets[current_partition_id];
         const auto& partition_left_end = radix_container.partition_offsets[current_partition_id + 1];
@@ -400,6 +409,8 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
     for (size_t current_partition_id = 0; current_partition_id < (radix_container.partition_offsets.size() - 1);
          ++current_partition_id) {
       jobs.emplace_back(std::make_shared<JobTask>([&, current_partition_id]() {
+        if (_is_cancelled()) return;
+
         // Get information from work queue
         auto& partition = static_cast<Partition<RightType>&>(*radix_container.elements);
         const auto& partition_begin = radix_container.partition_offsets[current_partition_id];
@@ -478,6 +489,8 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
     for (size_t current_partition_id = 0; current_partition_id < (radix_container.partition_offsets.size() - 1);
          ++current_partition_id) {
       jobs.emplace_back(std::make_shared<JobTask>([&, current_partition_id]() {
+        if (_is_cancelled()) return;
+
         // Get information from work queue
         auto& partition = static_cast<Partition<RightType>&>(*radix_container.elements);
         const auto& partition_begin = radix_container.partition_offsets[current_partition_id];
@@ -597,6 +610,9 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
     auto materialized_right =
         _materialize_input<RightType>(_right_in_table, _column_ids.second, histograms_right, keep_nulls);
 
+    // The output of a cancelled join is discarded, so it may stop between any of the phases
+    if (_is_cancelled()) return _output_table;
+
     // Radix Partitioning phase
     /*
     NUMA notes:
@@ -612,6 +628,7 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
     // 'keep_nulls' makes sure that the relation on the right keeps NULL values when executing an OUTER join.
     auto radix_right =
         _partition_radix_parallel<RightType>(materialized_right, right_chunk_offsets, histograms_right, keep_nulls);
+    if (_is_cancelled()) return _output_table;
 
     // Build phase
     std::vector<std::shared_ptr<HashTable<HashedType>>> hashtables;
@@ -621,6 +638,7 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
     The hashtables for each partition P should also reside on the same node as the two vectors leftP and rightP.
     */
     _build(radix_left, hashtables);
+    if (_is_cancelled()) return _output_table;
 
     // Probe phase
     std::vector<PosList> left_pos_lists;
@@ -637,6 +655,7 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
     } else {
       _probe(radix_right, hashtables, left_pos_lists, right_pos_lists);
     }
+    if (_is_cancelled()) return _output_table;
 
     auto only_output_right_input = _inputs_swapped && (_mode == JoinMode::Semi || _mode == JoinMode::Anti);
 
@@ -705,8 +724,6 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
     PosListsByColumn pos_lists_by_column(input_table->column_count());
     auto pos_lists_by_column_it = pos_lists_by_column.begin();
 
-    const auto& input_chunks = input_table->chunks();
-
     for (ColumnID column_id{0}; column_id < input_table->column_count(); ++column_id) {
       // Get all the input pos lists so that we only have to pointer cast the columns once
       auto pos_list_ptrs = std::make_shared<PosLists>(input_table->chunk_count());
@@ -714,7 +731,7 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
 
       for (ChunkID chunk_id{0}; chunk_id < input_table->chunk_count(); chunk_id++) {
         const auto ref_column =
-            std::static_pointer_cast<const ReferenceColumn>(input_chunks[chunk_id]->columns()[column_id]);
+            std::static_pointer_cast<const ReferenceColumn>(input_table->get_chunk(chunk_id)->get_column(column_id));
         *pos_lists_iter = ref_column->pos_list();
         ++pos_lists_iter;
       }
@@ -32,37 +32,65 @@ std::shared_ptr<const Table> Limit::_on_execute() {
   ChunkID chunk_id{0};
   for (size_t i = 0; i < _num_rows && chunk_id < input_table->chunk_count(); chunk_id++) {
     const auto input_chunk = input_table->get_chunk(chunk_id);
-    ChunkColumns output_columns;
 
     size_t output_chunk_row_count = std::min<size_t>(input_chunk->size(), _num_rows - i);
 
-    for (ColumnID column_id{0}; column_id < input_table->column_count(); column_id++) {
-      const auto input_base_column = input_chunk->get_column(column_id);
-      auto output_pos_list = std::make_shared<PosList>(output_chunk_row_count);
-      std::shared_ptr<const Table> referenced_table;
-      ColumnID output_column_id = column_id;
-
-      if (auto input_ref_column = std::dynamic_pointer_cast<const ReferenceColumn>(input_base_column)) {
-        output_column_id = input_ref_column->referenced_column_id();
-        referenced_table = input_ref_column->referenced_table();
-        // TODO(all): optimize using whole chunk whenever possible
-        auto begin = input_ref_column->pos_list()->begin();
-        std::copy(begin, begin + output_chunk_row_count, output_pos_list->begin());
-      } else {
-        referenced_table = input_table;
-        for (ChunkOffset chunk_offset = 0; chunk_offset < output_chunk_row_count; chunk_offset++) {
-          (*output_pos_list)[chunk_offset] = RowID{chunk_id, chunk_offset};
-        }
-      }
+    i += output_chunk_row_count;
+    output_table->append_chunk(_limit_chunk(input_table, chunk_id, output_chunk_row_count));
+  }
+
+  return output_table;
+}
+
+bool Limit::is_pipelineable() const { return true; }
+
+std::shared_ptr<Table> Limit::_on_pipeline_begin(const std::shared_ptr<const Table>& input_table) {
+  _pipeline_remaining_rows = _num_rows;
 
-      output_columns.push_back(std::make_shared<ReferenceColumn>(referenced_table, output_column_id, output_pos_list));
+  return std::make_shared<Table>(input_table->column_definitions(), TableType::References);
+}
+
+ChunkColumns Limit::_on_execute_chunk(const std::shared_ptr<const Table>& input_table, const ChunkID chunk_id) {
+  const auto output_chunk_row_count =
+      std::min<size_t>(input_table->get_chunk(chunk_id)->size(), _pipeline_remaining_rows);
+  if (output_chunk_row_count == 0) return {};
+
+  _pipeline_remaining_rows -= output_chunk_row_count;
+  return _limit_chunk(input_table, chunk_id, output_chunk_row_count);
+}
+
+bool Limit::_pipeline_requires_order() const { return true; }
+
+bool Limit::_pipeline_is_exhausted() const { return _pipeline_remaining_rows == 0; }
+
+ChunkColumns Limit::_limit_chunk(const std::shared_ptr<const Table>& input_table, const ChunkID chunk_id,
+                                 const size_t row_count) {
+  const auto input_chunk = input_table->get_chunk(chunk_id);
+  ChunkColumns output_columns;
+
+  for (ColumnID column_id{0}; column_id < input_table->column_count(); column_id++) {
+    const auto input_base_column = input_chunk->get_column(column_id);
+    auto output_pos_list = std::make_shared<PosList>(row_count);
+    std::shared_ptr<const Table> referenced_table;
+    ColumnID output_column_id = column_id;
+
+    if (auto input_ref_column = std::dynamic_pointer_cast<const ReferenceColumn>(input_base_column)) {
+      output_column_id = input_ref_column->referenced_column_id();
+      referenced_table = input_ref_column->referenced_table();
+      // TODO(all): optimize using whole chunk whenever possible
+      auto begin = input_ref_column->pos_list()->begin();
+      std::copy(begin, begin + row_count, output_pos_list->begin());
+    } else {
+      referenced_table = input_table;
+      for (ChunkOffset chunk_offset = 0; chunk_offset < row_count; chunk_offset++) {
+        (*output_pos_list)[chunk_offset] = RowID{chunk_id, chunk_offset};
+      }
     }
 
-    i += output_chunk_row_count;
-    output_table->append_chunk(output_columns);
+    output_columns.push_back(std::make_shared<ReferenceColumn>(referenced_table, output_column_id, output_pos_list));
   }
 
-  return output_table;
+  return output_columns;
 }
 
 }  // namespace opossum
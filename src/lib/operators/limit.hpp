@@ -16,13 +16,28 @@ class Limit : public AbstractReadOnlyOperator {
 
   size_t num_rows() const;
 
+  bool is_pipelineable() const override;
+
  protected:
   std::shared_ptr<const Table> _on_execute() override;
   std::shared_ptr<AbstractOperator> _on_recreate(
       const std::vector<AllParameterVariant>& args, const std::shared_ptr<AbstractOperator>& recreated_input_left,
       const std::shared_ptr<AbstractOperator>& recreated_input_right) const override;
 
+  // In a pipeline, the chunks have to arrive in order. Once num_rows rows were emitted, no further input is needed.
+  std::shared_ptr<Table> _on_pipeline_begin(const std::shared_ptr<const Table>& input_table) override;
+  ChunkColumns _on_execute_chunk(const std::shared_ptr<const Table>& input_table, const ChunkID chunk_id) override;
+  bool _pipeline_requires_order() const override;
+  bool _pipeline_is_exhausted() const override;
+
+  // Returns the columns of an output chunk that references the first row_count rows of the input chunk
+  static ChunkColumns _limit_chunk(const std::shared_ptr<const Table>& input_table, const ChunkID chunk_id,
+                                   const size_t row_count);
+
  private:
   const size_t _num_rows;
+
+  // Rows that still may be emitted in pipelined execution
+  size_t _pipeline_remaining_rows{0};
 };
 }  // namespace opossum
@@ -0,0 +1,221 @@
+#include "operator_pipeline.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "concurrency/transaction_context.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+#include "utils/timer.hpp"
+
+namespace opossum {
+
+OperatorPipeline::OperatorPipeline(const std::vector<std::shared_ptr<AbstractOperator>>& operators)
+    : _operators(operators) {
+  Assert(!_operators.empty(), "A pipeline needs at least one operator.");
+  Assert(_operators.front()->input_left(), "The first operator of a pipeline needs an input.");
+
+  for (auto operator_idx = size_t{0}; operator_idx < _operators.size(); ++operator_idx) {
+    const auto& op = _operators[operator_idx];
+    Assert(op->is_pipelineable(), "Operator " + op->description() + " cannot be part of a pipeline.");
+    Assert(!op->input_right(), "Pipelined operators must only have a left input.");
+    Assert(operator_idx == 0 || op->input_left() == _operators[operator_idx - 1],
+           "Every operator of a pipeline must consume the output of the previous one.");
+    Assert(operator_idx + 1 == _operators.size() || !op->pipeline_outputs_data_columns(),
+           "Operator " + op->description() + " can only be the last operator of a pipeline.");
+  }
+}
+
+const std::vector<std::shared_ptr<AbstractOperator>>& OperatorPipeline::operators() const { return _operators; }
+
+std::string OperatorPipeline::description() const {
+  auto description = std::string{"Pipeline: "};
+  for (auto operator_idx = size_t{0}; operator_idx < _operators.size(); ++operator_idx) {
+    if (operator_idx > 0) description += " -> ";
+    description += _operators[operator_idx]->description();
+  }
+  return description;
+}
+
+void OperatorPipeline::execute() {
+  const auto& source = _operators.front();
+  const auto& sink = _operators.back();
+
+  // See AbstractOperator::execute()
+  if (sink->_is_cancelled()) return;
+
+  DebugAssert(source->input_left()->get_output(), "Input of the pipeline has not yet been executed");
+  DebugAssert(!sink->get_output(), "Pipeline has already been executed");
+
+  Timer performance_timer;
+
+  auto transaction_context = sink->transaction_context();
+
+  if (transaction_context) {
+    // See AbstractOperator::execute()
+    if (transaction_context->aborted()) {
+      return;
+    }
+    transaction_context->on_operator_started();
+    sink->_output = _execute_morsels(source->input_table_left());
+    transaction_context->on_operator_finished();
+  } else {
+    sink->_output = _execute_morsels(source->input_table_left());
+  }
+
+  for (const auto& op : _operators) {
+    op->_on_cleanup();
+  }
+
+  // The other operators were never executed on their own, so their share cannot be told apart
+  sink->_base_performance_data.walltime = performance_timer.lap();
+}
+
+std::shared_ptr<Table> OperatorPipeline::_execute_morsels(const std::shared_ptr<const Table>& input_table) {
+  // Every operator creates its (empty) output table. These define the layout of the intermediate morsels.
+  auto output_tables = std::vector<std::shared_ptr<Table>>{};
+  output_tables.reserve(_operators.size());
+
+  auto operator_input_table = input_table;
+  for (const auto& op : _operators) {
+    output_tables.emplace_back(op->_on_pipeline_begin(operator_input_table));
+    operator_input_table = output_tables.back();
+  }
+
+  /**
+   * Operators that depend on the order of their input (i.e., Limit) and all operators after them form the ordered part
+   * of the pipeline. The morsels are pushed through the operators before it concurrently and through the ordered part
+   * one after another, in the order of the input, until one of its operators is exhausted.
+   */
+  const auto first_ordered_operator_it = std::find_if(_operators.cbegin(), _operators.cend(),
+                                                      [](const auto& op) { return op->_pipeline_requires_order(); });
+  const auto first_ordered_operator_idx = static_cast<size_t>(first_ordered_operator_it - _operators.cbegin());
+
+  /**
+   * Pushes a chunk through the operators [begin_operator_idx, end_operator_idx) and returns the columns of the
+   * resulting output chunk. The next operator expects a table, so every intermediate chunk is wrapped in a table that
+   * is private to this morsel. If the next operator references the rows of this table (e.g., because the chunk was
+   * created by a Projection), its ReferenceColumns keep the table alive.
+   */
+  const auto push_morsel = [&](std::shared_ptr<const Table> morsel_table, ChunkID morsel_chunk_id,
+                               const size_t begin_operator_idx, const size_t end_operator_idx) {
+    for (auto operator_idx = begin_operator_idx;; ++operator_idx) {
+      auto columns = _operators[operator_idx]->_on_execute_chunk(morsel_table, morsel_chunk_id);
+      if (columns.empty() || operator_idx + 1 == end_operator_idx) return columns;
+
+      const auto& output_table = output_tables[operator_idx];
+      auto intermediate_table = std::make_shared<Table>(output_table->column_definitions(), output_table->type());
+      intermediate_table->append_chunk(columns);
+
+      morsel_table = intermediate_table;
+      morsel_chunk_id = ChunkID{0};
+    }
+  };
+
+  const auto chunk_count = input_table->chunk_count();
+  auto columns_by_morsel = std::vector<ChunkColumns>(chunk_count);
+
+  /**
+   * An exception must not escape a job, since it would terminate the Worker's thread. Instead, it is rethrown on the
+   * thread that executes the pipeline, after all jobs have finished.
+   */
+  auto exceptions_by_morsel = std::vector<std::exception_ptr>(chunk_count);
+
+  // Set once an operator of the ordered part does not need further input, so that the remaining morsels are skipped
+  auto is_exhausted = std::atomic_bool{false};
+
+  // Pushes a chunk of the input through the operators before the ordered part
+  const auto push_unordered = [&](const ChunkID chunk_id) {
+    if (input_table->get_chunk(chunk_id)->size() == 0) return;
+    if (is_exhausted || _operators.back()->_is_cancelled()) return;
+
+    try {
+      columns_by_morsel[chunk_id] = push_morsel(input_table, chunk_id, 0, first_ordered_operator_idx);
+    } catch (...) {
+      exceptions_by_morsel[chunk_id] = std::current_exception();
+    }
+  };
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunk_count);
+  const auto schedule_job = [&](const ChunkID chunk_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() { push_unordered(chunk_id); }));
+    jobs.back()->schedule();
+  };
+
+  if (first_ordered_operator_idx == _operators.size()) {
+    for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+      schedule_job(chunk_id);
+    }
+    CurrentScheduler::wait_for_tasks(jobs);
+  } else {
+    // Without a scheduler, jobs are executed as soon as they are scheduled. They are only scheduled once their morsel
+    // is needed, so that no morsel is pushed into the first operators after the pipeline is exhausted.
+    const auto has_unordered_part = first_ordered_operator_idx > 0;
+    const auto schedules_jobs_ahead = has_unordered_part && CurrentScheduler::is_set();
+    if (schedules_jobs_ahead) {
+      for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+        schedule_job(chunk_id);
+      }
+    }
+
+    auto chunk_id = ChunkID{0};
+    for (; chunk_id < chunk_count && !is_exhausted; ++chunk_id) {
+      if (schedules_jobs_ahead) {
+        CurrentScheduler::wait_for_tasks(std::vector<std::shared_ptr<AbstractTask>>{jobs[chunk_id]});
+      } else if (has_unordered_part) {
+        schedule_job(chunk_id);
+      }
+
+      if (exceptions_by_morsel[chunk_id]) break;
+      if (input_table->get_chunk(chunk_id)->size() == 0 || _operators.back()->_is_cancelled()) continue;
+
+      auto& columns = columns_by_morsel[chunk_id];
+      try {
+        if (!has_unordered_part) {
+          columns = push_morsel(input_table, chunk_id, 0, _operators.size());
+        } else if (!columns.empty()) {
+          const auto& output_table = output_tables[first_ordered_operator_idx - 1];
+          auto morsel_table = std::make_shared<Table>(output_table->column_definitions(), output_table->type());
+          morsel_table->append_chunk(columns);
+          columns = push_morsel(morsel_table, ChunkID{0}, first_ordered_operator_idx, _operators.size());
+        }
+      } catch (...) {
+        exceptions_by_morsel[chunk_id] = std::current_exception();
+        break;
+      }
+
+      is_exhausted = std::any_of(first_ordered_operator_it, _operators.cend(),
+                                 [](const auto& op) { return op->_pipeline_is_exhausted(); });
+    }
+
+    // The remaining morsels are not pushed through the ordered part, so they are not part of the output
+    is_exhausted = true;
+    if (schedules_jobs_ahead) CurrentScheduler::wait_for_tasks(jobs);
+    for (; chunk_id < chunk_count; ++chunk_id) {
+      columns_by_morsel[chunk_id].clear();
+    }
+  }
+
+  for (const auto& exception : exceptions_by_morsel) {
+    if (exception) std::rethrow_exception(exception);
+  }
+
+  // Appending the chunks in the order of the input keeps the output deterministic
+  auto& output_table = output_tables.back();
+  for (const auto& columns : columns_by_morsel) {
+    if (!columns.empty()) output_table->append_chunk(columns);
+  }
+
+  return output_table;
+}
+
+}  // namespace opossum
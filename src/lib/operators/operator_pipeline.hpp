@@ -0,0 +1,47 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractOperator;
+class Table;
+
+/**
+ * An OperatorPipeline executes a chain of pipelineable operators (see AbstractOperator::is_pipelineable()), e.g.,
+ * TableScan -> Validate -> TableScan -> Projection, in a push-based fashion. Instead of having every operator
+ * materialize its entire output table before the next operator starts, every chunk of the pipeline's input is a
+ * morsel that is pushed through all operators of the pipeline by a single JobTask. Thus, the intermediate results of a
+ * morsel stay in the cache of the worker that processes it and never end up in an intermediate table.
+ *
+ * Only the last operator of the pipeline (the sink) has an output afterwards. The outputs of the other operators are
+ * never materialized, which is why an operator can only be part of a pipeline if the next operator of the pipeline is
+ * its only consumer. Operators that create data columns (i.e., Projection) can only be the sink, since every
+ * intermediate chunk is wrapped in a table of its own (see AbstractOperator::pipeline_outputs_data_columns()).
+ *
+ * If one of the operators depends on the order of its input (i.e., Limit), the morsels are still pushed through the
+ * operators before it concurrently. Their results are pushed through this operator and all later ones in the order of
+ * the input, and the execution stops as soon as one of them does not need further input.
+ */
+class OperatorPipeline {
+ public:
+  // The operators are ordered from source to sink, i.e., every operator is the left input of the next one
+  explicit OperatorPipeline(const std::vector<std::shared_ptr<AbstractOperator>>& operators);
+
+  const std::vector<std::shared_ptr<AbstractOperator>>& operators() const;
+
+  std::string description() const;
+
+  void execute();
+
+ protected:
+  std::shared_ptr<Table> _execute_morsels(const std::shared_ptr<const Table>& input_table);
+
+  const std::vector<std::shared_ptr<AbstractOperator>> _operators;
+};
+
+}  // namespace opossum
@@ -1,10 +1,13 @@
 #include "projection.hpp"
 
 #include <algorithm>
+#include <exception>
 #include <functional>
+#include <iterator>
 #include <memory>
 #include <numeric>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -12,11 +15,12 @@
 #include "operators/pqp_expression.hpp"
 #include "resolve_type.hpp"
 
+#include "scheduler/abstract_task.hpp"
 #include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
 #include "sql/sql_query_plan.hpp"
 
 #include "storage/create_iterable_from_column.hpp"
-#include "storage/materialize.hpp"
 #include "storage/reference_column.hpp"
 #include "utils/arithmetic_operator_expression.hpp"
 
@@ -41,6 +45,16 @@ const std::string Projection::description(DescriptionMode description_mode) cons
 
 const Projection::ColumnExpressions& Projection::column_expressions() const { return _column_expressions; }
 
+std::vector<std::shared_ptr<AbstractOperator>> Projection::subselect_operators() const {
+  std::vector<std::shared_ptr<AbstractOperator>> subselect_operators;
+  for (const auto& column_expression : _column_expressions) {
+    if (column_expression->is_subselect() && !column_expression->has_subselect_table()) {
+      subselect_operators.emplace_back(column_expression->subselect_operator());
+    }
+  }
+  return subselect_operators;
+}
+
 std::shared_ptr<AbstractOperator> Projection::_on_recreate(
     const std::vector<AllParameterVariant>& args, const std::shared_ptr<AbstractOperator>& recreated_input_left,
     const std::shared_ptr<AbstractOperator>& recreated_input_right) const {
@@ -106,25 +120,85 @@ std::shared_ptr<BaseColumn> Projection::_create_column(boost::hana::basic_type<T
     return std::make_shared<ValueColumn<T>>(std::move(values), std::move(null_values));
   } else {
     // fill a value column with the specified expression
-    auto values = _evaluate_expression<T>(expression, input_table_left, chunk_id);
-
-    pmr_concurrent_vector<T> non_null_values;
-    non_null_values.grow_to_at_least(values.size());
-    pmr_concurrent_vector<bool> null_values;
-    null_values.grow_to_at_least(values.size());
-
-    ChunkOffset offset{0};
-    for (const auto value : values) {
-      non_null_values[offset] = value.second;
-      null_values[offset] = value.first;
-      offset++;
+    auto evaluated = _evaluate_expression<T>(expression, input_table_left, chunk_id);
+
+    // The kernels work on contiguous vectors, the ValueColumn stores concurrent ones. Moving the values avoids copying
+    // the contents of strings.
+    auto values = pmr_concurrent_vector<T>{};
+    values.grow_by(std::make_move_iterator(evaluated.values.begin()), std::make_move_iterator(evaluated.values.end()));
+
+    auto null_values = pmr_concurrent_vector<bool>{};
+    if (evaluated.nulls.empty()) {
+      null_values.grow_by(values.size(), false);
+    } else {
+      null_values.grow_by(evaluated.nulls.cbegin(), evaluated.nulls.cend());
     }
 
-    return std::make_shared<ValueColumn<T>>(std::move(non_null_values), std::move(null_values));
+    return std::make_shared<ValueColumn<T>>(std::move(values), std::move(null_values));
   }
 }
 
 std::shared_ptr<const Table> Projection::_on_execute() {
+  auto output_table = _create_output_table(input_table_left());
+
+  /**
+   * Perform the projection. Every chunk is projected by a job of its own, the output chunks are appended in the order
+   * of the input.
+   *
+   * The expressions might fail for some rows (e.g., divisions by zero). An exception must not escape a job, since it
+   * would terminate the Worker's thread. Instead, it is rethrown here, on the thread that executes the Projection.
+   */
+  const auto chunk_count = input_table_left()->chunk_count();
+  auto output_columns_by_chunk = std::vector<ChunkColumns>(chunk_count);
+  auto exceptions_by_chunk = std::vector<std::exception_ptr>(chunk_count);
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunk_count);
+
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+    auto job_task = std::make_shared<JobTask>([&, chunk_id]() {
+      if (_is_cancelled()) return;
+
+      try {
+        output_columns_by_chunk[chunk_id] = _project_chunk(input_table_left(), chunk_id);
+      } catch (...) {
+        exceptions_by_chunk[chunk_id] = std::current_exception();
+      }
+    });
+
+    jobs.push_back(job_task);
+    job_task->schedule();
+  }
+
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  for (const auto& exception : exceptions_by_chunk) {
+    if (exception) std::rethrow_exception(exception);
+  }
+
+  // Some chunks were not projected, the output is discarded anyway
+  if (_is_cancelled()) return output_table;
+
+  for (const auto& output_columns : output_columns_by_chunk) {
+    output_table->append_chunk(output_columns);
+  }
+
+  return output_table;
+}
+
+bool Projection::is_pipelineable() const { return true; }
+
+bool Projection::pipeline_outputs_data_columns() const { return true; }
+
+std::shared_ptr<Table> Projection::_on_pipeline_begin(const std::shared_ptr<const Table>& input_table) {
+  return _create_output_table(input_table);
+}
+
+ChunkColumns Projection::_on_execute_chunk(const std::shared_ptr<const Table>& input_table, const ChunkID chunk_id) {
+  return _project_chunk(input_table, chunk_id);
+}
+
+std::shared_ptr<Table> Projection::_create_output_table(const std::shared_ptr<const Table>& input_table) {
   auto reuse_columns_from_input = true;
 
   /**
@@ -134,20 +208,25 @@ std::shared_ptr<const Table> Projection::_on_execute() {
   for (const auto& column_expression : _column_expressions) {
     TableColumnDefinition column_definition;
 
-    // For subselects, we need to execute the subquery in order to use the result table later
+    // For subselects, we need the result of the subquery. If the Projection was scheduled via OperatorTasks, the
+    // subquery was executed as one of its predecessors. Otherwise, we have to execute it now.
     if (column_expression->is_subselect() && !column_expression->has_subselect_table()) {
-      SQLQueryPlan query_plan;
-      query_plan.add_tree_by_root(column_expression->subselect_operator());
+      const auto subselect_operator = column_expression->subselect_operator();
 
-      auto transaction_context = this->transaction_context();
-      if (transaction_context) {
-        query_plan.set_transaction_context(transaction_context);
-      }
+      if (!subselect_operator->get_output()) {
+        SQLQueryPlan query_plan;
+        query_plan.add_tree_by_root(subselect_operator);
+
+        auto transaction_context = this->transaction_context();
+        if (transaction_context) {
+          query_plan.set_transaction_context(transaction_context);
+        }
 
-      const auto tasks = query_plan.create_tasks();
-      CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+        const auto tasks = query_plan.create_tasks();
+        CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+      }
 
-      auto result_table = tasks.back()->get_operator()->get_output();
+      auto result_table = subselect_operator->get_output();
       DebugAssert(result_table->column_count() == 1, "Subselect table must have exactly one column.");
 
       Assert(result_table->row_count() == 1,
@@ -160,9 +239,9 @@ std::shared_ptr<const Table> Projection::_on_execute() {
     if (column_expression->alias()) {
       column_definition.name = *column_expression->alias();
     } else if (column_expression->type() == ExpressionType::Column) {
-      column_definition.name = input_table_left()->column_name(column_expression->column_id());
+      column_definition.name = input_table->column_name(column_expression->column_id());
     } else if (column_expression->is_arithmetic_operator() || column_expression->type() == ExpressionType::Literal) {
-      column_definition.name = column_expression->to_string(input_table_left()->column_names());
+      column_definition.name = column_expression->to_string(input_table->column_names());
     } else if (column_expression->is_subselect()) {
       column_definition.name = column_expression->subselect_table()->column_names()[0];
     } else {
@@ -173,7 +252,7 @@ std::shared_ptr<const Table> Projection::_on_execute() {
       reuse_columns_from_input = false;
     }
 
-    const auto type = _get_type_of_expression(column_expression, input_table_left());
+    const auto type = _get_type_of_expression(column_expression, input_table);
     if (type == DataType::Null) {
       // in case of a NULL literal, simply add a nullable int column
       column_definition.data_type = DataType::Int;
@@ -185,27 +264,25 @@ std::shared_ptr<const Table> Projection::_on_execute() {
     column_definitions.emplace_back(column_definition);
   }
 
-  const auto table_type = reuse_columns_from_input ? input_table_left()->type() : TableType::Data;
-  auto output_table = std::make_shared<Table>(column_definitions, table_type, input_table_left()->max_chunk_size());
+  _reuse_columns_from_input = reuse_columns_from_input;
+  _output_column_definitions = column_definitions;
 
-  /**
-   * Perform the projection
-   */
-  for (ChunkID chunk_id{0}; chunk_id < input_table_left()->chunk_count(); ++chunk_id) {
-    ChunkColumns output_columns;
-
-    for (uint16_t expression_index = 0u; expression_index < _column_expressions.size(); ++expression_index) {
-      resolve_data_type(output_table->column_data_type(ColumnID{expression_index}), [&](auto type) {
-        const auto column = _create_column(type, chunk_id, _column_expressions[expression_index], input_table_left(),
-                                           reuse_columns_from_input);
-        output_columns.push_back(column);
-      });
-    }
+  const auto table_type = reuse_columns_from_input ? input_table->type() : TableType::Data;
+  return std::make_shared<Table>(column_definitions, table_type, input_table->max_chunk_size());
+}
 
-    output_table->append_chunk(output_columns);
+ChunkColumns Projection::_project_chunk(const std::shared_ptr<const Table>& input_table, const ChunkID chunk_id) const {
+  ChunkColumns output_columns;
+
+  for (uint16_t expression_index = 0u; expression_index < _column_expressions.size(); ++expression_index) {
+    resolve_data_type(_output_column_definitions[expression_index].data_type, [&](auto type) {
+      const auto column = _create_column(type, chunk_id, _column_expressions[expression_index], input_table,
+                                         _reuse_columns_from_input);
+      output_columns.push_back(column);
+    });
   }
 
-  return output_table;
+  return output_columns;
 }
 
 DataType Projection::_get_type_of_expression(const std::shared_ptr<PQPExpression>& expression,
@@ -243,31 +320,44 @@ DataType Projection::_get_type_of_expression(const std::shared_ptr<PQPExpression
 }
 
 template <typename T>
-const pmr_concurrent_vector<std::pair<bool, T>> Projection::_evaluate_expression(
-    const std::shared_ptr<PQPExpression>& expression, const std::shared_ptr<const Table> table,
-    const ChunkID chunk_id) {
+Projection::EvaluatedExpression<T> Projection::_evaluate_expression(const std::shared_ptr<PQPExpression>& expression,
+                                                                    const std::shared_ptr<const Table>& table,
+                                                                    const ChunkID chunk_id) {
+  const auto row_count = table->get_chunk(chunk_id)->size();
+
+  EvaluatedExpression<T> result;
+
   /**
    * Handle Literal
    * This is only used if the Literal represents a constant column, e.g. in 'SELECT 5 FROM table_a'.
    * On the other hand this is not used for nested arithmetic Expressions, such as 'SELECT a + 5 FROM table_a'.
    */
   if (expression->type() == ExpressionType::Literal) {
-    return pmr_concurrent_vector<std::pair<bool, T>>(table->get_chunk(chunk_id)->size(),
-                                                     std::make_pair(false, boost::get<T>(expression->value())));
+    result.values.resize(row_count, boost::get<T>(expression->value()));
+    return result;
   }
 
   /**
    * Handle column reference
    */
   if (expression->type() == ExpressionType::Column) {
-    const auto chunk = table->get_chunk(chunk_id);
-
-    pmr_concurrent_vector<std::pair<bool, T>> values_and_nulls;
-    values_and_nulls.reserve(chunk->size());
-
-    materialize_values_and_nulls(*chunk->get_column(expression->column_id()), values_and_nulls);
+    result.values.resize(row_count);
+    result.nulls.resize(row_count);
+    auto contains_nulls = false;
+
+    const auto column = table->get_chunk(chunk_id)->get_column(expression->column_id());
+    resolve_column_type<T>(*column, [&](const auto& typed_column) {
+      auto chunk_offset = size_t{0};
+      create_iterable_from_column<T>(typed_column).for_each([&](const auto& value) {
+        result.values[chunk_offset] = value.value();
+        result.nulls[chunk_offset] = value.is_null();
+        contains_nulls |= value.is_null();
+        ++chunk_offset;
+      });
+    });
 
-    return values_and_nulls;
+    if (!contains_nulls) result.nulls.clear();
+    return result;
   }
 
   /**
@@ -275,11 +365,6 @@ const pmr_concurrent_vector<std::pair<bool, T>> Projection::_evaluate_expression
    */
   Assert(expression->is_arithmetic_operator(), "Projection only supports literals, column refs and arithmetics");
 
-  const auto& arithmetic_operator_function = function_for_arithmetic_expression<T>(expression->type());
-
-  pmr_concurrent_vector<std::pair<bool, T>> values;
-  values.resize(table->get_chunk(chunk_id)->size());
-
   const auto& left = expression->left_child();
   const auto& right = expression->right_child();
   const auto left_is_literal = left->type() == ExpressionType::Literal;
@@ -287,39 +372,78 @@ const pmr_concurrent_vector<std::pair<bool, T>> Projection::_evaluate_expression
 
   if ((left_is_literal && variant_is_null(left->value())) || (right_is_literal && variant_is_null(right->value()))) {
     // one of the operands is a literal null - early out.
-    std::fill(values.begin(), values.end(), std::make_pair(true, T{}));
-  } else if (left_is_literal && right_is_literal) {
-    std::fill(values.begin(), values.end(),
-              std::make_pair(
-                  false, arithmetic_operator_function(boost::get<T>(left->value()), boost::get<T>(right->value()))));
-  } else if (right_is_literal) {
-    auto left_values = _evaluate_expression<T>(left, table, chunk_id);
-    auto right_value = boost::get<T>(right->value());
-    // apply operator function to both vectors
-    auto func = [&](const std::pair<bool, T>& left_value) -> std::pair<bool, T> {
-      return std::make_pair(left_value.first, arithmetic_operator_function(left_value.second, right_value));
-    };
-    std::transform(left_values.begin(), left_values.end(), values.begin(), func);
-  } else if (left_is_literal) {
-    auto right_values = _evaluate_expression<T>(right, table, chunk_id);
-    auto left_value = boost::get<T>(left->value());
-    // apply operator function to both vectors
-    auto func = [&](const std::pair<bool, T>& right_value) -> std::pair<bool, T> {
-      return std::make_pair(right_value.first, arithmetic_operator_function(left_value, right_value.second));
-    };
-    std::transform(right_values.begin(), right_values.end(), values.begin(), func);
+    result.values.resize(row_count);
+    result.nulls.resize(row_count, true);
+    return result;
+  }
+
+  // Literal operands are broadcast instead of being materialized
+  auto left_values = EvaluatedExpression<T>{};
+  auto right_values = EvaluatedExpression<T>{};
+  auto left_value = T{};
+  auto right_value = T{};
+
+  if (left_is_literal) {
+    left_value = boost::get<T>(left->value());
   } else {
-    auto left_values = _evaluate_expression<T>(left, table, chunk_id);
-    auto right_values = _evaluate_expression<T>(right, table, chunk_id);
-
-    // apply operator function to both vectors
-    auto func = [&](const std::pair<bool, T>& left, const std::pair<bool, T>& right) -> std::pair<bool, T> {
-      return std::make_pair(left.first || right.first, arithmetic_operator_function(left.second, right.second));
-    };
-    std::transform(left_values.begin(), left_values.end(), right_values.begin(), values.begin(), func);
+    left_values = _evaluate_expression<T>(left, table, chunk_id);
   }
 
-  return values;
+  if (right_is_literal) {
+    right_value = boost::get<T>(right->value());
+  } else {
+    right_values = _evaluate_expression<T>(right, table, chunk_id);
+  }
+
+  // A row is NULL if one of its operands is NULL
+  if (!left_values.nulls.empty() && !right_values.nulls.empty()) {
+    result.nulls.resize(row_count);
+    for (auto row_idx = size_t{0}; row_idx < row_count; ++row_idx) {
+      result.nulls[row_idx] = left_values.nulls[row_idx] || right_values.nulls[row_idx];
+    }
+  } else if (!left_values.nulls.empty()) {
+    result.nulls = std::move(left_values.nulls);
+  } else if (!right_values.nulls.empty()) {
+    result.nulls = std::move(right_values.nulls);
+  }
+
+  if constexpr (std::is_integral_v<T>) {
+    if (expression->type() == ExpressionType::Division || expression->type() == ExpressionType::Modulo) {
+      // The kernels return 0 for divisions by 0, which are only legal for rows that are NULL anyway
+      const auto is_zero_divisor = [&](const size_t row_idx) {
+        if (!result.nulls.empty() && result.nulls[row_idx]) return false;
+        return (right_is_literal ? right_value : right_values.values[row_idx]) == 0;
+      };
+
+      for (auto row_idx = size_t{0}; row_idx < row_count; ++row_idx) {
+        if (is_zero_divisor(row_idx)) throw std::runtime_error("Cannot divide integers by 0.");
+      }
+    }
+  }
+
+  result.values.resize(row_count);
+
+  resolve_arithmetic_operator<T>(expression->type(), [&](const auto& arithmetic_operator) {
+    auto& values = result.values;
+
+    if (left_is_literal && right_is_literal) {
+      std::fill(values.begin(), values.end(), arithmetic_operator(left_value, right_value));
+    } else if (right_is_literal) {
+      for (auto row_idx = size_t{0}; row_idx < row_count; ++row_idx) {
+        values[row_idx] = arithmetic_operator(left_values.values[row_idx], right_value);
+      }
+    } else if (left_is_literal) {
+      for (auto row_idx = size_t{0}; row_idx < row_count; ++row_idx) {
+        values[row_idx] = arithmetic_operator(left_value, right_values.values[row_idx]);
+      }
+    } else {
+      for (auto row_idx = size_t{0}; row_idx < row_count; ++row_idx) {
+        values[row_idx] = arithmetic_operator(left_values.values[row_idx], right_values.values[row_idx]);
+      }
+    }
+  });
+
+  return result;
 }
 
 // returns the singleton dummy table used for literal projections
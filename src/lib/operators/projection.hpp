@@ -33,6 +33,9 @@ class Projection : public AbstractReadOnlyOperator {
 
   const ColumnExpressions& column_expressions() const;
 
+  // Subselects whose result table is not known yet
+  std::vector<std::shared_ptr<AbstractOperator>> subselect_operators() const override;
+
   /**
    * The dummy table is used for literal projections that have no input table.
    * This was introduce to allow queries like INSERT INTO tbl VALUES (1, 2, 3);
@@ -51,6 +54,11 @@ class Projection : public AbstractReadOnlyOperator {
 
   static std::shared_ptr<Table> dummy_table();
 
+  bool is_pipelineable() const override;
+
+  // Computed columns are always data columns. Forwarded columns are data columns if the input has data columns.
+  bool pipeline_outputs_data_columns() const override;
+
  protected:
   ColumnExpressions _column_expressions;
 
@@ -63,20 +71,44 @@ class Projection : public AbstractReadOnlyOperator {
   static DataType _get_type_of_expression(const std::shared_ptr<PQPExpression>& expression,
                                           const std::shared_ptr<const Table>& table);
 
+  /**
+   * The values of an expression evaluated on an entire chunk, stored column-wise. nulls is empty if none of the values
+   * can be NULL, so that the NULL handling can be skipped entirely.
+   */
+  template <typename T>
+  struct EvaluatedExpression {
+    std::vector<T> values;
+    std::vector<bool> nulls;
+  };
+
   /**
    * This function evaluates the given expression on a single chunk.
-   * It returns a vector containing the materialized values resulting from the expression.
+   * Every node of the expression tree is evaluated for all rows of the chunk at once, using a kernel that is resolved
+   * once per chunk and operates on the contiguous vectors of its operands. Literal operands are not materialized.
    */
   template <typename T>
-  static const pmr_concurrent_vector<std::pair<bool, T>> _evaluate_expression(
-      const std::shared_ptr<PQPExpression>& expression, const std::shared_ptr<const Table> table,
-      const ChunkID chunk_id);
+  static EvaluatedExpression<T> _evaluate_expression(const std::shared_ptr<PQPExpression>& expression,
+                                                     const std::shared_ptr<const Table>& table,
+                                                     const ChunkID chunk_id);
 
   std::shared_ptr<const Table> _on_execute() override;
 
+  std::shared_ptr<Table> _on_pipeline_begin(const std::shared_ptr<const Table>& input_table) override;
+  ChunkColumns _on_execute_chunk(const std::shared_ptr<const Table>& input_table, const ChunkID chunk_id) override;
+
+  // Executes subselects and creates the empty output table. Sets _reuse_columns_from_input.
+  std::shared_ptr<Table> _create_output_table(const std::shared_ptr<const Table>& input_table);
+
+  ChunkColumns _project_chunk(const std::shared_ptr<const Table>& input_table, const ChunkID chunk_id) const;
+
   std::shared_ptr<AbstractOperator> _on_recreate(
       const std::vector<AllParameterVariant>& args, const std::shared_ptr<AbstractOperator>& recreated_input_left,
       const std::shared_ptr<AbstractOperator>& recreated_input_right) const override;
+
+ private:
+  // Both are set by _create_output_table()
+  bool _reuse_columns_from_input{true};
+  TableColumnDefinitions _output_column_definitions;
 };
 
 }  // namespace opossum
@@ -1,7 +1,12 @@
 #include "sort.hpp"
 
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <fstream>
 #include <functional>
 #include <memory>
+#include <queue>
 #include <string>
 #include <utility>
 #include <vector>
@@ -9,32 +14,40 @@
 #include "storage/column_iterables/chunk_offset_mapping.hpp"
 #include "storage/reference_column.hpp"
 #include "storage/value_column.hpp"
+#include "utils/assert.hpp"
+#include "utils/filesystem.hpp"
 
 namespace opossum {
 
 Sort::Sort(const std::shared_ptr<const AbstractOperator> in, const ColumnID column_id, const OrderByMode order_by_mode,
-           const size_t output_chunk_size)
+           const size_t output_chunk_size, const std::optional<size_t> memory_budget,
+           const std::string& spill_directory)
     : AbstractReadOnlyOperator(OperatorType::Sort, in),
       _column_id(column_id),
       _order_by_mode(order_by_mode),
-      _output_chunk_size(output_chunk_size) {}
+      _output_chunk_size(output_chunk_size),
+      _memory_budget(memory_budget),
+      _spill_directory(spill_directory) {}
 
 ColumnID Sort::column_id() const { return _column_id; }
 
 OrderByMode Sort::order_by_mode() const { return _order_by_mode; }
 
+const std::optional<size_t>& Sort::memory_budget() const { return _memory_budget; }
+
 const std::string Sort::name() const { return "Sort"; }
 
 std::shared_ptr<AbstractOperator> Sort::_on_recreate(
     const std::vector<AllParameterVariant>& args, const std::shared_ptr<AbstractOperator>& recreated_input_left,
     const std::shared_ptr<AbstractOperator>& recreated_input_right) const {
-  return std::make_shared<Sort>(recreated_input_left, _column_id, _order_by_mode, _output_chunk_size);
+  return std::make_shared<Sort>(recreated_input_left, _column_id, _order_by_mode, _output_chunk_size, _memory_budget,
+                                _spill_directory);
 }
 
 std::shared_ptr<const Table> Sort::_on_execute() {
   _impl = make_unique_by_data_type<AbstractReadOnlyOperatorImpl, SortImpl>(
       input_table_left()->column_data_type(_column_id), input_table_left(), _column_id, _order_by_mode,
-      _output_chunk_size);
+      _output_chunk_size, _memory_budget, _spill_directory);
   return _impl->_on_execute();
 }
 
@@ -126,6 +139,60 @@ class Sort::SortImplMaterializeOutput {
   const std::shared_ptr<std::vector<std::pair<RowID, SortColumnType>>> _row_id_value_vector;
 };
 
+// Reads and writes the RowID-value pairs of the runs spilled by an external sort
+namespace {
+
+template <typename T>
+void write_run_entry(std::ofstream& stream, const RowID& row_id, const T& value) {
+  stream.write(reinterpret_cast<const char*>(&row_id), sizeof(RowID));
+
+  if constexpr (std::is_same_v<T, std::string>) {
+    const auto length = static_cast<StringLength>(value.size());
+    stream.write(reinterpret_cast<const char*>(&length), sizeof(StringLength));
+    stream.write(value.data(), length);
+  } else {
+    stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+  }
+}
+
+template <typename T>
+bool read_run_entry(std::ifstream& stream, RowID& row_id, T& value) {
+  if (!stream.read(reinterpret_cast<char*>(&row_id), sizeof(RowID))) return false;
+
+  if constexpr (std::is_same_v<T, std::string>) {
+    auto length = StringLength{0};
+    stream.read(reinterpret_cast<char*>(&length), sizeof(StringLength));
+    value.resize(length);
+    stream.read(value.data(), length);
+  } else {
+    stream.read(reinterpret_cast<char*>(&value), sizeof(T));
+  }
+
+  Assert(stream.good(), "Sort run file is corrupted");
+  return true;
+}
+
+// Creates an empty file with a unique name, so that concurrent Sorts (also those of other processes) never share files
+filesystem::path create_spill_file(const filesystem::path& directory, const std::string& prefix) {
+  auto path = (directory / (prefix + "_XXXXXX")).string();
+  const auto file_descriptor = ::mkstemp(path.data());
+  Assert(file_descriptor >= 0, "Could not create sort spill file in " + directory.string());
+  ::close(file_descriptor);
+  return path;
+}
+
+// Estimates the memory used by one RowID-value pair in the materialized sort column
+template <typename T>
+size_t row_id_value_pair_size(const T& value) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    return sizeof(std::pair<RowID, T>) + value.size();
+  } else {
+    return sizeof(std::pair<RowID, T>);
+  }
+}
+
+}  // namespace
+
 // we need to use the impl pattern because the scan operator of the sort depends on the type of the column
 template <typename SortColumnType>
 class Sort::SortImpl : public AbstractReadOnlyOperatorImpl {
@@ -133,31 +200,42 @@ class Sort::SortImpl : public AbstractReadOnlyOperatorImpl {
   using RowIDValuePair = std::pair<RowID, SortColumnType>;
 
   SortImpl(const std::shared_ptr<const Table> table_in, const ColumnID column_id,
-           const OrderByMode order_by_mode = OrderByMode::Ascending, const size_t output_chunk_size = 0)
+           const OrderByMode order_by_mode = OrderByMode::Ascending, const size_t output_chunk_size = 0,
+           const std::optional<size_t> memory_budget = std::nullopt, const std::string& spill_directory = "")
       : _table_in(table_in),
         _column_id(column_id),
         _order_by_mode(order_by_mode),
-        _output_chunk_size(output_chunk_size) {
+        _output_chunk_size(output_chunk_size),
+        _memory_budget(memory_budget),
+        _spill_directory(spill_directory.empty() ? filesystem::temp_directory_path()
+                                                 : filesystem::path{spill_directory}) {
     // initialize a structure which can be sorted by std::sort
     _row_id_value_vector = std::make_shared<std::vector<RowIDValuePair>>();
     _null_value_rows = std::make_shared<std::vector<RowIDValuePair>>();
   }
 
+  ~SortImpl() override {
+    for (const auto& run_path : _run_paths) {
+      filesystem::remove(run_path);
+    }
+    if (!_null_rows_path.empty()) filesystem::remove(_null_rows_path);
+  }
+
   std::shared_ptr<const Table> _on_execute() override {
     // 1. Prepare Sort: Creating rowid-value-Structure
     _materialize_sort_column();
 
-    // 2. After we got our ValueRowID Map we sort the map by the value of the pair
-    if (_order_by_mode == OrderByMode::Ascending || _order_by_mode == OrderByMode::AscendingNullsLast) {
-      sort_with_operator<std::less<>>();
-    } else {
-      sort_with_operator<std::greater<>>();
+    // If the sort column did not fit into the memory budget, it has been spilled as sorted runs (and NULL rows)
+    if (_is_spilled()) {
+      return _merge_runs();
     }
 
+    // 2. After we got our ValueRowID Map we sort the map by the value of the pair
+    _sort_row_id_value_vector();
+
     // 2b. Insert null rows if necessary
     if (_null_value_rows->size()) {
-      if (_order_by_mode == OrderByMode::AscendingNullsLast || _order_by_mode == OrderByMode::DescendingNullsLast) {
-        // NULLs last
+      if (_nulls_last()) {
         _row_id_value_vector->insert(_row_id_value_vector->end(), _null_value_rows->begin(), _null_value_rows->end());
       } else {
         // NULLs first (default behavior)
@@ -175,9 +253,13 @@ class Sort::SortImpl : public AbstractReadOnlyOperatorImpl {
   // completely materializes the sort column to create a vector of RowID-Value pairs
   void _materialize_sort_column() {
     auto& row_id_value_vector = *_row_id_value_vector;
-    row_id_value_vector.reserve(_table_in->row_count());
+    // Do not reserve more than the memory budget allows, spilled runs leave the vector's capacity untouched
+    const auto max_row_count =
+        _memory_budget ? std::max(*_memory_budget / sizeof(RowIDValuePair), size_t{1}) : _table_in->row_count();
+    row_id_value_vector.reserve(std::min<size_t>(_table_in->row_count(), max_row_count));
 
     auto& null_value_rows = *_null_value_rows;
+    auto materialized_bytes = size_t{0};
 
     for (ChunkID chunk_id{0}; chunk_id < _table_in->chunk_count(); ++chunk_id) {
       auto chunk = _table_in->get_chunk(chunk_id);
@@ -190,12 +272,44 @@ class Sort::SortImpl : public AbstractReadOnlyOperatorImpl {
         iterable.for_each([&](const auto& value) {
           if (value.is_null()) {
             null_value_rows.emplace_back(RowID{chunk_id, value.chunk_offset()}, SortColumnType{});
+            if (!_memory_budget) return;
+            materialized_bytes += sizeof(RowIDValuePair);
           } else {
             row_id_value_vector.emplace_back(RowID{chunk_id, value.chunk_offset()}, value.value());
+            if (!_memory_budget) return;
+            materialized_bytes += row_id_value_pair_size(value.value());
+          }
+
+          if (materialized_bytes >= *_memory_budget) {
+            _spill();
+            materialized_bytes = 0;
           }
         });
       });
     }
+
+    // The remaining rows are spilled as well, so that all runs can be merged uniformly
+    if (_is_spilled() && (!row_id_value_vector.empty() || !null_value_rows.empty())) {
+      _spill();
+    }
+  }
+
+  bool _is_spilled() const { return !_run_paths.empty() || !_null_rows_path.empty(); }
+
+  bool _nulls_last() const {
+    return _order_by_mode == OrderByMode::AscendingNullsLast || _order_by_mode == OrderByMode::DescendingNullsLast;
+  }
+
+  bool _ascending() const {
+    return _order_by_mode == OrderByMode::Ascending || _order_by_mode == OrderByMode::AscendingNullsLast;
+  }
+
+  void _sort_row_id_value_vector() {
+    if (_ascending()) {
+      sort_with_operator<std::less<>>();
+    } else {
+      sort_with_operator<std::greater<>>();
+    }
   }
 
   template <typename Comparator>
@@ -205,6 +319,119 @@ class Sort::SortImpl : public AbstractReadOnlyOperatorImpl {
                      [comparator](RowIDValuePair a, RowIDValuePair b) { return comparator(a.second, b.second); });
   }
 
+  /**
+   * Sorts the rows materialized so far and writes them to a new run file. NULL rows do not have to be sorted, their
+   * RowIDs are appended to a single file in the order of the input.
+   */
+  void _spill() {
+    if (!_row_id_value_vector->empty()) {
+      _sort_row_id_value_vector();
+
+      const auto run_path = create_spill_file(_spill_directory, "hyrise_sort_run");
+      _run_paths.emplace_back(run_path);
+
+      std::ofstream run_file(run_path, std::ios::binary | std::ios::trunc);
+      Assert(run_file.is_open(), "Could not open sort run file " + run_path.string());
+      for (const auto& [row_id, value] : *_row_id_value_vector) {
+        write_run_entry(run_file, row_id, value);
+      }
+      Assert(run_file.good(), "Could not write sort run file " + run_path.string());
+
+      _row_id_value_vector->clear();
+    }
+
+    if (!_null_value_rows->empty()) {
+      if (_null_rows_path.empty()) _null_rows_path = create_spill_file(_spill_directory, "hyrise_sort_nulls");
+
+      std::ofstream null_rows_file(_null_rows_path, std::ios::binary | std::ios::app);
+      Assert(null_rows_file.is_open(), "Could not open sort NULL rows file " + _null_rows_path.string());
+      for (const auto& null_row : *_null_value_rows) {
+        null_rows_file.write(reinterpret_cast<const char*>(&null_row.first), sizeof(RowID));
+      }
+      Assert(null_rows_file.good(), "Could not write sort NULL rows file " + _null_rows_path.string());
+
+      _null_value_rows->clear();
+    }
+  }
+
+  // k-way merges the spilled runs. The output is materialized row by row, so the merged runs are never held in memory.
+  std::shared_ptr<const Table> _merge_runs() {
+    auto output = std::make_shared<Table>(_table_in->column_definitions(), TableType::Data, _output_chunk_size);
+
+    ChunkColumns output_columns;
+    const auto append_row = [&](const RowID& row_id) {
+      if (output_columns.empty()) {
+        for (ColumnID column_id{0}; column_id < output->column_count(); ++column_id) {
+          output_columns.emplace_back(
+              make_shared_by_data_type<BaseColumn, ValueColumn>(output->column_data_type(column_id), true));
+        }
+      }
+
+      const auto chunk_in = _table_in->get_chunk(row_id.chunk_id);
+      for (ColumnID column_id{0}; column_id < output->column_count(); ++column_id) {
+        output_columns[column_id]->append((*chunk_in->get_column(column_id))[row_id.chunk_offset]);
+      }
+
+      if (output_columns.front()->size() >= _output_chunk_size) {
+        output->append_chunk(output_columns);
+        output_columns.clear();
+      }
+    };
+
+    const auto append_null_rows = [&]() {
+      if (_null_rows_path.empty()) return;
+
+      std::ifstream null_rows_file(_null_rows_path, std::ios::binary);
+      Assert(null_rows_file.is_open(), "Could not open sort NULL rows file " + _null_rows_path.string());
+      auto row_id = RowID{};
+      while (null_rows_file.read(reinterpret_cast<char*>(&row_id), sizeof(RowID))) {
+        append_row(row_id);
+      }
+    };
+
+    if (!_nulls_last()) append_null_rows();
+
+    // The head of each run is kept in a heap. Rows with the same value are taken from the earlier run first, which
+    // keeps the sort stable because runs are created in the order of the input.
+    auto run_files = std::vector<std::ifstream>{};
+    auto run_heads = std::vector<RowIDValuePair>(_run_paths.size());
+    for (const auto& run_path : _run_paths) {
+      run_files.emplace_back(run_path, std::ios::binary);
+      Assert(run_files.back().is_open(), "Could not open sort run file " + run_path.string());
+    }
+
+    const auto ascending = _ascending();
+    const auto comes_later = [&](const size_t lhs, const size_t rhs) {
+      const auto& lhs_value = run_heads[lhs].second;
+      const auto& rhs_value = run_heads[rhs].second;
+      if (lhs_value == rhs_value) return lhs > rhs;
+      return ascending ? lhs_value > rhs_value : lhs_value < rhs_value;
+    };
+    auto merge_heap = std::priority_queue<size_t, std::vector<size_t>, decltype(comes_later)>{comes_later};
+
+    for (auto run_index = size_t{0}; run_index < run_files.size(); ++run_index) {
+      auto& [row_id, value] = run_heads[run_index];
+      if (read_run_entry(run_files[run_index], row_id, value)) merge_heap.push(run_index);
+    }
+
+    while (!merge_heap.empty()) {
+      const auto run_index = merge_heap.top();
+      merge_heap.pop();
+
+      auto& [row_id, value] = run_heads[run_index];
+      append_row(row_id);
+      if (read_run_entry(run_files[run_index], row_id, value)) merge_heap.push(run_index);
+    }
+
+    if (_nulls_last()) append_null_rows();
+
+    if (!output_columns.empty()) {
+      output->append_chunk(output_columns);
+    }
+
+    return output;
+  }
+
   const std::shared_ptr<const Table> _table_in;
 
   // column to sort by
@@ -213,6 +440,12 @@ class Sort::SortImpl : public AbstractReadOnlyOperatorImpl {
   // chunk size of the materialized output
   const size_t _output_chunk_size;
 
+  // maximum size of the materialized sort column (including NULL rows) before it is spilled to _spill_directory
+  const std::optional<size_t> _memory_budget;
+  const filesystem::path _spill_directory;
+  std::vector<filesystem::path> _run_paths;
+  filesystem::path _null_rows_path;
+
   std::shared_ptr<std::vector<RowIDValuePair>> _row_id_value_vector;
   std::shared_ptr<std::vector<RowIDValuePair>> _null_value_rows;
 };
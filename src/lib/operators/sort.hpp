@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <functional>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -18,15 +19,23 @@ namespace opossum {
  * Operator to sort a table by a single column. This implements a stable sort, i.e., rows that share the same value will
  * maintain their relative order.
  * Multi-column sort is not supported yet. For now, you will have to sort by the secondary criterion, then by the first
+ *
+ * If a memory budget is given and the materialized sort column (i.e., the RowID-value pairs, including those of NULL
+ * rows) exceeds it, the Sort turns into an external merge sort: Sorted runs of at most memory_budget bytes are spilled
+ * to uniquely named files in spill_directory (the system's temp directory by default) and k-way merged afterwards,
+ * streaming the result into the output chunks. The RowIDs of NULL rows are spilled to a file of their own. SQL queries
+ * get a budget via SQLPipelineBuilder::with_sort_memory_budget().
  */
 class Sort : public AbstractReadOnlyOperator {
  public:
   // The parameter chunk_size sets the chunk size of the output table, which will always be materialized
   Sort(const std::shared_ptr<const AbstractOperator> in, const ColumnID column_id,
-       const OrderByMode order_by_mode = OrderByMode::Ascending, const size_t output_chunk_size = Chunk::MAX_SIZE);
+       const OrderByMode order_by_mode = OrderByMode::Ascending, const size_t output_chunk_size = Chunk::MAX_SIZE,
+       const std::optional<size_t> memory_budget = std::nullopt, const std::string& spill_directory = "");
 
   ColumnID column_id() const;
   OrderByMode order_by_mode() const;
+  const std::optional<size_t>& memory_budget() const;
 
   const std::string name() const override;
 
@@ -49,6 +58,8 @@ class Sort : public AbstractReadOnlyOperator {
   const ColumnID _column_id;
   const OrderByMode _order_by_mode;
   const size_t _output_chunk_size;
+  const std::optional<size_t> _memory_budget;
+  const std::string _spill_directory;
 };
 
 }  // namespace opossum
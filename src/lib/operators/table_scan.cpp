@@ -119,81 +119,109 @@ std::shared_ptr<const Table> TableScan::_on_execute() {
     if (excluded_chunk_set.count(chunk_id)) continue;
 
     auto job_task = std::make_shared<JobTask>([=, &output_mutex]() {
+      if (_is_cancelled()) return;
+
       const auto chunk_guard = _in_table->get_chunk_with_access_counting(chunk_id);
-      // The actual scan happens in the sub classes of BaseTableScanImpl
-      const auto matches_out = std::make_shared<PosList>(_impl->scan_chunk(chunk_id));
-      if (matches_out->empty()) return;
+      const auto out_columns = _scan_chunk(*_impl, _in_table, chunk_id);
+      if (out_columns.empty()) return;
 
       // The ChunkAccessCounter is reused to track accesses of the output chunk. Accesses of derived chunks are counted
       // towards the original chunk.
-      ChunkColumns out_columns;
+      std::lock_guard<std::mutex> lock(output_mutex);
+      _output_table->append_chunk(out_columns, chunk_guard->get_allocator(), chunk_guard->access_counter());
+    });
 
-      /**
-       * matches_out contains a list of row IDs into this chunk. If this is not a reference table, we can
-       * directly use the matches to construct the reference columns of the output. If it is a reference column,
-       * we need to resolve the row IDs so that they reference the physical data columns (value, dictionary) instead,
-       * since we don’t allow multi-level referencing. To save time and space, we want to share position lists
-       * between columns as much as possible. Position lists can be shared between two columns iff
-       * (a) they point to the same table and
-       * (b) the reference columns of the input table point to the same positions in the same order
-       *     (i.e. they share their position list).
-       */
-      if (_in_table->type() == TableType::References) {
-        const auto chunk_in = _in_table->get_chunk(chunk_id);
+    jobs.push_back(job_task);
+    // Scan the chunk on the node that holds its memory
+    job_task->schedule(_in_table->get_chunk(chunk_id)->numa_node_id());
+  }
 
-        auto filtered_pos_lists = std::map<std::shared_ptr<const PosList>, std::shared_ptr<PosList>>{};
+  CurrentScheduler::wait_for_tasks(jobs);
 
-        for (ColumnID column_id{0u}; column_id < _in_table->column_count(); ++column_id) {
-          auto column_in = chunk_in->get_column(column_id);
+  return _output_table;
+}
 
-          auto ref_column_in = std::dynamic_pointer_cast<const ReferenceColumn>(column_in);
-          DebugAssert(ref_column_in != nullptr, "All columns should be of type ReferenceColumn.");
+bool TableScan::is_pipelineable() const { return _excluded_chunk_ids.empty(); }
 
-          const auto pos_list_in = ref_column_in->pos_list();
+std::shared_ptr<Table> TableScan::_on_pipeline_begin(const std::shared_ptr<const Table>& input_table) {
+  _in_table = input_table;
+  _impl = _create_impl(_in_table);
 
-          const auto table_out = ref_column_in->referenced_table();
-          const auto column_id_out = ref_column_in->referenced_column_id();
+  return std::make_shared<Table>(input_table->column_definitions(), TableType::References);
+}
 
-          auto& filtered_pos_list = filtered_pos_lists[pos_list_in];
+ChunkColumns TableScan::_on_execute_chunk(const std::shared_ptr<const Table>& input_table, const ChunkID chunk_id) {
+  // Morsels that were produced by a previous operator of the pipeline come in tables of their own. They have the
+  // column definitions of the table passed to _on_pipeline_begin(), so the impl created there can scan them as well.
+  return _scan_chunk(*_impl, input_table, chunk_id);
+}
 
-          if (!filtered_pos_list) {
-            filtered_pos_list = std::make_shared<PosList>();
-            filtered_pos_list->reserve(matches_out->size());
+ChunkColumns TableScan::_scan_chunk(BaseTableScanImpl& impl, const std::shared_ptr<const Table>& in_table,
+                                   const ChunkID chunk_id) const {
+  // The actual scan happens in the sub classes of BaseTableScanImpl
+  const auto matches_out = std::make_shared<PosList>(impl.scan_chunk(*in_table->get_chunk(chunk_id), chunk_id));
+  if (matches_out->empty()) return {};
 
-            for (const auto& match : *matches_out) {
-              const auto row_id = (*pos_list_in)[match.chunk_offset];
-              filtered_pos_list->push_back(row_id);
-            }
-          }
+  ChunkColumns out_columns;
 
-          auto ref_column_out = std::make_shared<ReferenceColumn>(table_out, column_id_out, filtered_pos_list);
-          out_columns.push_back(ref_column_out);
-        }
-      } else {
-        for (ColumnID column_id{0u}; column_id < _in_table->column_count(); ++column_id) {
-          auto ref_column_out = std::make_shared<ReferenceColumn>(_in_table, column_id, matches_out);
-          out_columns.push_back(ref_column_out);
+  /**
+   * matches_out contains a list of row IDs into this chunk. If this is not a reference table, we can
+   * directly use the matches to construct the reference columns of the output. If it is a reference column,
+   * we need to resolve the row IDs so that they reference the physical data columns (value, dictionary) instead,
+   * since we don’t allow multi-level referencing. To save time and space, we want to share position lists
+   * between columns as much as possible. Position lists can be shared between two columns iff
+   * (a) they point to the same table and
+   * (b) the reference columns of the input table point to the same positions in the same order
+   *     (i.e. they share their position list).
+   */
+  if (in_table->type() == TableType::References) {
+    const auto chunk_in = in_table->get_chunk(chunk_id);
+
+    auto filtered_pos_lists = std::map<std::shared_ptr<const PosList>, std::shared_ptr<PosList>>{};
+
+    for (ColumnID column_id{0u}; column_id < in_table->column_count(); ++column_id) {
+      auto column_in = chunk_in->get_column(column_id);
+
+      auto ref_column_in = std::dynamic_pointer_cast<const ReferenceColumn>(column_in);
+      DebugAssert(ref_column_in != nullptr, "All columns should be of type ReferenceColumn.");
+
+      const auto pos_list_in = ref_column_in->pos_list();
+
+      const auto table_out = ref_column_in->referenced_table();
+      const auto column_id_out = ref_column_in->referenced_column_id();
+
+      auto& filtered_pos_list = filtered_pos_lists[pos_list_in];
+
+      if (!filtered_pos_list) {
+        filtered_pos_list = std::make_shared<PosList>();
+        filtered_pos_list->reserve(matches_out->size());
+
+        for (const auto& match : *matches_out) {
+          const auto row_id = (*pos_list_in)[match.chunk_offset];
+          filtered_pos_list->push_back(row_id);
         }
       }
 
-      std::lock_guard<std::mutex> lock(output_mutex);
-      _output_table->append_chunk(out_columns, chunk_guard->get_allocator(), chunk_guard->access_counter());
-    });
-
-    jobs.push_back(job_task);
-    job_task->schedule();
+      auto ref_column_out = std::make_shared<ReferenceColumn>(table_out, column_id_out, filtered_pos_list);
+      out_columns.push_back(ref_column_out);
+    }
+  } else {
+    for (ColumnID column_id{0u}; column_id < in_table->column_count(); ++column_id) {
+      auto ref_column_out = std::make_shared<ReferenceColumn>(in_table, column_id, matches_out);
+      out_columns.push_back(ref_column_out);
+    }
   }
 
-  CurrentScheduler::wait_for_tasks(jobs);
-
-  return _output_table;
+  return out_columns;
 }
 
 void TableScan::_on_cleanup() { _impl.reset(); }
 
-void TableScan::_init_scan() {
+void TableScan::_init_scan() { _impl = _create_impl(_in_table); }
+
+std::unique_ptr<BaseTableScanImpl> TableScan::_create_impl(const std::shared_ptr<const Table>& in_table) const {
   if (_predicate_condition == PredicateCondition::Like || _predicate_condition == PredicateCondition::NotLike) {
-    const auto left_column_type = _in_table->column_data_type(_left_column_id);
+    const auto left_column_type = in_table->column_data_type(_left_column_id);
     Assert((left_column_type == DataType::String), "LIKE operator only applicable on string columns.");
 
     DebugAssert(is_variant(_right_parameter), "Right parameter must be variant.");
@@ -204,26 +232,24 @@ void TableScan::_init_scan() {
 
     const auto right_wildcard = type_cast<std::string>(right_value);
 
-    _impl = std::make_unique<LikeTableScanImpl>(_in_table, _left_column_id, _predicate_condition, right_wildcard);
-
-    return;
+    return std::make_unique<LikeTableScanImpl>(in_table, _left_column_id, _predicate_condition, right_wildcard);
   }
 
   if (_predicate_condition == PredicateCondition::IsNull || _predicate_condition == PredicateCondition::IsNotNull) {
-    _impl = std::make_unique<IsNullTableScanImpl>(_in_table, _left_column_id, _predicate_condition);
-    return;
+    return std::make_unique<IsNullTableScanImpl>(in_table, _left_column_id, _predicate_condition);
   }
 
   if (is_variant(_right_parameter)) {
     const auto right_value = boost::get<AllTypeVariant>(_right_parameter);
 
-    _impl = std::make_unique<SingleColumnTableScanImpl>(_in_table, _left_column_id, _predicate_condition, right_value);
-  } else /* is_column_name(_right_parameter) */ {
-    const auto right_column_id = boost::get<ColumnID>(_right_parameter);
-
-    _impl = std::make_unique<ColumnComparisonTableScanImpl>(_in_table, _left_column_id, _predicate_condition,
-                                                            right_column_id);
+    return std::make_unique<SingleColumnTableScanImpl>(in_table, _left_column_id, _predicate_condition, right_value);
   }
+
+  // Otherwise, _right_parameter is a ColumnID
+  const auto right_column_id = boost::get<ColumnID>(_right_parameter);
+
+  return std::make_unique<ColumnComparisonTableScanImpl>(in_table, _left_column_id, _predicate_condition,
+                                                         right_column_id);
 }
 
 }  // namespace opossum
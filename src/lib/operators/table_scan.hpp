@@ -47,9 +47,15 @@ class TableScan : public AbstractReadOnlyOperator {
   const std::string name() const override;
   const std::string description(DescriptionMode description_mode) const override;
 
+  // Chunks can be scanned independently of each other. Excluded chunks are not supported in pipelines.
+  bool is_pipelineable() const override;
+
  protected:
   std::shared_ptr<const Table> _on_execute() override;
 
+  std::shared_ptr<Table> _on_pipeline_begin(const std::shared_ptr<const Table>& input_table) override;
+  ChunkColumns _on_execute_chunk(const std::shared_ptr<const Table>& input_table, const ChunkID chunk_id) override;
+
   std::shared_ptr<AbstractOperator> _on_recreate(
       const std::vector<AllParameterVariant>& args, const std::shared_ptr<AbstractOperator>& recreated_input_left,
       const std::shared_ptr<AbstractOperator>& recreated_input_right) const override;
@@ -58,6 +64,12 @@ class TableScan : public AbstractReadOnlyOperator {
 
   void _init_scan();
 
+  std::unique_ptr<BaseTableScanImpl> _create_impl(const std::shared_ptr<const Table>& in_table) const;
+
+  // Scans a single chunk and returns the columns of the output chunk, or no columns if there are no matches
+  ChunkColumns _scan_chunk(BaseTableScanImpl& impl, const std::shared_ptr<const Table>& in_table,
+                           const ChunkID chunk_id) const;
+
  private:
   const ColumnID _left_column_id;
   const PredicateCondition _predicate_condition;
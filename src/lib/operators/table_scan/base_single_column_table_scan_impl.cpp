@@ -18,12 +18,11 @@ BaseSingleColumnTableScanImpl::BaseSingleColumnTableScanImpl(std::shared_ptr<con
                                                              const PredicateCondition predicate_condition)
     : BaseTableScanImpl{in_table, left_column_id, predicate_condition} {}
 
-PosList BaseSingleColumnTableScanImpl::scan_chunk(ChunkID chunk_id) {
-  const auto chunk = _in_table->get_chunk(chunk_id);
-  const auto left_column = chunk->get_column(_left_column_id);
+PosList BaseSingleColumnTableScanImpl::scan_chunk(const Chunk& chunk, const ChunkID chunk_id) {
+  const auto left_column = chunk.get_column(_left_column_id);
 
   auto matches_out = PosList{};
-  auto context = std::make_shared<Context>(chunk_id, matches_out);
+  auto context = std::make_shared<Context>(chunk, chunk_id, matches_out);
 
   left_column->visit(*this, context);
 
@@ -48,7 +47,8 @@ void BaseSingleColumnTableScanImpl::handle_column(const ReferenceColumn& left_co
 
     auto mapped_chunk_offsets_ptr = std::make_unique<ChunkOffsetsList>(std::move(mapped_chunk_offsets));
 
-    auto new_context = std::make_shared<Context>(chunk_id, matches_out, std::move(mapped_chunk_offsets_ptr));
+    auto new_context =
+        std::make_shared<Context>(context->_chunk, chunk_id, matches_out, std::move(mapped_chunk_offsets_ptr));
     referenced_column->visit(*this, new_context);
   }
 }
@@ -28,7 +28,7 @@ class BaseSingleColumnTableScanImpl : public BaseTableScanImpl, public ColumnVis
   BaseSingleColumnTableScanImpl(std::shared_ptr<const Table> in_table, const ColumnID left_column_id,
                                 const PredicateCondition predicate_condition);
 
-  PosList scan_chunk(ChunkID chunk_id) override;
+  PosList scan_chunk(const Chunk& chunk, const ChunkID chunk_id) override;
 
   void handle_column(const ReferenceColumn& left_column, std::shared_ptr<ColumnVisitableContext> base_context) override;
 
@@ -37,11 +37,18 @@ class BaseSingleColumnTableScanImpl : public BaseTableScanImpl, public ColumnVis
    * @brief the context used for the columns’ visitor pattern
    */
   struct Context : public ColumnVisitableContext {
-    Context(const ChunkID chunk_id, PosList& matches_out) : _chunk_id{chunk_id}, _matches_out{matches_out} {}
-
-    Context(const ChunkID chunk_id, PosList& matches_out, std::unique_ptr<ChunkOffsetsList> mapped_chunk_offsets)
-        : _chunk_id{chunk_id}, _matches_out{matches_out}, _mapped_chunk_offsets{std::move(mapped_chunk_offsets)} {}
-
+    Context(const Chunk& chunk, const ChunkID chunk_id, PosList& matches_out)
+        : _chunk{chunk}, _chunk_id{chunk_id}, _matches_out{matches_out} {}
+
+    Context(const Chunk& chunk, const ChunkID chunk_id, PosList& matches_out,
+            std::unique_ptr<ChunkOffsetsList> mapped_chunk_offsets)
+        : _chunk{chunk},
+          _chunk_id{chunk_id},
+          _matches_out{matches_out},
+          _mapped_chunk_offsets{std::move(mapped_chunk_offsets)} {}
+
+    // The scanned chunk of the input table, not the chunk referenced by a ReferenceColumn
+    const Chunk& _chunk;
     const ChunkID _chunk_id;
     PosList& _matches_out;
 
@@ -8,6 +8,7 @@
 
 namespace opossum {
 
+class Chunk;
 class Table;
 
 /**
@@ -21,7 +22,12 @@ class BaseTableScanImpl {
 
   virtual ~BaseTableScanImpl() = default;
 
-  virtual PosList scan_chunk(ChunkID chunk_id) = 0;
+  /**
+   * Scans @param chunk, which is the chunk @param chunk_id of the input table. The chunk is passed in so that a single
+   * impl can also scan the morsels of an OperatorPipeline, which come in tables of their own but have the column
+   * definitions of the input table. Table-wide structures (e.g., interval maps) are only used for the input table.
+   */
+  virtual PosList scan_chunk(const Chunk& chunk, const ChunkID chunk_id) = 0;
 
  protected:
   /**
@@ -21,11 +21,9 @@ ColumnComparisonTableScanImpl::ColumnComparisonTableScanImpl(std::shared_ptr<con
                                                              const ColumnID right_column_id)
     : BaseTableScanImpl{in_table, left_column_id, predicate_condition}, _right_column_id{right_column_id} {}
 
-PosList ColumnComparisonTableScanImpl::scan_chunk(ChunkID chunk_id) {
-  const auto chunk = _in_table->get_chunk(chunk_id);
-
-  const auto left_column = chunk->get_column(_left_column_id);
-  const auto right_column = chunk->get_column(_right_column_id);
+PosList ColumnComparisonTableScanImpl::scan_chunk(const Chunk& chunk, const ChunkID chunk_id) {
+  const auto left_column = chunk.get_column(_left_column_id);
+  const auto right_column = chunk.get_column(_right_column_id);
 
   auto matches_out = PosList{};
 
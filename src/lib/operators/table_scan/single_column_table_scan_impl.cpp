@@ -5,6 +5,7 @@
 #include <vector>
 
 #include "storage/base_dictionary_column.hpp"
+#include "storage/chunk.hpp"
 #include "storage/column_iterables/constant_value_iterable.hpp"
 #include "storage/column_iterables/create_iterable_from_attribute_vector.hpp"
 #include "storage/create_iterable_from_column.hpp"
@@ -24,7 +25,7 @@ SingleColumnTableScanImpl::SingleColumnTableScanImpl(std::shared_ptr<const Table
                                                      const AllTypeVariant& right_value)
     : BaseSingleColumnTableScanImpl{in_table, left_column_id, predicate_condition}, _right_value{right_value} {}
 
-PosList SingleColumnTableScanImpl::scan_chunk(ChunkID chunk_id) {
+PosList SingleColumnTableScanImpl::scan_chunk(const Chunk& chunk, const ChunkID chunk_id) {
   // early outs for specific NULL semantics
   if (variant_is_null(_right_value)) {
     /**
@@ -36,7 +37,7 @@ PosList SingleColumnTableScanImpl::scan_chunk(ChunkID chunk_id) {
     return PosList{};
   }
 
-  return BaseSingleColumnTableScanImpl::scan_chunk(chunk_id);
+  return BaseSingleColumnTableScanImpl::scan_chunk(chunk, chunk_id);
 }
 
 void SingleColumnTableScanImpl::handle_column(const BaseValueColumn& base_column,
@@ -68,7 +69,7 @@ void SingleColumnTableScanImpl::handle_column(const BaseValueColumn& base_column
 
   // ART scan
   if (_predicate_condition == PredicateCondition::Equals) {
-    auto index = _in_table->get_chunk(chunk_id)->get_art_index(_left_column_id);
+    auto index = context->_chunk.get_art_index(_left_column_id);
     if (index != nullptr) {
       //std::cout << "using ART" << std::endl;
       std::vector<AllTypeVariant> value_vector;
@@ -85,7 +86,7 @@ void SingleColumnTableScanImpl::handle_column(const BaseValueColumn& base_column
   // Check whether this chunk needs to be looked at by performing a filter query
   // CQF is only supported for ScanType::OpEquals
   if (_predicate_condition == PredicateCondition::Equals) {
-    auto cqf = _in_table->get_chunk(chunk_id)->get_filter(_left_column_id);
+    auto cqf = context->_chunk.get_filter(_left_column_id);
 
     /*
     if (cqf != nullptr) {
@@ -128,7 +129,7 @@ void SingleColumnTableScanImpl::handle_column(const BaseEncodedColumn& base_colu
 
   // ART scan
   if (_predicate_condition == PredicateCondition::Equals) {
-    auto index = _in_table->get_chunk(chunk_id)->get_art_index(_left_column_id);
+    auto index = context->_chunk.get_art_index(_left_column_id);
     if (index != nullptr) {
       //std::cout << "using ART" << std::endl;
       std::vector<AllTypeVariant> value_vector;
@@ -163,7 +164,7 @@ void SingleColumnTableScanImpl::handle_column(const BaseEncodedColumn& base_colu
   // Check whether this chunk needs to be looked at by performing a filter query
   // CQF is only supported for ScanType::OpEquals
   if (_predicate_condition == PredicateCondition::Equals) {
-    auto cqf = _in_table->get_chunk(chunk_id)->get_filter(_left_column_id);
+    auto cqf = context->_chunk.get_filter(_left_column_id);
 
     /*
     if (cqf != nullptr) {
@@ -219,7 +220,7 @@ void SingleColumnTableScanImpl::handle_column(const BaseDictionaryColumn& left_c
 
   // ART scan
   if (_predicate_condition == PredicateCondition::Equals) {
-    auto index = _in_table->get_chunk(chunk_id)->get_art_index(_left_column_id);
+    auto index = context->_chunk.get_art_index(_left_column_id);
     if (index != nullptr) {
       //std::cout << "using ART" << std::endl;
       std::vector<AllTypeVariant> value_vector;
@@ -254,7 +255,7 @@ void SingleColumnTableScanImpl::handle_column(const BaseDictionaryColumn& left_c
   // Check whether this chunk needs to be looked at by performing a filter query
   // CQF is only supported for ScanType::OpEquals
   if (_predicate_condition == PredicateCondition::Equals) {
-    auto cqf = _in_table->get_chunk(chunk_id)->get_filter(_left_column_id);
+    auto cqf = context->_chunk.get_filter(_left_column_id);
 
     /*
     if (cqf != nullptr) {
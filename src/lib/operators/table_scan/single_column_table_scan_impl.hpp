@@ -26,7 +26,7 @@ class SingleColumnTableScanImpl : public BaseSingleColumnTableScanImpl {
   SingleColumnTableScanImpl(std::shared_ptr<const Table> in_table, const ColumnID left_column_id,
                             const PredicateCondition& predicate_condition, const AllTypeVariant& right_value);
 
-  PosList scan_chunk(ChunkID) override;
+  PosList scan_chunk(const Chunk& chunk, const ChunkID chunk_id) override;
 
   void handle_column(const BaseValueColumn& base_column, std::shared_ptr<ColumnVisitableContext> base_context) override;
 
@@ -0,0 +1,221 @@
+#include "top_n.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "constant_mappings.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "statistics/chunk_statistics/chunk_statistics.hpp"
+#include "storage/create_iterable_from_column.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+TopN::TopN(const std::shared_ptr<const AbstractOperator> in, const ColumnID column_id, const OrderByMode order_by_mode,
+           const size_t num_rows, const size_t output_chunk_size)
+    : AbstractReadOnlyOperator(OperatorType::TopN, in),
+      _column_id(column_id),
+      _order_by_mode(order_by_mode),
+      _num_rows(num_rows),
+      _output_chunk_size(output_chunk_size) {}
+
+ColumnID TopN::column_id() const { return _column_id; }
+
+OrderByMode TopN::order_by_mode() const { return _order_by_mode; }
+
+size_t TopN::num_rows() const { return _num_rows; }
+
+const std::string TopN::name() const { return "TopN"; }
+
+const std::string TopN::description(DescriptionMode description_mode) const {
+  std::string column_name = std::string("Col #") + std::to_string(_column_id);
+
+  if (input_table_left()) column_name = input_table_left()->column_name(_column_id);
+
+  const auto separator = description_mode == DescriptionMode::MultiLine ? "\n" : " ";
+  return name() + separator + "(" + column_name + " " + order_by_mode_to_string.at(_order_by_mode) + ", " +
+         std::to_string(_num_rows) + " rows)";
+}
+
+std::shared_ptr<AbstractOperator> TopN::_on_recreate(
+    const std::vector<AllParameterVariant>& args, const std::shared_ptr<AbstractOperator>& recreated_input_left,
+    const std::shared_ptr<AbstractOperator>& recreated_input_right) const {
+  return std::make_shared<TopN>(recreated_input_left, _column_id, _order_by_mode, _num_rows, _output_chunk_size);
+}
+
+std::shared_ptr<const Table> TopN::_on_execute() {
+  _impl = make_unique_by_data_type<AbstractReadOnlyOperatorImpl, TopNImpl>(
+      input_table_left()->column_data_type(_column_id), input_table_left(), _column_id, _order_by_mode, _num_rows,
+      _output_chunk_size);
+  return _impl->_on_execute();
+}
+
+void TopN::_on_cleanup() { _impl.reset(); }
+
+template <typename SortColumnType>
+class TopN::TopNImpl : public AbstractReadOnlyOperatorImpl {
+ public:
+  // A row that might end up in the output. Candidates are ordered by their NULL-ness (depending on the OrderByMode),
+  // their value and finally their RowID. The latter makes the result identical to that of the stable Sort.
+  struct Candidate {
+    bool is_null;
+    SortColumnType value;
+    RowID row_id;
+  };
+
+  TopNImpl(const std::shared_ptr<const Table> table_in, const ColumnID column_id, const OrderByMode order_by_mode,
+           const size_t num_rows, const size_t output_chunk_size)
+      : _table_in(table_in),
+        _column_id(column_id),
+        _ascending(order_by_mode == OrderByMode::Ascending || order_by_mode == OrderByMode::AscendingNullsLast),
+        _nulls_last(order_by_mode == OrderByMode::AscendingNullsLast ||
+                    order_by_mode == OrderByMode::DescendingNullsLast),
+        _num_rows(num_rows),
+        _output_chunk_size(output_chunk_size) {}
+
+  std::shared_ptr<const Table> _on_execute() override {
+    const auto chunk_count = _table_in->chunk_count();
+
+    // 1. Determine the best rows of each chunk. The chunks are processed in parallel, each with its own heap.
+    auto candidates_by_chunk = std::vector<std::vector<Candidate>>(_num_rows > 0 ? chunk_count : 0u);
+
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    jobs.reserve(candidates_by_chunk.size());
+
+    for (ChunkID chunk_id{0}; chunk_id < candidates_by_chunk.size(); ++chunk_id) {
+      auto job_task = std::make_shared<JobTask>(
+          [this, chunk_id, &candidates_by_chunk]() { candidates_by_chunk[chunk_id] = _top_n_of_chunk(chunk_id); });
+
+      jobs.push_back(job_task);
+      job_task->schedule();
+    }
+
+    CurrentScheduler::wait_for_tasks(jobs);
+
+    // 2. Merge the per-chunk results
+    auto candidates = std::vector<Candidate>{};
+    for (auto& chunk_candidates : candidates_by_chunk) {
+      candidates.insert(candidates.end(), chunk_candidates.begin(), chunk_candidates.end());
+    }
+
+    const auto row_count_out = std::min(_num_rows, candidates.size());
+    std::partial_sort(candidates.begin(), candidates.begin() + row_count_out, candidates.end(),
+                      [&](const auto& lhs, const auto& rhs) { return _precedes(lhs, rhs); });
+    candidates.resize(row_count_out);
+
+    // 3. Materialize the output. As in Sort, we do not duplicate the MVCC columns.
+    auto output = std::make_shared<Table>(_table_in->column_definitions(), TableType::Data, _output_chunk_size);
+
+    for (const auto& candidate : candidates) {
+      const auto chunk = _table_in->get_chunk(candidate.row_id.chunk_id);
+
+      auto values = std::vector<AllTypeVariant>{};
+      values.reserve(output->column_count());
+      for (ColumnID column_id{0}; column_id < output->column_count(); ++column_id) {
+        values.emplace_back((*chunk->get_column(column_id))[candidate.row_id.chunk_offset]);
+      }
+
+      output->append(values);
+    }
+
+    return output;
+  }
+
+ protected:
+  std::vector<Candidate> _top_n_of_chunk(const ChunkID chunk_id) {
+    const auto chunk = _table_in->get_chunk(chunk_id);
+    const auto bound = _get_bound();
+
+    /**
+     * If we already know that the table contains _num_rows rows that are at least as good as the bound, the chunk can
+     * be skipped if its statistics prove that all of its values are worse. This is only possible if the chunk cannot
+     * contain NULLs that would be placed in front of these values, because the filters do not cover NULLs.
+     */
+    if (bound && (_nulls_last || !_table_in->column_is_nullable(_column_id))) {
+      const auto statistics = chunk->statistics();
+      const auto predicate_condition =
+          _ascending ? PredicateCondition::LessThanEquals : PredicateCondition::GreaterThanEquals;
+      if (statistics && statistics->can_prune(_column_id, AllTypeVariant{*bound}, predicate_condition)) {
+        return {};
+      }
+    }
+
+    const auto comparator = [&](const auto& lhs, const auto& rhs) { return _precedes(lhs, rhs); };
+
+    // Max-heap, i.e., the worst of the current candidates is at the front
+    auto heap = std::vector<Candidate>{};
+    heap.reserve(std::min<size_t>(_num_rows, chunk->size()));
+
+    const auto base_column = chunk->get_column(_column_id);
+    resolve_column_type<SortColumnType>(*base_column, [&](auto& typed_column) {
+      auto iterable = create_iterable_from_column<SortColumnType>(typed_column);
+
+      iterable.for_each([&](const auto& value) {
+        // Rows that are worse than the bound cannot be part of the result. This includes trailing NULLs.
+        if (bound && (value.is_null() ? _nulls_last : _value_precedes(*bound, value.value()))) return;
+
+        auto candidate = Candidate{value.is_null(), value.is_null() ? SortColumnType{} : value.value(),
+                                   RowID{chunk_id, value.chunk_offset()}};
+
+        if (heap.size() < _num_rows) {
+          heap.emplace_back(std::move(candidate));
+          std::push_heap(heap.begin(), heap.end(), comparator);
+        } else if (_precedes(candidate, heap.front())) {
+          std::pop_heap(heap.begin(), heap.end(), comparator);
+          heap.back() = std::move(candidate);
+          std::push_heap(heap.begin(), heap.end(), comparator);
+        }
+      });
+    });
+
+    if (heap.size() == _num_rows && !heap.front().is_null) {
+      _update_bound(heap.front().value);
+    }
+
+    return heap;
+  }
+
+  // Returns true if lhs would be placed before rhs by the Sort operator
+  bool _value_precedes(const SortColumnType& lhs, const SortColumnType& rhs) const {
+    return _ascending ? lhs < rhs : lhs > rhs;
+  }
+
+  bool _precedes(const Candidate& lhs, const Candidate& rhs) const {
+    if (lhs.is_null != rhs.is_null) return lhs.is_null != _nulls_last;
+    if (!lhs.is_null) {
+      if (_value_precedes(lhs.value, rhs.value)) return true;
+      if (_value_precedes(rhs.value, lhs.value)) return false;
+    }
+    return lhs.row_id < rhs.row_id;
+  }
+
+  std::optional<SortColumnType> _get_bound() {
+    std::lock_guard<std::mutex> lock(_bound_mutex);
+    return _bound;
+  }
+
+  // The worst of the _num_rows best values of any chunk bounds the values in the result of the entire table
+  void _update_bound(const SortColumnType& value) {
+    std::lock_guard<std::mutex> lock(_bound_mutex);
+    if (!_bound || _value_precedes(value, *_bound)) _bound = value;
+  }
+
+  const std::shared_ptr<const Table> _table_in;
+  const ColumnID _column_id;
+  const bool _ascending;
+  const bool _nulls_last;
+  const size_t _num_rows;
+  const size_t _output_chunk_size;
+
+  std::mutex _bound_mutex;
+  std::optional<SortColumnType> _bound;
+};
+
+}  // namespace opossum
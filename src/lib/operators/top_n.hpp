@@ -0,0 +1,52 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_read_only_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Operator that returns the first num_rows rows of its input as they would be ordered by a (stable) Sort on
+ * column_id. It is equivalent to Sort followed by Limit, but never sorts the entire input: every chunk is processed
+ * in its own JobTask that keeps a bounded heap of its num_rows best rows. The heaps are merged afterwards.
+ *
+ * As soon as one chunk has found num_rows rows, the worst of them is a valid bound for the whole table. Later chunks
+ * skip every value beyond that bound, and chunks whose ChunkStatistics (MinMaxFilter/RangeFilter) prove that no value
+ * is within the bound are not scanned at all.
+ *
+ * Like Sort, the output is a materialized data table.
+ */
+class TopN : public AbstractReadOnlyOperator {
+ public:
+  TopN(const std::shared_ptr<const AbstractOperator> in, const ColumnID column_id, const OrderByMode order_by_mode,
+       const size_t num_rows, const size_t output_chunk_size = Chunk::MAX_SIZE);
+
+  ColumnID column_id() const;
+  OrderByMode order_by_mode() const;
+  size_t num_rows() const;
+
+  const std::string name() const override;
+  const std::string description(DescriptionMode description_mode) const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+  void _on_cleanup() override;
+  std::shared_ptr<AbstractOperator> _on_recreate(
+      const std::vector<AllParameterVariant>& args, const std::shared_ptr<AbstractOperator>& recreated_input_left,
+      const std::shared_ptr<AbstractOperator>& recreated_input_right) const override;
+
+  template <typename SortColumnType>
+  class TopNImpl;
+
+  std::unique_ptr<AbstractReadOnlyOperatorImpl> _impl;
+  const ColumnID _column_id;
+  const OrderByMode _order_by_mode;
+  const size_t _num_rows;
+  const size_t _output_chunk_size;
+};
+
+}  // namespace opossum
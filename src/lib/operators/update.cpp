@@ -1,5 +1,6 @@
 #include "update.hpp"
 
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <utility>
@@ -8,13 +9,37 @@
 #include "concurrency/transaction_context.hpp"
 #include "delete.hpp"
 #include "insert.hpp"
+#include "logging/log_entry.hpp"
+#include "resolve_type.hpp"
 #include "storage/reference_column.hpp"
 #include "storage/storage_manager.hpp"
+#include "storage/value_column.hpp"
 #include "table_wrapper.hpp"
+#include "type_cast.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
 
+namespace {
+
+/**
+ * Returns the value of a row and whether it is NULL. ValueColumns of the requested type are read directly, other
+ * columns through AllTypeVariant.
+ */
+template <typename T>
+std::pair<T, bool> get_value(const BaseColumn& column, const ChunkOffset chunk_offset) {
+  if (const auto value_column = dynamic_cast<const ValueColumn<T>*>(&column)) {
+    if (value_column->is_nullable() && value_column->null_values()[chunk_offset]) return {T{}, true};
+    return {value_column->values()[chunk_offset], false};
+  }
+
+  const auto value = column[chunk_offset];
+  if (variant_is_null(value)) return {T{}, true};
+  return {type_cast<T>(value), false};
+}
+
+}  // namespace
+
 Update::Update(const std::string& table_to_update_name, std::shared_ptr<AbstractOperator> fields_to_update_op,
                std::shared_ptr<AbstractOperator> update_values_op)
     : AbstractReadWriteOperator(OperatorType::Update, fields_to_update_op, update_values_op),
@@ -25,30 +50,62 @@ Update::~Update() = default;
 const std::string Update::name() const { return "Update"; }
 
 std::shared_ptr<const Table> Update::_on_execute(std::shared_ptr<TransactionContext> context) {
+  // The Update itself only logs the rows it invalidates, everything else is committed, rolled back, and logged by the
+  // Insert and Delete operators. It is registered before them, but after the Inserts of the rows it might invalidate.
+  context->register_read_write_operator(std::static_pointer_cast<AbstractReadWriteOperator>(shared_from_this()));
+
   if (_input_left->get_output()->empty()) return nullptr;  // Subsequent code relies on there being at least one chunk
 
   DebugAssert((_execution_input_valid(context)), "Input to Update isn't valid");
 
   const auto table_to_update = StorageManager::get().get_table(_table_to_update_name);
+  const auto transaction_id = context->transaction_id();
 
-  // 1. Create insert_table with ReferenceColumns that contain all rows that should be updated
-  TableColumnDefinitions insert_table_column_definitions;
-  for (ColumnID column_id{0}; column_id < table_to_update->column_count(); ++column_id) {
-    insert_table_column_definitions.emplace_back(table_to_update->column_name(column_id),
-                                                 table_to_update->column_data_type(column_id));
+  // The columns of table_to_update that are updated, in the order of the columns of the input tables
+  auto updated_column_ids = std::vector<ColumnID>{};
+  const auto left_chunk = input_table_left()->get_chunk(ChunkID{0});
+  for (ColumnID column_id{0}; column_id < input_table_left()->column_count(); ++column_id) {
+    const auto left_col = std::static_pointer_cast<const ReferenceColumn>(left_chunk->get_column(column_id));
+    updated_column_ids.emplace_back(left_col->referenced_column_id());
   }
 
-  auto insert_table = std::make_shared<Table>(insert_table_column_definitions, TableType::References);
+  // Rows are usually referenced in order, so the last referenced chunk is cached
+  auto cached_chunk_id = INVALID_CHUNK_ID;
+  auto cached_chunk = std::shared_ptr<Chunk>{};
+  auto cached_chunk_allows_in_place_updates = false;
+  const auto get_chunk = [&](const ChunkID chunk_id) {
+    if (chunk_id != cached_chunk_id) {
+      cached_chunk_id = chunk_id;
+      cached_chunk = table_to_update->get_chunk(chunk_id);
+
+      // Fixed-width values can be overwritten while concurrent operators read the column. Strings could be
+      // reallocated while they are read.
+      cached_chunk_allows_in_place_updates =
+          std::all_of(updated_column_ids.cbegin(), updated_column_ids.cend(), [&](const ColumnID column_id) {
+            return table_to_update->column_data_type(column_id) != DataType::String &&
+                   std::dynamic_pointer_cast<const BaseValueColumn>(cached_chunk->get_column(column_id));
+          });
+    }
+    return cached_chunk;
+  };
+
+  // 1. Match the rows to update with the rows of input_table_right that contain their new values. Rows that have been
+  // inserted by this transaction (possibly as the new version of a previous update) are not visible to any other
+  // transaction. If possible, they are updated in place, and only the updated columns are written. All other rows get
+  // a new version, which consists of an Insert of the complete row and a Delete of the old one. Delete cannot lock
+  // rows that this transaction has inserted, so these are invalidated directly.
+  auto in_place_rows = std::vector<std::pair<RowID, RowID>>{};
+  auto versioned_rows = std::vector<std::pair<RowID, RowID>>{};
+  auto delete_pos_list = std::make_shared<PosList>();
 
   auto current_row_in_left_chunk = 0u;
   auto current_pos_list = std::shared_ptr<const PosList>();
   auto current_left_chunk_id = ChunkID{0};
 
   for (ChunkID chunk_id{0}; chunk_id < input_table_right()->chunk_count(); ++chunk_id) {
-    // Build poslists for mixed chunk numbers and sizes.
-    auto pos_list = std::make_shared<PosList>();
-    for (auto i = 0u; i < input_table_right()->get_chunk(chunk_id)->size(); ++i) {
-      if (current_pos_list == nullptr || current_row_in_left_chunk == current_pos_list->size()) {
+    const auto right_chunk_size = input_table_right()->get_chunk(chunk_id)->size();
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < right_chunk_size; ++chunk_offset) {
+      while (current_pos_list == nullptr || current_row_in_left_chunk == current_pos_list->size()) {
         current_row_in_left_chunk = 0u;
         current_pos_list = std::static_pointer_cast<const ReferenceColumn>(
                                input_table_left()->get_chunk(current_left_chunk_id)->get_column(ColumnID{0}))
@@ -56,47 +113,115 @@ std::shared_ptr<const Table> Update::_on_execute(std::shared_ptr<TransactionCont
         current_left_chunk_id++;
       }
 
-      pos_list->emplace_back((*current_pos_list)[current_row_in_left_chunk]);
+      const auto row_id = (*current_pos_list)[current_row_in_left_chunk];
       current_row_in_left_chunk++;
-    }
 
-    // Add ReferenceColumns with built poslist.
-    ChunkColumns insert_table_columns;
-    for (ColumnID column_id{0}; column_id < table_to_update->column_count(); ++column_id) {
-      insert_table_columns.push_back(std::make_shared<ReferenceColumn>(table_to_update, column_id, pos_list));
-    }
+      const auto chunk = get_chunk(row_id.chunk_id);
+      auto is_own_insert = false;
+      {
+        const auto mvcc_columns = chunk->mvcc_columns();
+        is_own_insert = mvcc_columns->begin_cids[row_id.chunk_offset] == MvccColumns::MAX_COMMIT_ID &&
+                        mvcc_columns->tids[row_id.chunk_offset].load() == transaction_id;
+      }
 
-    insert_table->append_chunk(insert_table_columns);
-  }
+      if (is_own_insert && cached_chunk_allows_in_place_updates) {
+        in_place_rows.emplace_back(row_id, RowID{chunk_id, chunk_offset});
+        continue;
+      }
 
-  // 2. Replace the columns to update in insert_table with the updated data from input_table_right
-  const auto left_chunk = input_table_left()->get_chunk(ChunkID{0});
-  for (ChunkID chunk_id{0}; chunk_id < insert_table->chunk_count(); ++chunk_id) {
-    auto insert_chunk = insert_table->get_chunk(chunk_id);
-    auto right_chunk = input_table_right()->get_chunk(chunk_id);
+      versioned_rows.emplace_back(row_id, RowID{chunk_id, chunk_offset});
+      if (is_own_insert) {
+        _invalidated_rows.emplace_back(row_id);
+      } else {
+        delete_pos_list->emplace_back(row_id);
+      }
+    }
+  }
 
-    for (ColumnID column_id{0}; column_id < input_table_left()->column_count(); ++column_id) {
-      auto right_col = right_chunk->get_mutable_column(column_id);
+  // 2. Overwrite the updated columns of the rows inserted by this transaction. Committing or rolling back these rows
+  // is up to the Insert that has inserted them.
+  for (ColumnID column_id{0}; column_id < input_table_right()->column_count(); ++column_id) {
+    const auto updated_column_id = updated_column_ids[column_id];
+
+    resolve_data_type(table_to_update->column_data_type(updated_column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      for (const auto& [row_id, value_row_id] : in_place_rows) {
+        const auto column = get_chunk(row_id.chunk_id)->get_mutable_column(updated_column_id);
+        auto& value_column = static_cast<ValueColumn<ColumnDataType>&>(*column);
+        const auto value_column_in = input_table_right()->get_chunk(value_row_id.chunk_id)->get_column(column_id);
+        const auto [value, is_null] = get_value<ColumnDataType>(*value_column_in, value_row_id.chunk_offset);
+
+        if (value_column.is_nullable()) {
+          value_column.null_values()[row_id.chunk_offset] = is_null;
+        } else {
+          Assert(!is_null, "Cannot update NOT NULL column with NULL");
+        }
+        value_column.values()[row_id.chunk_offset] = value;
+      }
+    });
+  }
 
-      auto left_col = std::dynamic_pointer_cast<const ReferenceColumn>(left_chunk->get_column(column_id));
+  if (versioned_rows.empty()) return nullptr;
 
-      insert_chunk->replace_column(left_col->referenced_column_id(), right_col);
-    }
+  // 3. Materialize the new versions of the remaining rows. The columns that are not updated are copied from the old
+  // versions. As the values are read with their actual type, the Insert can copy the resulting ValueColumns directly.
+  auto updated_column_by_column_id = std::vector<ColumnID>(table_to_update->column_count(), INVALID_COLUMN_ID);
+  for (ColumnID column_id{0}; column_id < updated_column_ids.size(); ++column_id) {
+    updated_column_by_column_id[updated_column_ids[column_id]] = column_id;
   }
 
-  // 3. call delete on old data.
-  _delete = std::make_shared<Delete>(_table_to_update_name, _input_left);
-
-  _delete->set_transaction_context(context);
+  auto insert_table = std::make_shared<Table>(table_to_update->column_definitions(), TableType::Data);
+  ChunkColumns insert_table_columns;
+  for (ColumnID column_id{0}; column_id < table_to_update->column_count(); ++column_id) {
+    const auto updated_column = updated_column_by_column_id[column_id];
+
+    resolve_data_type(table_to_update->column_data_type(column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      auto values = pmr_concurrent_vector<ColumnDataType>{};
+      auto null_values = pmr_concurrent_vector<bool>{};
+      values.reserve(versioned_rows.size());
+      null_values.reserve(versioned_rows.size());
+
+      for (const auto& [row_id, value_row_id] : versioned_rows) {
+        const auto [value, is_null] =
+            updated_column != INVALID_COLUMN_ID
+                ? get_value<ColumnDataType>(
+                      *input_table_right()->get_chunk(value_row_id.chunk_id)->get_column(updated_column),
+                      value_row_id.chunk_offset)
+                : get_value<ColumnDataType>(*get_chunk(row_id.chunk_id)->get_column(column_id), row_id.chunk_offset);
+        values.push_back(value);
+        null_values.push_back(is_null);
+      }
 
-  _delete->execute();
+      if (table_to_update->column_is_nullable(column_id)) {
+        insert_table_columns.push_back(
+            std::make_shared<ValueColumn<ColumnDataType>>(std::move(values), std::move(null_values)));
+      } else {
+        Assert(std::none_of(null_values.cbegin(), null_values.cend(), [](const bool is_null) { return is_null; }),
+               "Cannot update NOT NULL column with NULL");
+        insert_table_columns.push_back(std::make_shared<ValueColumn<ColumnDataType>>(std::move(values)));
+      }
+    });
+  }
+  insert_table->append_chunk(insert_table_columns);
+
+  // 4. Invalidate the old versions of rows inserted by this transaction. An end_cid of 0 hides them from everyone,
+  // also after their Insert has committed. If the transaction is rolled back, the Insert rolls them back anyway.
+  for (const auto& row_id : _invalidated_rows) {
+    auto mvcc_columns = get_chunk(row_id.chunk_id)->mvcc_columns();
+    mvcc_columns->end_cids[row_id.chunk_offset] = 0u;
+    mvcc_columns->update_min_end_cid(0u);
+  }
 
-  if (_delete->execute_failed()) {
-    _mark_as_failed();
-    return nullptr;
+  // 5. call delete on old versions of the other rows.
+  if (!delete_pos_list->empty()) {
+    _delete_rows(context, table_to_update, delete_pos_list);
+    if (execute_failed()) return nullptr;
   }
 
-  // 4. call insert using insert_table.
+  // 6. call insert using insert_table.
   auto helper_operator = std::make_shared<TableWrapper>(insert_table);
   helper_operator->execute();
 
@@ -108,6 +233,36 @@ std::shared_ptr<const Table> Update::_on_execute(std::shared_ptr<TransactionCont
   return nullptr;
 }
 
+void Update::_delete_rows(const std::shared_ptr<TransactionContext>& context,
+                          const std::shared_ptr<const Table>& table_to_update,
+                          const std::shared_ptr<const PosList>& delete_pos_list) {
+  auto delete_table = std::make_shared<Table>(table_to_update->column_definitions(), TableType::References);
+  ChunkColumns delete_table_columns;
+  for (ColumnID column_id{0}; column_id < table_to_update->column_count(); ++column_id) {
+    delete_table_columns.push_back(std::make_shared<ReferenceColumn>(table_to_update, column_id, delete_pos_list));
+  }
+  delete_table->append_chunk(delete_table_columns);
+
+  auto rows_to_delete = std::make_shared<TableWrapper>(delete_table);
+  rows_to_delete->execute();
+
+  _delete = std::make_shared<Delete>(_table_to_update_name, rows_to_delete);
+
+  _delete->set_transaction_context(context);
+
+  _delete->execute();
+
+  if (_delete->execute_failed()) {
+    _mark_as_failed();
+  }
+}
+
+void Update::_on_log_records(LogEntry& log_entry) const {
+  for (const auto& row_id : _invalidated_rows) {
+    log_entry.add_delete(_table_to_update_name, row_id);
+  }
+}
+
 /**
  * input_table_left must be a table with at least one chunk, containing at least one ReferenceColumn
  * that all reference the table specified by table_to_update_name. The column count and types in input_table_left
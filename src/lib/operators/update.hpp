@@ -20,9 +20,14 @@ class Insert;
  * The second input table must have the exact same column layout and number of rows as the first table and contains the
  * data that is used to update the rows specified by the first table.
  *
- * Assumption: The input has been validated before.
+ * Rows that have not been inserted by the current transaction are versioned: the old row is deleted and the new
+ * version, consisting of the unchanged and the updated values, is inserted. Rows that the current transaction has
+ * inserted itself, e.g., the new version of a row that it has updated before, are not visible to other transactions.
+ * If all updated columns of such a row are fixed-width ValueColumns, only these columns are overwritten in place.
+ * Otherwise, the row gets a new version as well, but the old one is invalidated directly instead of being deleted,
+ * since Delete can only lock committed rows.
  *
- * Note: Update does not support null values at the moment
+ * Assumption: The input has been validated before.
  */
 class Update : public AbstractReadWriteOperator {
  public:
@@ -40,15 +45,26 @@ class Update : public AbstractReadWriteOperator {
       const std::shared_ptr<AbstractOperator>& recreated_input_right) const override;
   bool _execution_input_valid(const std::shared_ptr<TransactionContext>& context) const;
 
-  // Commit happens in Insert and Delete operators
+  // Runs a Delete on the given rows and marks the Update as failed if the Delete fails
+  void _delete_rows(const std::shared_ptr<TransactionContext>& context,
+                    const std::shared_ptr<const Table>& table_to_update,
+                    const std::shared_ptr<const PosList>& delete_pos_list);
+
+  // Commit happens in Insert and Delete operators. Invalidated rows stay invisible once their Insert commits.
   void _on_commit_records(const CommitID cid) override {}
 
-  // Rollback happens in Insert and Delete operators
+  // Rollback happens in Insert and Delete operators. The Insert also rolls back the invalidated rows.
   void _on_rollback_records() override {}
 
+  // Logs the invalidated rows as deletes, the Insert that has inserted them is logged before
+  void _on_log_records(LogEntry& log_entry) const override;
+
  protected:
   const std::string _table_to_update_name;
   std::shared_ptr<Delete> _delete;
   std::shared_ptr<Insert> _insert;
+
+  // Rows inserted by the current transaction that have been replaced by a new version
+  std::vector<RowID> _invalidated_rows;
 };
 }  // namespace opossum
@@ -6,6 +6,9 @@
 #include <vector>
 
 #include "concurrency/transaction_context.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
 #include "storage/reference_column.hpp"
 #include "utils/assert.hpp"
 
@@ -13,12 +16,8 @@ namespace opossum {
 
 namespace {
 
-bool is_row_visible(CommitID our_tid, CommitID snapshot_commit_id, ChunkOffset chunk_offset,
-                    const MvccColumns& columns) {
-  const auto row_tid = columns.tids[chunk_offset].load();
-  const auto begin_cid = columns.begin_cids[chunk_offset];
-  const auto end_cid = columns.end_cids[chunk_offset];
-
+bool is_visible(CommitID our_tid, CommitID snapshot_commit_id, TransactionID row_tid, CommitID begin_cid,
+                CommitID end_cid) {
   // Taken from: https://github.com/hyrise/hyrise/blob/master/docs/documentation/queryexecution/tx.rst
   // auto own_insert = (our_tid == row_tid) && !(snapshot_commit_id >= begin_cid) && !(snapshot_commit_id >= end_cid);
   // auto past_insert = (our_tid != row_tid) && (snapshot_commit_id >= begin_cid) && !(snapshot_commit_id >= end_cid);
@@ -28,6 +27,31 @@ bool is_row_visible(CommitID our_tid, CommitID snapshot_commit_id, ChunkOffset c
   return snapshot_commit_id < end_cid && ((snapshot_commit_id >= begin_cid) != (row_tid == our_tid));
 }
 
+bool is_row_visible(CommitID our_tid, CommitID snapshot_commit_id, ChunkOffset chunk_offset,
+                    const MvccColumns& columns) {
+  return is_visible(our_tid, snapshot_commit_id, columns.tids[chunk_offset].load(), columns.begin_cids[chunk_offset],
+                    columns.end_cids[chunk_offset]);
+}
+
+/**
+ * Adds the visible rows of the chunk to the pos_list. Every row is written and the output position only advances for
+ * visible rows. Without a data-dependent branch, chunks with a mix of visible and invisible rows do not suffer from
+ * branch mispredictions.
+ */
+template <typename IsVisible>
+void collect_visible_rows(const ChunkID chunk_id, const ChunkOffset chunk_size, PosList& pos_list,
+                          const IsVisible& is_visible) {
+  pos_list.resize(chunk_size);
+
+  auto output_size = size_t{0};
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+    pos_list[output_size] = RowID{chunk_id, chunk_offset};
+    output_size += is_visible(chunk_offset) ? 1u : 0u;
+  }
+
+  pos_list.resize(output_size);
+}
+
 }  // namespace
 
 Validate::Validate(const std::shared_ptr<AbstractOperator> in) : AbstractReadOnlyOperator(OperatorType::Validate, in) {}
@@ -53,67 +77,161 @@ std::shared_ptr<const Table> Validate::_on_execute(std::shared_ptr<TransactionCo
   const auto our_tid = transaction_context->transaction_id();
   const auto snapshot_commit_id = transaction_context->snapshot_commit_id();
 
-  for (ChunkID chunk_id{0}; chunk_id < _in_table->chunk_count(); ++chunk_id) {
-    const auto chunk_in = _in_table->get_chunk(chunk_id);
+  // Every chunk is validated by a job of its own. The output chunks are appended in the order of the input.
+  const auto chunk_count = _in_table->chunk_count();
+  auto output_columns_by_chunk = std::vector<ChunkColumns>(chunk_count);
 
-    ChunkColumns output_columns;
-    auto pos_list_out = std::make_shared<PosList>();
-    auto referenced_table = std::shared_ptr<const Table>();
-    const auto ref_col_in = std::dynamic_pointer_cast<const ReferenceColumn>(chunk_in->get_column(ColumnID{0}));
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunk_count);
 
-    // If the columns in this chunk reference a column, build a poslist for a reference column.
-    if (ref_col_in) {
-      DebugAssert(chunk_in->references_exactly_one_table(),
-                  "Input to Validate contains a Chunk referencing more than one table.");
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+    auto job_task = std::make_shared<JobTask>([&, chunk_id]() {
+      if (_is_cancelled()) return;
 
-      // Check all rows in the old poslist and put them in pos_list_out if they are visible.
-      referenced_table = ref_col_in->referenced_table();
-      DebugAssert(referenced_table->has_mvcc(), "Trying to use Validate on a table that has no MVCC columns");
+      output_columns_by_chunk[chunk_id] = _validate_chunk(_in_table, chunk_id, our_tid, snapshot_commit_id);
+    });
 
-      for (auto row_id : *ref_col_in->pos_list()) {
-        const auto referenced_chunk = referenced_table->get_chunk(row_id.chunk_id);
+    jobs.push_back(job_task);
+    job_task->schedule();
+  }
 
-        auto mvcc_columns = referenced_chunk->mvcc_columns();
+  CurrentScheduler::wait_for_tasks(jobs);
 
-        if (is_row_visible(our_tid, snapshot_commit_id, row_id.chunk_offset, *mvcc_columns)) {
-          pos_list_out->emplace_back(row_id);
-        }
-      }
+  for (const auto& output_columns : output_columns_by_chunk) {
+    if (!output_columns.empty()) {
+      output->append_chunk(output_columns);
+    }
+  }
+  return output;
+}
+
+bool Validate::is_pipelineable() const { return true; }
 
-      // Construct the actual ReferenceColumn objects and add them to the chunk.
-      for (ColumnID column_id{0}; column_id < chunk_in->column_count(); ++column_id) {
-        const auto column = std::static_pointer_cast<const ReferenceColumn>(chunk_in->get_column(column_id));
-        const auto referenced_column_id = column->referenced_column_id();
-        auto ref_col_out = std::make_shared<ReferenceColumn>(referenced_table, referenced_column_id, pos_list_out);
-        output_columns.push_back(ref_col_out);
+std::shared_ptr<Table> Validate::_on_pipeline_begin(const std::shared_ptr<const Table>& input_table) {
+  const auto transaction_context = this->transaction_context();
+  Assert(transaction_context, "Validate can't be called without a transaction context.");
+
+  _pipeline_transaction_id = transaction_context->transaction_id();
+  _pipeline_snapshot_commit_id = transaction_context->snapshot_commit_id();
+
+  return std::make_shared<Table>(input_table->column_definitions(), TableType::References);
+}
+
+ChunkColumns Validate::_on_execute_chunk(const std::shared_ptr<const Table>& input_table, const ChunkID chunk_id) {
+  return _validate_chunk(input_table, chunk_id, _pipeline_transaction_id, _pipeline_snapshot_commit_id);
+}
+
+ChunkColumns Validate::_validate_chunk(const std::shared_ptr<const Table>& in_table, const ChunkID chunk_id,
+                                       const TransactionID our_tid, const CommitID snapshot_commit_id) {
+  const auto chunk_in = in_table->get_chunk(chunk_id);
+
+  // Read-only transactions do not lock rows, so only the commit ids decide whether a row is visible to them
+  const auto is_read_only = our_tid == TransactionContext::READ_ONLY_TRANSACTION_ID;
+
+  ChunkColumns output_columns;
+  auto pos_list_out = std::make_shared<PosList>();
+  auto referenced_table = std::shared_ptr<const Table>();
+  const auto ref_col_in = std::dynamic_pointer_cast<const ReferenceColumn>(chunk_in->get_column(ColumnID{0}));
+
+  // If the columns in this chunk reference a column, build a poslist for a reference column.
+  if (ref_col_in) {
+    DebugAssert(chunk_in->references_exactly_one_table(),
+                "Input to Validate contains a Chunk referencing more than one table.");
+
+    // Check all rows in the old poslist and put them in pos_list_out if they are visible.
+    referenced_table = ref_col_in->referenced_table();
+    DebugAssert(referenced_table->has_mvcc(), "Trying to use Validate on a table that has no MVCC columns");
+
+    // Rows of referenced chunks that are visible as a whole are not checked individually. Consecutive rows usually
+    // belong to the same chunk, so the chunk and the result are cached.
+    auto referenced_chunk_id = INVALID_CHUNK_ID;
+    auto referenced_chunk = std::shared_ptr<const Chunk>{};
+    auto referenced_chunk_is_fully_visible = false;
+
+    for (auto row_id : *ref_col_in->pos_list()) {
+      if (row_id.chunk_id != referenced_chunk_id) {
+        referenced_chunk_id = row_id.chunk_id;
+        referenced_chunk = referenced_table->get_chunk(row_id.chunk_id);
+        referenced_chunk_is_fully_visible = referenced_chunk->mvcc_columns()->is_fully_visible(snapshot_commit_id);
       }
 
-      // Otherwise we have a Value- or DictionaryColumn and simply iterate over all rows to build a poslist.
-    } else {
-      referenced_table = _in_table;
-      DebugAssert(chunk_in->has_mvcc_columns(), "Trying to use Validate on a table that has no MVCC columns");
-      const auto mvcc_columns = chunk_in->mvcc_columns();
-
-      // Generate pos_list_out.
-      auto chunk_size = chunk_in->size();  // The compiler fails to optimize this in the for clause :(
-      for (auto i = 0u; i < chunk_size; i++) {
-        if (is_row_visible(our_tid, snapshot_commit_id, i, *mvcc_columns)) {
-          pos_list_out->emplace_back(RowID{chunk_id, i});
-        }
+      if (referenced_chunk_is_fully_visible ||
+          is_row_visible(our_tid, snapshot_commit_id, row_id.chunk_offset, *referenced_chunk->mvcc_columns())) {
+        pos_list_out->emplace_back(row_id);
       }
+    }
+
+    if (pos_list_out->empty()) return {};
 
-      // Create actual ReferenceColumn objects.
-      for (ColumnID column_id{0}; column_id < chunk_in->column_count(); ++column_id) {
-        auto ref_col_out = std::make_shared<ReferenceColumn>(referenced_table, column_id, pos_list_out);
-        output_columns.push_back(ref_col_out);
+    // Construct the actual ReferenceColumn objects and add them to the chunk.
+    for (ColumnID column_id{0}; column_id < chunk_in->column_count(); ++column_id) {
+      const auto column = std::static_pointer_cast<const ReferenceColumn>(chunk_in->get_column(column_id));
+      const auto referenced_column_id = column->referenced_column_id();
+      auto ref_col_out = std::make_shared<ReferenceColumn>(referenced_table, referenced_column_id, pos_list_out);
+      output_columns.push_back(ref_col_out);
+    }
+
+    // Otherwise we have a Value- or DictionaryColumn and simply iterate over all rows to build a poslist.
+  } else {
+    referenced_table = in_table;
+    DebugAssert(chunk_in->has_mvcc_columns(), "Trying to use Validate on a table that has no MVCC columns");
+    const auto mvcc_columns = chunk_in->mvcc_columns();
+
+    // The size has to be determined before the MVCC summary is checked, see MvccColumns::is_fully_visible()
+    const auto chunk_size = chunk_in->size();
+
+    // Generate pos_list_out.
+    if (mvcc_columns->is_fully_visible(snapshot_commit_id)) {
+      // The MVCC columns are not touched at all
+      pos_list_out->resize(chunk_size);
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+        (*pos_list_out)[chunk_offset] = RowID{chunk_id, chunk_offset};
+      }
+    } else if (mvcc_columns->is_contiguous() && (is_read_only || !mvcc_columns->has_uncommitted_rows())) {
+      // Without uncommitted rows or in a read-only transaction, no row is locked by our transaction and the tids can be
+      // ignored. The visibility of the rows is determined in a vectorizable loop over the plain commit ids before the
+      // positions are collected.
+      const auto* begin_cids = mvcc_columns->begin_cids.data();
+      const auto* end_cids = mvcc_columns->end_cids.data();
+
+      auto row_is_visible = std::vector<uint8_t>(chunk_size);
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+        row_is_visible[chunk_offset] =
+            begin_cids[chunk_offset] <= snapshot_commit_id && snapshot_commit_id < end_cids[chunk_offset];
       }
+
+      collect_visible_rows(chunk_id, chunk_size, *pos_list_out,
+                           [&](const ChunkOffset chunk_offset) { return row_is_visible[chunk_offset]; });
+    } else if (mvcc_columns->is_contiguous()) {
+      const auto* tids = mvcc_columns->tids.data();
+      const auto* begin_cids = mvcc_columns->begin_cids.data();
+      const auto* end_cids = mvcc_columns->end_cids.data();
+
+      collect_visible_rows(chunk_id, chunk_size, *pos_list_out, [&](const ChunkOffset chunk_offset) {
+        return is_visible(our_tid, snapshot_commit_id, tids[chunk_offset].load(), begin_cids[chunk_offset],
+                          end_cids[chunk_offset]);
+      });
+    } else if (is_read_only) {
+      collect_visible_rows(chunk_id, chunk_size, *pos_list_out, [&](const ChunkOffset chunk_offset) {
+        return mvcc_columns->begin_cids[chunk_offset] <= snapshot_commit_id &&
+               snapshot_commit_id < mvcc_columns->end_cids[chunk_offset];
+      });
+    } else {
+      collect_visible_rows(chunk_id, chunk_size, *pos_list_out, [&](const ChunkOffset chunk_offset) {
+        return is_row_visible(our_tid, snapshot_commit_id, chunk_offset, *mvcc_columns);
+      });
     }
 
-    if (!pos_list_out->empty() > 0) {
-      output->append_chunk(output_columns);
+    if (pos_list_out->empty()) return {};
+
+    // Create actual ReferenceColumn objects.
+    for (ColumnID column_id{0}; column_id < chunk_in->column_count(); ++column_id) {
+      auto ref_col_out = std::make_shared<ReferenceColumn>(referenced_table, column_id, pos_list_out);
+      output_columns.push_back(ref_col_out);
     }
   }
-  return output;
+
+  return output_columns;
 }
 
 }  // namespace opossum
@@ -22,12 +22,26 @@ class Validate : public AbstractReadOnlyOperator {
 
   const std::string name() const override;
 
+  bool is_pipelineable() const override;
+
  protected:
   std::shared_ptr<const Table> _on_execute(std::shared_ptr<TransactionContext> transaction_context) override;
   std::shared_ptr<const Table> _on_execute() override;
   std::shared_ptr<AbstractOperator> _on_recreate(
       const std::vector<AllParameterVariant>& args, const std::shared_ptr<AbstractOperator>& recreated_input_left,
       const std::shared_ptr<AbstractOperator>& recreated_input_right) const override;
+
+  std::shared_ptr<Table> _on_pipeline_begin(const std::shared_ptr<const Table>& input_table) override;
+  ChunkColumns _on_execute_chunk(const std::shared_ptr<const Table>& input_table, const ChunkID chunk_id) override;
+
+  // Returns the columns of the output chunk for the visible rows of the chunk, or no columns if none is visible
+  static ChunkColumns _validate_chunk(const std::shared_ptr<const Table>& in_table, const ChunkID chunk_id,
+                                      const TransactionID our_tid, const CommitID snapshot_commit_id);
+
+ private:
+  // Set by _on_pipeline_begin()
+  TransactionID _pipeline_transaction_id{0};
+  CommitID _pipeline_snapshot_commit_id{0};
 };
 
 }  // namespace opossum
@@ -12,12 +12,58 @@
 
 #include "utils/assert.hpp"
 
+namespace {
+
+/**
+ * The query of the Task that is currently being executed on this thread, INVALID_QUERY_ID and nullptr if there is
+ * none. Used to propagate the query to Tasks spawned during the execution of another Task.
+ */
+thread_local opossum::QueryID this_thread_query_id = opossum::INVALID_QUERY_ID;
+thread_local std::shared_ptr<opossum::QueryTaskLimit> this_thread_task_limit;
+
+/**
+ * Sets the query of this thread while a Task is executed and restores the one of the outer Task afterwards (the Task
+ * might be executed while the outer Task waits, see Worker::_wait_for_task()), even if the Task throws.
+ */
+class ThisThreadQueryGuard : private opossum::Noncopyable {
+ public:
+  ThisThreadQueryGuard(opossum::QueryID query_id, const std::shared_ptr<opossum::QueryTaskLimit>& task_limit)
+      : _outer_query_id(this_thread_query_id), _outer_task_limit(std::move(this_thread_task_limit)) {
+    this_thread_query_id = query_id;
+    this_thread_task_limit = task_limit;
+  }
+
+  ~ThisThreadQueryGuard() {
+    this_thread_query_id = _outer_query_id;
+    this_thread_task_limit = std::move(_outer_task_limit);
+  }
+
+ private:
+  const opossum::QueryID _outer_query_id;
+  std::shared_ptr<opossum::QueryTaskLimit> _outer_task_limit;
+};
+
+}  // namespace
+
 namespace opossum {
 
 TaskID AbstractTask::id() const { return _id; }
 
 NodeID AbstractTask::node_id() const { return _node_id; }
 
+QueryID AbstractTask::query_id() const { return _query_id; }
+
+void AbstractTask::set_query(QueryID query_id, SchedulePriority ready_priority,
+                             const std::shared_ptr<QueryTaskLimit>& task_limit) {
+  DebugAssert((!_is_scheduled), "Possible race: Don't set the query after the Task was scheduled");
+
+  _query_id = query_id;
+  _ready_priority = ready_priority;
+  _task_limit = task_limit;
+}
+
+const std::shared_ptr<QueryTaskLimit>& AbstractTask::task_limit() const { return _task_limit; }
+
 bool AbstractTask::is_ready() const { return _predecessor_counter == 0; }
 
 bool AbstractTask::is_done() const { return _done; }
@@ -41,7 +87,14 @@ const std::vector<std::shared_ptr<AbstractTask>>& AbstractTask::successors() con
 
 void AbstractTask::set_node_id(NodeID node_id) { _node_id = node_id; }
 
-bool AbstractTask::try_mark_as_enqueued() { return !_is_enqueued.exchange(true); }
+bool AbstractTask::try_mark_as_enqueued() {
+  if (_is_enqueued.exchange(true)) return false;
+
+  _enqueue_time = std::chrono::steady_clock::now();
+  return true;
+}
+
+std::chrono::steady_clock::time_point AbstractTask::enqueue_time() const { return _enqueue_time; }
 
 void AbstractTask::set_done_callback(const std::function<void()>& done_callback) {
   DebugAssert((!_is_scheduled), "Possible race: Don't set callback after the Task was scheduled");
@@ -52,6 +105,11 @@ void AbstractTask::set_done_callback(const std::function<void()>& done_callback)
 void AbstractTask::schedule(NodeID preferred_node_id, SchedulePriority priority) {
   _mark_as_scheduled();
 
+  if (_query_id == INVALID_QUERY_ID) {
+    _query_id = ::this_thread_query_id;
+    _task_limit = ::this_thread_task_limit;
+  }
+
   if (CurrentScheduler::is_set()) {
     CurrentScheduler::get()->schedule(shared_from_this(), preferred_node_id, priority);
   } else {
@@ -80,14 +138,22 @@ void AbstractTask::join() {
 
 void AbstractTask::_join_without_replacement_worker() {
   std::unique_lock<std::mutex> lock(_done_mutex);
-  _done_condition_variable.wait(lock, [&]() { return _done; });
+  _done_condition_variable.wait(lock, [&]() { return _done.load(); });
+}
+
+void AbstractTask::_wait_until_done(std::chrono::microseconds timeout) {
+  std::unique_lock<std::mutex> lock(_done_mutex);
+  _done_condition_variable.wait_for(lock, timeout, [&]() { return _done.load(); });
 }
 
 void AbstractTask::execute() {
   DebugAssert(!(_started.exchange(true)), "Possible bug: Trying to execute the same task twice");
   DebugAssert(is_ready(), "Task must not be executed before its dependencies are done");
 
-  _on_execute();
+  {
+    const auto query_guard = ThisThreadQueryGuard{_query_id, _task_limit};
+    _on_execute();
+  }
 
   for (auto& successor : _successors) {
     successor->_on_predecessor_done();
@@ -117,7 +183,7 @@ void AbstractTask::_on_predecessor_done() {
       auto worker = Worker::get_this_thread_worker();
       DebugAssert(static_cast<bool>(worker), "No worker");
 
-      worker->queue()->push(shared_from_this(), static_cast<uint32_t>(SchedulePriority::High));
+      worker->queue()->push(shared_from_this(), static_cast<uint32_t>(_ready_priority));
     } else {
       if (_is_scheduled) execute();
       // Otherwise it will get execute()d once it is scheduled. It is entirely possible for Tasks to "become ready"
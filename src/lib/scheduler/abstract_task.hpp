@@ -1,6 +1,7 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <functional>
 #include <memory>
@@ -12,6 +13,7 @@
 
 namespace opossum {
 
+class QueryTaskLimit;
 class Worker;
 
 /**
@@ -31,6 +33,24 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
   TaskID id() const;
   NodeID node_id() const;
 
+  /**
+   * The query this Task belongs to, INVALID_QUERY_ID if it was not tagged. Tasks that are scheduled from within
+   * another Task's execution (e.g., JobTasks of an operator) inherit the query id of that Task.
+   */
+  QueryID query_id() const;
+
+  /**
+   * Tags the Task with the query it belongs to.
+   * @param ready_priority is the priority the Task is enqueued with once its last predecessor finished. By default,
+   *        these Tasks are preferred so that started queries finish first. Lower it to let queries share the CPUs.
+   * @param task_limit limits how many Tasks of the query are executed at the same time (see AdmissionControl),
+   *        nullptr if the query is not limited. Inherited like the query id.
+   */
+  void set_query(QueryID query_id, SchedulePriority ready_priority = SchedulePriority::High,
+                 const std::shared_ptr<QueryTaskLimit>& task_limit = nullptr);
+
+  const std::shared_ptr<QueryTaskLimit>& task_limit() const;
+
   /**
    * @return All dependencies are done
    */
@@ -81,8 +101,8 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
 
   /**
    * Waits for the Task to finish
-   * If the Task is being executed on a Worker, allow another Worker to run on the CPU while waiting for this task to
-   * finish
+   * If called from a Task that is being executed on a Worker, the Worker executes other Tasks while waiting for this
+   * task to finish
    */
   void join();
 
@@ -98,6 +118,11 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
    */
   bool try_mark_as_enqueued();
 
+  /**
+   * The point in time the task was put into a TaskQueue, i.e., when it became ready to be executed by a Worker
+   */
+  std::chrono::steady_clock::time_point enqueue_time() const;
+
   /**
    * Executes the task in the current Thread, blocks until all operations are finished
    */
@@ -117,6 +142,11 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
    */
   void _join_without_replacement_worker();
 
+  /**
+   * Blocks the calling thread until the Task finished executing or @param timeout expired
+   */
+  void _wait_until_done(std::chrono::microseconds timeout);
+
   /**
    * Called when a dependency is initialized (by set_as_predecessor_of)
    */
@@ -129,7 +159,10 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
 
   TaskID _id = INVALID_TASK_ID;
   NodeID _node_id = INVALID_NODE_ID;
-  bool _done = false;
+  QueryID _query_id = INVALID_QUERY_ID;
+  std::shared_ptr<QueryTaskLimit> _task_limit;
+  SchedulePriority _ready_priority = SchedulePriority::High;
+  std::atomic_bool _done{false};
   std::function<void()> _done_callback;
 
   // For dependencies
@@ -141,6 +174,7 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
   // to a TaskQueue
   std::atomic_bool _is_enqueued{false};
   std::atomic_bool _is_scheduled{false};
+  std::chrono::steady_clock::time_point _enqueue_time;
 
   // For making Tasks join()-able
   std::condition_variable _done_condition_variable;
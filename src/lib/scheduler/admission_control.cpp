@@ -0,0 +1,224 @@
+#include "admission_control.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "operators/get_table.hpp"
+#include "scheduler/abstract_scheduler.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/operator_task.hpp"
+#include "scheduler/topology.hpp"
+#include "scheduler/worker.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+AdmissionControl& AdmissionControl::get() {
+  static AdmissionControl instance;
+  return instance;
+}
+
+void AdmissionControl::reset() {
+  auto& admission_control = get();
+
+  std::lock_guard<std::mutex> lock(admission_control._mutex);
+  DebugAssert(admission_control._num_running_expensive_queries == 0 &&
+                  admission_control._next_ticket == admission_control._next_admitted_ticket,
+              "Cannot reset AdmissionControl while queries are running or waiting");
+
+  admission_control._next_query_id = 0;
+  admission_control._cheap_query_cost_threshold = DEFAULT_CHEAP_QUERY_COST_THRESHOLD;
+  admission_control._max_concurrent_expensive_queries = DEFAULT_MAX_CONCURRENT_EXPENSIVE_QUERIES;
+  admission_control._next_ticket = 0;
+  admission_control._next_admitted_ticket = 0;
+  admission_control._running_task_limits.clear();
+}
+
+Cost AdmissionControl::estimate_cost(const std::vector<std::shared_ptr<OperatorTask>>& tasks) {
+  auto cost = Cost{0};
+
+  for (const auto& task : tasks) {
+    const auto get_table = std::dynamic_pointer_cast<GetTable>(task->get_operator());
+    if (!get_table || !StorageManager::get().has_table(get_table->table_name())) continue;
+
+    cost += static_cast<Cost>(StorageManager::get().get_table(get_table->table_name())->row_count());
+  }
+
+  return cost;
+}
+
+Cost AdmissionControl::cheap_query_cost_threshold() const { return _cheap_query_cost_threshold; }
+
+void AdmissionControl::set_cheap_query_cost_threshold(Cost threshold) { _cheap_query_cost_threshold = threshold; }
+
+uint32_t AdmissionControl::max_concurrent_expensive_queries() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _max_concurrent_expensive_queries;
+}
+
+void AdmissionControl::set_max_concurrent_expensive_queries(uint32_t max_queries) {
+  Assert(max_queries > 0, "At least one expensive query has to be allowed to run");
+
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _max_concurrent_expensive_queries = max_queries;
+  }
+
+  // Raising the limit might allow waiting queries to run
+  _admission_condition_variable.notify_all();
+}
+
+std::unique_ptr<QueryAdmission> AdmissionControl::admit(Cost estimated_cost, uint32_t weight) {
+  Assert(weight > 0, "Queries need a positive weight");
+
+  const auto query_id = _next_query_id++;
+
+  if (estimated_cost < _cheap_query_cost_threshold) {
+    return std::make_unique<QueryAdmission>(query_id, SchedulePriority::High, nullptr);
+  }
+
+  std::unique_lock<std::mutex> lock(_mutex);
+
+  const auto ticket = _next_ticket++;
+  const auto is_admissible = [&]() {
+    return ticket == _next_admitted_ticket && _num_running_expensive_queries < _max_concurrent_expensive_queries;
+  };
+
+  if (!is_admissible()) {
+    // If the query is waiting on a Worker (e.g., in a server task), another Worker has to keep executing the tasks
+    // of the running queries. Otherwise, all Workers could end up waiting for admission.
+    if (auto worker = Worker::get_this_thread_worker()) {
+      lock.unlock();
+      worker->_hand_off_active_worker_token();
+      lock.lock();
+    }
+
+    _admission_condition_variable.wait(lock, is_admissible);
+  }
+
+  ++_next_admitted_ticket;
+  ++_num_running_expensive_queries;
+
+  const auto task_limit = std::make_shared<QueryTaskLimit>(weight, 1u);
+  _running_task_limits.emplace_back(task_limit);
+  _update_task_limits();
+  lock.unlock();
+
+  // The next query in line might fit into the remaining slots as well
+  _admission_condition_variable.notify_all();
+
+  return std::make_unique<QueryAdmission>(query_id, SchedulePriority::Normal, task_limit);
+}
+
+uint32_t AdmissionControl::num_running_expensive_queries() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _num_running_expensive_queries;
+}
+
+uint32_t AdmissionControl::num_waiting_expensive_queries() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return static_cast<uint32_t>(_next_ticket - _next_admitted_ticket);
+}
+
+void AdmissionControl::_release_expensive_query(const std::shared_ptr<QueryTaskLimit>& task_limit) {
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    DebugAssert(_num_running_expensive_queries > 0, "Released more expensive queries than were admitted");
+    --_num_running_expensive_queries;
+
+    // The limit might be gone already if the AdmissionControl has been reset in the meantime
+    const auto iter = std::find(_running_task_limits.begin(), _running_task_limits.end(), task_limit);
+    if (iter != _running_task_limits.end()) _running_task_limits.erase(iter);
+    _update_task_limits();
+  }
+  _admission_condition_variable.notify_all();
+}
+
+void AdmissionControl::_update_task_limits() {
+  const auto num_cpus = CurrentScheduler::is_set() ? CurrentScheduler::get()->topology()->num_cpus() : size_t{1};
+
+  auto total_weight = size_t{0};
+  for (const auto& task_limit : _running_task_limits) {
+    total_weight += task_limit->weight();
+  }
+
+  // Raised limits take effect once the next task of the query finishes, lowered ones once enough tasks finished
+  for (const auto& task_limit : _running_task_limits) {
+    const auto share = num_cpus * task_limit->weight() / total_weight;
+    task_limit->set_max_concurrent_tasks(static_cast<uint32_t>(std::max(share, size_t{1})));
+  }
+}
+
+QueryTaskLimit::QueryTaskLimit(uint32_t weight, uint32_t max_concurrent_tasks)
+    : _weight(weight), _max_concurrent_tasks(max_concurrent_tasks) {}
+
+uint32_t QueryTaskLimit::weight() const { return _weight; }
+
+uint32_t QueryTaskLimit::max_concurrent_tasks() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _max_concurrent_tasks;
+}
+
+void QueryTaskLimit::set_max_concurrent_tasks(uint32_t max_concurrent_tasks) {
+  DebugAssert(max_concurrent_tasks > 0, "Queries have to be allowed to execute at least one task");
+
+  std::lock_guard<std::mutex> lock(_mutex);
+  _max_concurrent_tasks = max_concurrent_tasks;
+}
+
+uint32_t QueryTaskLimit::num_running_tasks() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _num_running_tasks;
+}
+
+bool QueryTaskLimit::try_start_task(const std::shared_ptr<AbstractTask>& task) {
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  // Since the query is running tasks, one of them will hand out the deferred task when it finishes
+  if (_num_running_tasks >= _max_concurrent_tasks) {
+    _deferred_tasks.emplace_back(task);
+    return false;
+  }
+
+  ++_num_running_tasks;
+  return true;
+}
+
+std::vector<std::shared_ptr<AbstractTask>> QueryTaskLimit::finish_task() {
+  std::lock_guard<std::mutex> lock(_mutex);
+  DebugAssert(_num_running_tasks > 0, "Finished more tasks than were started");
+  --_num_running_tasks;
+
+  // The tasks call try_start_task() again when they are pulled, so they might be deferred again if other tasks of the
+  // query started in the meantime
+  auto startable_tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  while (!_deferred_tasks.empty() && _num_running_tasks + startable_tasks.size() < _max_concurrent_tasks) {
+    startable_tasks.emplace_back(std::move(_deferred_tasks.front()));
+    _deferred_tasks.pop_front();
+  }
+  return startable_tasks;
+}
+
+void QueryTaskLimit::resume_task() {
+  std::lock_guard<std::mutex> lock(_mutex);
+  ++_num_running_tasks;
+}
+
+QueryAdmission::QueryAdmission(QueryID query_id, SchedulePriority priority,
+                               const std::shared_ptr<QueryTaskLimit>& task_limit)
+    : _query_id(query_id), _priority(priority), _task_limit(task_limit) {}
+
+QueryAdmission::~QueryAdmission() {
+  if (_task_limit) AdmissionControl::get()._release_expensive_query(_task_limit);
+}
+
+QueryID QueryAdmission::query_id() const { return _query_id; }
+
+SchedulePriority QueryAdmission::priority() const { return _priority; }
+
+const std::shared_ptr<QueryTaskLimit>& QueryAdmission::task_limit() const { return _task_limit; }
+
+}  // namespace opossum
@@ -0,0 +1,149 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "cost_model/cost.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractTask;
+class OperatorTask;
+class QueryAdmission;
+class QueryTaskLimit;
+
+/**
+ * AdmissionControl decides when a query may start to execute and how its tasks compete with the tasks of other
+ * queries. It is a thread-safe singleton.
+ *
+ * Queries are classified by their estimated cost:
+ *  - Cheap queries (estimated cost below cheap_query_cost_threshold()) are admitted right away and their tasks are
+ *    scheduled with SchedulePriority::High. Thus, short point queries are not stuck behind the tasks of long-running
+ *    analytical queries.
+ *  - Expensive queries are limited to max_concurrent_expensive_queries() at a time. Additional expensive queries wait
+ *    in FIFO order until a running one finishes. Their tasks are scheduled with SchedulePriority::Normal.
+ *
+ * The CPUs are shared between the running expensive queries by their weight (weighted fair sharing): each of them
+ * executes at most num_cpus * weight / (sum of the weights) tasks at the same time, but at least one (see
+ * QueryTaskLimit). The shares are recomputed whenever an expensive query starts or finishes. Thus, an
+ * analytical query with many tasks cannot occupy all Workers while other expensive queries wait for theirs.
+ *
+ * Every admitted query is assigned a QueryID that its tasks are tagged with (see AbstractTask::query_id()).
+ */
+class AdmissionControl : private Noncopyable {
+ public:
+  static constexpr Cost DEFAULT_CHEAP_QUERY_COST_THRESHOLD = 10'000.0f;
+  static constexpr uint32_t DEFAULT_MAX_CONCURRENT_EXPENSIVE_QUERIES = 4u;
+
+  static AdmissionControl& get();
+  static void reset();
+
+  /**
+   * Estimates the cost of a physical query plan before it is executed. Since there is no cardinality estimation for
+   * physical plans yet, this is the number of rows read from stored tables.
+   */
+  static Cost estimate_cost(const std::vector<std::shared_ptr<OperatorTask>>& tasks);
+
+  Cost cheap_query_cost_threshold() const;
+  void set_cheap_query_cost_threshold(Cost threshold);
+
+  uint32_t max_concurrent_expensive_queries() const;
+  void set_max_concurrent_expensive_queries(uint32_t max_queries);
+
+  /**
+   * Blocks until the query may be executed. The query is considered running until the returned QueryAdmission is
+   * destroyed.
+   * @param weight determines the share of the CPUs that the query gets if it is expensive
+   */
+  std::unique_ptr<QueryAdmission> admit(Cost estimated_cost, uint32_t weight = 1);
+
+  uint32_t num_running_expensive_queries() const;
+  uint32_t num_waiting_expensive_queries() const;
+
+ private:
+  friend class QueryAdmission;
+
+  AdmissionControl() = default;
+
+  void _release_expensive_query(const std::shared_ptr<QueryTaskLimit>& task_limit);
+
+  // Distributes the CPUs among the running expensive queries by their weight
+  void _update_task_limits();
+
+  std::atomic<QueryID> _next_query_id{0};
+  std::atomic<Cost> _cheap_query_cost_threshold{DEFAULT_CHEAP_QUERY_COST_THRESHOLD};
+
+  // Protects the members below. Expensive queries are admitted in the order of their tickets.
+  mutable std::mutex _mutex;
+  std::condition_variable _admission_condition_variable;
+  uint32_t _max_concurrent_expensive_queries{DEFAULT_MAX_CONCURRENT_EXPENSIVE_QUERIES};
+  uint32_t _num_running_expensive_queries{0};
+  uint64_t _next_ticket{0};
+  uint64_t _next_admitted_ticket{0};
+  std::vector<std::shared_ptr<QueryTaskLimit>> _running_task_limits;
+};
+
+/**
+ * Limits the number of tasks of an expensive query that are executed at the same time. Workers call try_start_task()
+ * before executing a task of the query. If the query is at its limit, the task is deferred and handed back to a Worker
+ * by the next call of finish_task() that frees a slot. Tasks that wait for other tasks (see Worker::_wait_for_task())
+ * free their slot while waiting, so that the awaited tasks can run.
+ */
+class QueryTaskLimit : private Noncopyable {
+ public:
+  QueryTaskLimit(uint32_t weight, uint32_t max_concurrent_tasks);
+
+  uint32_t weight() const;
+
+  uint32_t max_concurrent_tasks() const;
+  void set_max_concurrent_tasks(uint32_t max_concurrent_tasks);
+
+  uint32_t num_running_tasks() const;
+
+  // Returns false and keeps the task if the query already executes max_concurrent_tasks() tasks
+  bool try_start_task(const std::shared_ptr<AbstractTask>& task);
+
+  // Returns the deferred tasks that may be started now. They have to be pushed into a TaskQueue again.
+  std::vector<std::shared_ptr<AbstractTask>> finish_task();
+
+  // Takes a slot again after the task waited for other tasks, even if the query is at its limit
+  void resume_task();
+
+ private:
+  const uint32_t _weight;
+
+  mutable std::mutex _mutex;
+  uint32_t _max_concurrent_tasks;
+  uint32_t _num_running_tasks{0};
+  std::deque<std::shared_ptr<AbstractTask>> _deferred_tasks;
+};
+
+/**
+ * Handed out by AdmissionControl::admit(). Releases the query's slot when destroyed.
+ */
+class QueryAdmission : private Noncopyable {
+ public:
+  // @param task_limit is nullptr for cheap queries, which are not limited
+  QueryAdmission(QueryID query_id, SchedulePriority priority, const std::shared_ptr<QueryTaskLimit>& task_limit);
+  ~QueryAdmission();
+
+  QueryID query_id() const;
+
+  // The priority that the query's OperatorTasks should be scheduled with
+  SchedulePriority priority() const;
+
+  const std::shared_ptr<QueryTaskLimit>& task_limit() const;
+
+ private:
+  const QueryID _query_id;
+  const SchedulePriority _priority;
+  const std::shared_ptr<QueryTaskLimit> _task_limit;
+};
+
+}  // namespace opossum
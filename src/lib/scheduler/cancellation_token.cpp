@@ -0,0 +1,26 @@
+#include "cancellation_token.hpp"
+
+namespace opossum {
+
+CancellationToken::CancellationToken(std::chrono::microseconds timeout) : _timeout(timeout) {}
+
+void CancellationToken::start() {
+  if (!_timeout) return;
+
+  auto not_started = Clock::time_point::max();
+  _deadline.compare_exchange_strong(not_started, Clock::now() + *_timeout);
+}
+
+void CancellationToken::cancel() { _cancelled = true; }
+
+bool CancellationToken::is_cancelled() const {
+  if (_cancelled.load(std::memory_order_relaxed)) return true;
+
+  // Tokens without a deadline do not need to read the clock
+  const auto deadline = _deadline.load(std::memory_order_relaxed);
+  return deadline != Clock::time_point::max() && Clock::now() >= deadline;
+}
+
+bool CancellationToken::has_timed_out() const { return !_cancelled && Clock::now() >= _deadline.load(); }
+
+}  // namespace opossum
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <optional>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Used to stop the execution of a query cooperatively. The token is shared by all operators of the query (see
+ * AbstractOperator::set_cancellation_token()). Operators check it before they start and in their per-chunk loops and
+ * stop early once it is cancelled. The output of a cancelled query is incomplete and must be discarded.
+ *
+ * A token is cancelled either explicitly by cancel() (which may be called from any thread) or when its deadline passed.
+ * The deadline is set by start(), so that the time a query spends being parsed, optimized, or cached is not counted.
+ */
+class CancellationToken : private Noncopyable {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  CancellationToken() = default;
+
+  // The token is cancelled automatically once @param timeout passed after start() was called
+  explicit CancellationToken(std::chrono::microseconds timeout);
+
+  // Sets the deadline when the execution starts. Only the first call has an effect, so that all statements of a
+  // pipeline share the deadline.
+  void start();
+
+  void cancel();
+
+  bool is_cancelled() const;
+
+  // True if the token was cancelled because its deadline passed, false if cancel() was called or it is not cancelled
+  bool has_timed_out() const;
+
+ private:
+  std::atomic_bool _cancelled{false};
+  const std::optional<std::chrono::microseconds> _timeout;
+  std::atomic<Clock::time_point> _deadline{Clock::time_point::max()};
+};
+
+}  // namespace opossum
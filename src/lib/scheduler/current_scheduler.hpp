@@ -32,10 +32,12 @@ class CurrentScheduler {
   static void wait_for_tasks(const std::vector<std::shared_ptr<TaskType>>& tasks);
 
   template <typename TaskType>
-  static void schedule_tasks(const std::vector<std::shared_ptr<TaskType>>& tasks);
+  static void schedule_tasks(const std::vector<std::shared_ptr<TaskType>>& tasks,
+                             SchedulePriority priority = SchedulePriority::Normal);
 
   template <typename TaskType>
-  static void schedule_and_wait_for_tasks(const std::vector<std::shared_ptr<TaskType>>& tasks);
+  static void schedule_and_wait_for_tasks(const std::vector<std::shared_ptr<TaskType>>& tasks,
+                                          SchedulePriority priority = SchedulePriority::Normal);
 
  private:
   static std::shared_ptr<AbstractScheduler> _instance;
@@ -66,15 +68,16 @@ void CurrentScheduler::wait_for_tasks(const std::vector<std::shared_ptr<TaskType
 }
 
 template <typename TaskType>
-void CurrentScheduler::schedule_tasks(const std::vector<std::shared_ptr<TaskType>>& tasks) {
+void CurrentScheduler::schedule_tasks(const std::vector<std::shared_ptr<TaskType>>& tasks, SchedulePriority priority) {
   for (auto& task : tasks) {
-    task->schedule();
+    task->schedule(CURRENT_NODE_ID, priority);
   }
 }
 
 template <typename TaskType>
-void CurrentScheduler::schedule_and_wait_for_tasks(const std::vector<std::shared_ptr<TaskType>>& tasks) {
-  schedule_tasks(tasks);
+void CurrentScheduler::schedule_and_wait_for_tasks(const std::vector<std::shared_ptr<TaskType>>& tasks,
+                                                   SchedulePriority priority) {
+  schedule_tasks(tasks, priority);
   wait_for_tasks(tasks);
 }
 
@@ -1,5 +1,7 @@
 #include "node_queue_scheduler.hpp"
 
+#include <algorithm>
+#include <chrono>
 #include <cstdlib>
 #include <iostream>
 #include <memory>
@@ -17,7 +19,8 @@
 
 namespace opossum {
 
-NodeQueueScheduler::NodeQueueScheduler(std::shared_ptr<Topology> topology) : AbstractScheduler(topology) {
+NodeQueueScheduler::NodeQueueScheduler(std::shared_ptr<Topology> topology, std::chrono::microseconds steal_delay)
+    : AbstractScheduler(topology), _steal_delay(steal_delay) {
   _worker_id_allocator = std::make_shared<UidAllocator>();
 }
 
@@ -34,15 +37,15 @@ void NodeQueueScheduler::begin() {
   _queues.reserve(_topology->nodes().size());
 
   for (NodeID q{0}; q < _topology->nodes().size(); q++) {
-    auto queue = std::make_shared<TaskQueue>(q);
-
-    _queues.emplace_back(queue);
+    _queues.emplace_back(std::make_shared<TaskQueue>(q));
+  }
 
-    auto& topology_node = _topology->nodes()[q];
+  for (NodeID q{0}; q < _topology->nodes().size(); q++) {
+    const auto remote_queues = _remote_queues_by_distance(q);
 
-    for (auto& topology_cpu : topology_node.cpus) {
-      _processing_units.emplace_back(
-          std::make_shared<ProcessingUnit>(queue, _worker_id_allocator, topology_cpu.cpu_id));
+    for (auto& topology_cpu : _topology->nodes()[q].cpus) {
+      _processing_units.emplace_back(std::make_shared<ProcessingUnit>(_queues[q], remote_queues, _worker_id_allocator,
+                                                                      topology_cpu.cpu_id, _steal_delay));
     }
   }
 
@@ -91,6 +94,32 @@ void NodeQueueScheduler::finish() {
 
 const std::vector<std::shared_ptr<TaskQueue>>& NodeQueueScheduler::queues() const { return _queues; }
 
+std::chrono::microseconds NodeQueueScheduler::steal_delay() const { return _steal_delay; }
+
+std::vector<std::shared_ptr<TaskQueue>> NodeQueueScheduler::_remote_queues_by_distance(NodeID node_id) const {
+  std::vector<std::shared_ptr<TaskQueue>> remote_queues;
+  for (const auto& queue : _queues) {
+    if (queue->node_id() != node_id) remote_queues.emplace_back(queue);
+  }
+
+  // Closest nodes first. Among nodes of the same distance, start with the next higher node id and wrap around, so that
+  // the Workers of different nodes do not all compete for the same victim.
+  const auto num_nodes = _queues.size();
+  const auto rotated_node_id = [&](const auto& queue) { return (queue->node_id() + num_nodes - node_id) % num_nodes; };
+  std::sort(remote_queues.begin(), remote_queues.end(), [&](const auto& lhs, const auto& rhs) {
+    const auto lhs_distance = _topology->node_distance(node_id, lhs->node_id());
+    const auto rhs_distance = _topology->node_distance(node_id, rhs->node_id());
+    if (lhs_distance != rhs_distance) return lhs_distance < rhs_distance;
+    return rotated_node_id(lhs) < rotated_node_id(rhs);
+  });
+
+  return remote_queues;
+}
+
+const std::vector<std::shared_ptr<ProcessingUnit>>& NodeQueueScheduler::processing_units() const {
+  return _processing_units;
+}
+
 void NodeQueueScheduler::schedule(std::shared_ptr<AbstractTask> task, NodeID preferred_node_id,
                                   SchedulePriority priority) {
   /**
@@ -104,15 +133,26 @@ void NodeQueueScheduler::schedule(std::shared_ptr<AbstractTask> task, NodeID pre
 
   if (!task->is_ready()) return;
 
+  // Nodes that are unknown to the topology (e.g., INVALID_NODE_ID for chunks whose location is unknown) do not
+  // restrict where the task is executed
+  if (static_cast<size_t>(preferred_node_id) >= _queues.size()) preferred_node_id = CURRENT_NODE_ID;
+
   // Lookup node id for current worker.
-  if (preferred_node_id == CURRENT_NODE_ID) {
-    auto worker = Worker::get_this_thread_worker();
-    if (worker) {
-      preferred_node_id = worker->queue()->node_id();
-    } else {
-      // TODO(all): Actually, this should be ANY_NODE_ID, LIGHT_LOAD_NODE or something
-      preferred_node_id = NodeID{0};
+  auto worker = Worker::get_this_thread_worker();
+  if (worker) {
+    const auto worker_node_id = worker->queue()->node_id();
+
+    // Tasks spawned by a Worker for its own node, e.g., JobTasks of an operator, are executed LIFO by the same
+    // ProcessingUnit unless they are stolen by idle Workers. The deque can be stolen from by the Workers of the same
+    // node first, so the task stays on its node if possible.
+    if (preferred_node_id == CURRENT_NODE_ID || preferred_node_id == worker_node_id) {
+      if (priority == SchedulePriority::Normal && worker->_try_push_local_task(task)) return;
+
+      preferred_node_id = worker_node_id;
     }
+  } else if (preferred_node_id == CURRENT_NODE_ID) {
+    // TODO(all): Actually, this should be ANY_NODE_ID, LIGHT_LOAD_NODE or something
+    preferred_node_id = NodeID{0};
   }
 
   DebugAssert(!(static_cast<size_t>(preferred_node_id) >= _queues.size()),
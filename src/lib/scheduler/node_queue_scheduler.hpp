@@ -1,6 +1,7 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <memory>
 #include <thread>
 #include <vector>
@@ -39,6 +40,9 @@ namespace opossum {
  * There is only one active worker per CPU, which is allowed to pull new tasks from the queue.
  * Thus, while it is possible that two workers are executing a task at the same time, this is only until the non-active
  * worker finished its task. It will then be hibernated.
+ * Ready tasks scheduled by a Worker (with normal priority and no explicit node) do not go into the TaskQueue, but into
+ * the WorkStealingDeque of the Worker's ProcessingUnit. Its active Worker executes them LIFO, idle Workers steal them
+ * FIFO, preferring the deques of their own node before going remote.
  *
  *
  * SCHEDULER AND TOPOLOGY
@@ -56,20 +60,26 @@ namespace opossum {
  *
  * WORK STEALING
  *
- * Currently, a simple work stealing is implemented. Work stealing is useful to avoid idle workers (and therefore
- * idle CPUs) while there are still tasks in the system that need to be processed. A worker gets idle if it can not
- * pull a ready task. This occurs in two cases:
- *  1) all tasks in the queue are not ready
- *  2) the queue is empty
- * In both cases the current worker is checking another queue for a ready task. Checking another queue means accessing
- * another node (remote node). As of the physical distance of nodes, accessing a remote nodes is ~1.6 times slower than
- * accessing a local node. [1]
- * Therefore, the current worker fetches a task from a remote queue (without removing it). Then, the current worker
- * is sleeping some milliseconds to give any local worker of the remote node the chance to pull that task. If no local
- * worker of the remote node pulled the task, the current worker is pulling the task and therefore steals it.
- * Afterwards, the current worker is checking its local queue gain.
+ * Work stealing is useful to avoid idle workers (and therefore idle CPUs) while there are still tasks in the system
+ * that need to be processed. A worker gets idle if neither the deque of its ProcessingUnit nor its node's queue hold a
+ * ready task. It then first steals from the deques of the other ProcessingUnits of its node. Only if those are empty
+ * as well, it checks the queues of other nodes (remote nodes). As of the physical distance of nodes, accessing a
+ * remote node is ~1.6 times slower than accessing a local node. [1]
+ * Therefore, a worker only steals from remote nodes once it has been idle for the scheduler's steal delay. This gives
+ * the local workers of the remote node the chance to pull the task themselves, so tasks only move to another node if
+ * their own node is overloaded. The remote nodes are checked in the order of their distance in the Topology.
+ * A thief takes half of the victim's stealable tasks at once: it executes one of them and pushes the others into the
+ * queue of its own node. Thus, an overloaded node is relieved without every idle worker of the other nodes accessing
+ * its queue for every single task. Tasks with SchedulePriority::Unstealable are never stolen from a queue.
  *
  * [1] http://frankdenneman.nl/2016/07/13/numa-deep-dive-4-local-memory-optimization/
+ *
+ *
+ * INSTRUMENTATION
+ *
+ * Each Worker maintains WorkerStatistics (executed and stolen tasks, time spent busy and time its tasks waited in the
+ * queue). Together with the current queue sizes, they can be queried with "SELECT * FROM meta_scheduler". For
+ * per-task timelines, enable the TaskTracer and write its events as a Chrome trace.
  */
 
 class ProcessingUnit;
@@ -82,7 +92,13 @@ class UidAllocator;
  */
 class NodeQueueScheduler : public AbstractScheduler {
  public:
-  explicit NodeQueueScheduler(std::shared_ptr<Topology> setup);
+  static constexpr std::chrono::microseconds DEFAULT_STEAL_DELAY{100};
+
+  /**
+   * @param steal_delay is how long a Worker has to be idle before it steals tasks from other nodes (see WORK STEALING)
+   */
+  explicit NodeQueueScheduler(std::shared_ptr<Topology> setup,
+                              std::chrono::microseconds steal_delay = DEFAULT_STEAL_DELAY);
   ~NodeQueueScheduler();
 
   /**
@@ -95,15 +111,24 @@ class NodeQueueScheduler : public AbstractScheduler {
 
   const std::vector<std::shared_ptr<TaskQueue>>& queues() const override;
 
+  const std::vector<std::shared_ptr<ProcessingUnit>>& processing_units() const;
+
+  std::chrono::microseconds steal_delay() const;
+
   /**
    * @param task
-   * @param preferred_node_id The Task will be initially added to this node, but might get stolen by other Nodes later
+   * @param preferred_node_id The Task will be initially added to this node, but might get stolen by other Nodes later.
+   *                          If the topology has no such node, the Task is treated as if CURRENT_NODE_ID was passed.
    * @param priority Determines whether tasks are inserted at the beginning or end of the queue.
    */
   void schedule(std::shared_ptr<AbstractTask> task, NodeID preferred_node_id = CURRENT_NODE_ID,
                 SchedulePriority priority = SchedulePriority::Normal) override;
 
  private:
+  // The TaskQueues of all nodes but @param node_id in the order in which the Workers of that node steal from them
+  std::vector<std::shared_ptr<TaskQueue>> _remote_queues_by_distance(NodeID node_id) const;
+
+  const std::chrono::microseconds _steal_delay;
   std::atomic<TaskID> _task_counter{TaskID{0}};
   std::shared_ptr<UidAllocator> _worker_id_allocator;
   std::vector<std::shared_ptr<TaskQueue>> _queues;
@@ -1,6 +1,7 @@
 #include "operator_task.hpp"
 
 #include <memory>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -8,45 +9,119 @@
 
 #include "operators/abstract_operator.hpp"
 #include "operators/abstract_read_write_operator.hpp"
+#include "operators/operator_pipeline.hpp"
+
+#include "utils/assert.hpp"
 
 #include "scheduler/job_task.hpp"
 #include "scheduler/processing_unit.hpp"
 #include "scheduler/worker.hpp"
 
 namespace opossum {
-OperatorTask::OperatorTask(std::shared_ptr<AbstractOperator> op) : _op(std::move(op)) {}
+OperatorTask::OperatorTask(std::shared_ptr<AbstractOperator> op, std::shared_ptr<OperatorPipeline> pipeline)
+    : _op(std::move(op)), _pipeline(std::move(pipeline)) {
+  DebugAssert(!_pipeline || _pipeline->operators().back() == _op, "Pipeline has to end with the task's operator");
+}
 
 std::string OperatorTask::description() const {
-  return "OperatorTask with id: " + std::to_string(id()) + " for op: " + _op->description();
+  return "OperatorTask with id: " + std::to_string(id()) +
+         (_pipeline ? " for " + _pipeline->description() : " for op: " + _op->description());
 }
 
 const std::vector<std::shared_ptr<OperatorTask>> OperatorTask::make_tasks_from_operator(
-    std::shared_ptr<AbstractOperator> op) {
+    std::shared_ptr<AbstractOperator> op, const UsePipelining use_pipelining) {
+  return make_tasks_from_operators({std::move(op)}, use_pipelining);
+}
+
+const std::vector<std::shared_ptr<OperatorTask>> OperatorTask::make_tasks_from_operators(
+    const std::vector<std::shared_ptr<AbstractOperator>>& ops, const UsePipelining use_pipelining) {
   std::vector<std::shared_ptr<OperatorTask>> tasks;
   std::unordered_map<std::shared_ptr<AbstractOperator>, std::shared_ptr<OperatorTask>> task_by_op;
-  OperatorTask::_add_tasks_from_operator(op, tasks, task_by_op);
+
+  if (use_pipelining == UsePipelining::No) {
+    for (const auto& op : ops) {
+      OperatorTask::_add_tasks_from_operator(op, tasks, task_by_op, nullptr);
+    }
+    return tasks;
+  }
+
+  // An operator can only be fused with its consumer if there is no other consumer that needs its output. Operators
+  // that consume a subselect count as consumers as well.
+  std::unordered_map<std::shared_ptr<AbstractOperator>, size_t> consumer_count_by_op;
+  auto op_stack = ops;
+  std::unordered_set<std::shared_ptr<AbstractOperator>> visited_ops;
+  while (!op_stack.empty()) {
+    const auto current_op = op_stack.back();
+    op_stack.pop_back();
+    if (!visited_ops.emplace(current_op).second) continue;
+
+    for (const auto& input : _dependencies_of(*current_op)) {
+      ++consumer_count_by_op[input];
+      op_stack.push_back(input);
+    }
+  }
+
+  for (const auto& op : ops) {
+    OperatorTask::_add_tasks_from_operator(op, tasks, task_by_op, &consumer_count_by_op);
+  }
   return tasks;
 }
 
+std::vector<std::shared_ptr<AbstractOperator>> OperatorTask::_dependencies_of(const AbstractOperator& op) {
+  auto dependencies = op.subselect_operators();
+  if (const auto left = op.mutable_input_left()) dependencies.emplace_back(left);
+  if (const auto right = op.mutable_input_right()) dependencies.emplace_back(right);
+  return dependencies;
+}
+
 std::shared_ptr<OperatorTask> OperatorTask::_add_tasks_from_operator(
     std::shared_ptr<AbstractOperator> op, std::vector<std::shared_ptr<OperatorTask>>& tasks,
-    std::unordered_map<std::shared_ptr<AbstractOperator>, std::shared_ptr<OperatorTask>>& task_by_op) {
+    std::unordered_map<std::shared_ptr<AbstractOperator>, std::shared_ptr<OperatorTask>>& task_by_op,
+    const std::unordered_map<std::shared_ptr<AbstractOperator>, size_t>* consumer_count_by_op) {
   const auto task_by_op_it = task_by_op.find(op);
   if (task_by_op_it != task_by_op.end()) return task_by_op_it->second;
 
-  const auto task = std::make_shared<OperatorTask>(op);
-  task_by_op.emplace(op, task);
+  // Collect the chain of pipelineable operators ending in op. Its first operator provides the inputs of the task.
+  auto pipelined_ops = std::vector<std::shared_ptr<AbstractOperator>>{op};
+  if (consumer_count_by_op && op->is_pipelineable()) {
+    while (true) {
+      const auto input = pipelined_ops.front()->mutable_input_left();
+      if (!input || !input->is_pipelineable() || input->pipeline_outputs_data_columns()) break;
+      if (consumer_count_by_op->at(input) != 1) break;
+      pipelined_ops.insert(pipelined_ops.begin(), input);
+    }
+  }
+
+  auto pipeline = std::shared_ptr<OperatorPipeline>{};
+  if (pipelined_ops.size() > 1) pipeline = std::make_shared<OperatorPipeline>(pipelined_ops);
+
+  const auto task = std::make_shared<OperatorTask>(op, pipeline);
+  for (const auto& pipelined_op : pipelined_ops) {
+    task_by_op.emplace(pipelined_op, task);
+  }
+
+  const auto& source_op = pipelined_ops.front();
 
-  if (auto left = op->mutable_input_left()) {
-    auto subtree_root = OperatorTask::_add_tasks_from_operator(left, tasks, task_by_op);
+  if (auto left = source_op->mutable_input_left()) {
+    auto subtree_root = OperatorTask::_add_tasks_from_operator(left, tasks, task_by_op, consumer_count_by_op);
     subtree_root->set_as_predecessor_of(task);
   }
 
-  if (auto right = op->mutable_input_right()) {
-    auto subtree_root = OperatorTask::_add_tasks_from_operator(right, tasks, task_by_op);
+  if (auto right = source_op->mutable_input_right()) {
+    auto subtree_root = OperatorTask::_add_tasks_from_operator(right, tasks, task_by_op, consumer_count_by_op);
     subtree_root->set_as_predecessor_of(task);
   }
 
+  // Subselects are independent of the inputs and can be executed concurrently to them. Every operator of a pipeline
+  // might have some.
+  for (const auto& pipelined_op : pipelined_ops) {
+    for (const auto& subselect_op : pipelined_op->subselect_operators()) {
+      auto subtree_root =
+          OperatorTask::_add_tasks_from_operator(subselect_op, tasks, task_by_op, consumer_count_by_op);
+      subtree_root->set_as_predecessor_of(task);
+    }
+  }
+
   // Add AFTER the inputs to establish a task order where predecessor get executed before successors
   tasks.push_back(task);
 
@@ -55,6 +130,8 @@ std::shared_ptr<OperatorTask> OperatorTask::_add_tasks_from_operator(
 
 const std::shared_ptr<AbstractOperator>& OperatorTask::get_operator() const { return _op; }
 
+const std::shared_ptr<OperatorPipeline>& OperatorTask::get_pipeline() const { return _pipeline; }
+
 void OperatorTask::_on_execute() {
   auto context = _op->transaction_context();
   if (context) {
@@ -79,7 +156,11 @@ void OperatorTask::_on_execute() {
     }
   }
 
-  _op->execute();
+  if (_pipeline) {
+    _pipeline->execute();
+  } else {
+    _op->execute();
+  }
 
   /**
    * Check whether the operator is a ReadWrite operator, and if it is, whether it failed.
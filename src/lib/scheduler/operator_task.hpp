@@ -5,40 +5,63 @@
 #include <vector>
 
 #include "scheduler/abstract_task.hpp"
+#include "types.hpp"
 
 namespace opossum {
 
 class AbstractOperator;
+class OperatorPipeline;
 
 /**
- * Makes an AbstractOperator scheduleable
+ * Makes an AbstractOperator scheduleable. If a pipeline is given, the task executes the entire pipeline instead, which
+ * has to end with op.
  */
 class OperatorTask : public AbstractTask {
  public:
-  explicit OperatorTask(std::shared_ptr<AbstractOperator> op);
+  explicit OperatorTask(std::shared_ptr<AbstractOperator> op, std::shared_ptr<OperatorPipeline> pipeline = nullptr);
 
   /**
-   * Create tasks recursively from result operator and set task dependencies automatically.
+   * Create tasks recursively from result operator and set task dependencies automatically. Subselects of an operator
+   * become predecessors of its task, so that the entire DAG can be scheduled at once.
+   * With pipelining, every chain of pipelineable operators in which each operator only has a single consumer is fused
+   * into a single task that executes the chain as an OperatorPipeline (see operators/operator_pipeline.hpp).
    */
   static const std::vector<std::shared_ptr<OperatorTask>> make_tasks_from_operator(
-      std::shared_ptr<AbstractOperator> op);
+      std::shared_ptr<AbstractOperator> op, const UsePipelining use_pipelining = UsePipelining::No);
+
+  /**
+   * Like make_tasks_from_operator(), but for multiple operator trees that are scheduled as a single DAG. Operators
+   * that are shared between the trees are only wrapped in a single task.
+   */
+  static const std::vector<std::shared_ptr<OperatorTask>> make_tasks_from_operators(
+      const std::vector<std::shared_ptr<AbstractOperator>>& ops,
+      const UsePipelining use_pipelining = UsePipelining::No);
 
   const std::shared_ptr<AbstractOperator>& get_operator() const;
 
+  // nullptr if the task only executes get_operator()
+  const std::shared_ptr<OperatorPipeline>& get_pipeline() const;
+
   std::string description() const override;
 
  protected:
   void _on_execute() override;
 
+  // Inputs and subselects of op, i.e., the operators that have to be executed before op
+  static std::vector<std::shared_ptr<AbstractOperator>> _dependencies_of(const AbstractOperator& op);
+
   /**
    * Create tasks recursively. Called by `make_tasks_from_operator`. Returns the root of the subtree that was added.
    * @param task_by_op  Cache to avoid creating duplicate Tasks for diamond shapes
+   * @param consumer_count_by_op  Number of consumers of every operator, only passed if pipelining is used
    */
   static std::shared_ptr<OperatorTask> _add_tasks_from_operator(
       std::shared_ptr<AbstractOperator> op, std::vector<std::shared_ptr<OperatorTask>>& tasks,
-      std::unordered_map<std::shared_ptr<AbstractOperator>, std::shared_ptr<OperatorTask>>& task_by_op);
+      std::unordered_map<std::shared_ptr<AbstractOperator>, std::shared_ptr<OperatorTask>>& task_by_op,
+      const std::unordered_map<std::shared_ptr<AbstractOperator>, size_t>* consumer_count_by_op);
 
  private:
   std::shared_ptr<AbstractOperator> _op;
+  std::shared_ptr<OperatorPipeline> _pipeline;
 };
 }  // namespace opossum
@@ -2,8 +2,12 @@
 
 #include <functional>
 #include <memory>
+#include <utility>
+#include <vector>
 
+#include "task_queue.hpp"
 #include "uid_allocator.hpp"
+#include "work_stealing_deque.hpp"
 #include "worker.hpp"
 
 // It is important to limit the number of workers per core to avoid
@@ -13,9 +17,17 @@ static constexpr size_t MAX_WORKERS_PER_CORE = 200;
 
 namespace opossum {
 
-ProcessingUnit::ProcessingUnit(std::shared_ptr<TaskQueue> queue, std::shared_ptr<UidAllocator> worker_id_allocator,
-                               CpuID cpu_id)
-    : _queue(queue), _worker_id_allocator(worker_id_allocator), _cpu_id(cpu_id) {
+ProcessingUnit::ProcessingUnit(std::shared_ptr<TaskQueue> queue, std::vector<std::shared_ptr<TaskQueue>> remote_queues,
+                               std::shared_ptr<UidAllocator> worker_id_allocator, CpuID cpu_id,
+                               std::chrono::microseconds steal_delay)
+    : _queue(queue),
+      _remote_queues(std::move(remote_queues)),
+      _deque(std::make_shared<WorkStealingDeque>()),
+      _worker_id_allocator(worker_id_allocator),
+      _cpu_id(cpu_id),
+      _steal_delay(steal_delay) {
+  _queue->register_local_deque(_deque);
+
   // Do not start worker yet, the object is still under construction and no shared_ptr of it is held right now -
   // shared_from_this will fail!
 }
@@ -42,6 +54,26 @@ void ProcessingUnit::yield_active_worker_token(WorkerID worker_id) {
   _active_worker_token.compare_exchange_strong(worker_id, INVALID_WORKER_ID);
 }
 
+bool ProcessingUnit::try_push_local_task(const std::shared_ptr<AbstractTask>& task, WorkerID worker_id) {
+  if (_active_worker_token != worker_id) return false;
+
+  _queue->push_local(*_deque, task);
+  return true;
+}
+
+std::shared_ptr<AbstractTask> ProcessingUnit::pop_local_task() { return _deque->pop(); }
+
+const std::shared_ptr<WorkStealingDeque>& ProcessingUnit::deque() const { return _deque; }
+
+const std::vector<std::shared_ptr<TaskQueue>>& ProcessingUnit::remote_queues() const { return _remote_queues; }
+
+std::chrono::microseconds ProcessingUnit::steal_delay() const { return _steal_delay; }
+
+std::vector<std::shared_ptr<Worker>> ProcessingUnit::workers() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _workers;
+}
+
 void ProcessingUnit::hibernate_calling_worker() {
   std::unique_lock<std::mutex> lock(_hibernation_mutex);
 
@@ -81,6 +113,9 @@ void ProcessingUnit::shutdown() {
     _shutdown_flag = true;
   }
   _hibernation_cv.notify_all();
+
+  // Wake up workers parked in the queue so that they notice the shutdown
+  _queue->notify_all_workers();
 }
 
 bool ProcessingUnit::shutdown_flag() const { return _shutdown_flag; }
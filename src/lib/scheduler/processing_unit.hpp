@@ -1,6 +1,7 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <memory>
 #include <mutex>
@@ -11,8 +12,10 @@
 
 namespace opossum {
 
+class AbstractTask;
 class UidAllocator;
 class TaskQueue;
+class WorkStealingDeque;
 class Worker;
 
 /**
@@ -21,7 +24,13 @@ class Worker;
  */
 class ProcessingUnit final : public std::enable_shared_from_this<ProcessingUnit> {
  public:
-  ProcessingUnit(std::shared_ptr<TaskQueue> queue, std::shared_ptr<UidAllocator> worker_id_allocator, CpuID cpu_id);
+  /**
+   * @param remote_queues are the TaskQueues of the other nodes in the order that the Workers try to steal from them
+   * @param steal_delay see NodeQueueScheduler
+   */
+  ProcessingUnit(std::shared_ptr<TaskQueue> queue, std::vector<std::shared_ptr<TaskQueue>> remote_queues,
+                 std::shared_ptr<UidAllocator> worker_id_allocator, CpuID cpu_id,
+                 std::chrono::microseconds steal_delay = std::chrono::microseconds{0});
 
   bool shutdown_flag() const;
 
@@ -38,6 +47,31 @@ class ProcessingUnit final : public std::enable_shared_from_this<ProcessingUnit>
    */
   void yield_active_worker_token(WorkerID worked_id);
 
+  /**
+   * Pushes a ready task into the deque of this ProcessingUnit. Only the active Worker may do so, otherwise (i.e., if
+   * @worker_id does not own the active worker token) nothing happens and false is returned.
+   */
+  bool try_push_local_task(const std::shared_ptr<AbstractTask>& task, WorkerID worker_id);
+
+  /**
+   * Returns the most recently pushed task of the deque. Only to be called by the active Worker.
+   */
+  std::shared_ptr<AbstractTask> pop_local_task();
+
+  const std::shared_ptr<WorkStealingDeque>& deque() const;
+
+  const std::vector<std::shared_ptr<TaskQueue>>& remote_queues() const;
+
+  /**
+   * How long the Workers have to be idle before they steal tasks from remote_queues()
+   */
+  std::chrono::microseconds steal_delay() const;
+
+  /**
+   * All Workers created for this ProcessingUnit so far, including hibernated ones
+   */
+  std::vector<std::shared_ptr<Worker>> workers() const;
+
   /**
    * Put the Worker into hibernation state, which means it will only wake up when the Scheduler is shutting down or
    * when the ProcessingUnit needs a new worker to be active (i.e. when the currently active worker waits for jobs)
@@ -64,9 +98,12 @@ class ProcessingUnit final : public std::enable_shared_from_this<ProcessingUnit>
 
  private:
   std::shared_ptr<TaskQueue> _queue;
+  const std::vector<std::shared_ptr<TaskQueue>> _remote_queues;
+  std::shared_ptr<WorkStealingDeque> _deque;
   std::shared_ptr<UidAllocator> _worker_id_allocator;
   CpuID _cpu_id;
-  std::mutex _mutex;  // Synchronizes access to _threads, _workers
+  const std::chrono::microseconds _steal_delay;
+  mutable std::mutex _mutex;  // Synchronizes access to _threads, _workers
   std::vector<std::thread> _threads;
   std::vector<std::shared_ptr<Worker>> _workers;
   std::atomic_bool _shutdown_flag{false};
@@ -0,0 +1,66 @@
+#include "scheduler_statistics.hpp"
+
+#include <memory>
+#include <vector>
+
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/processing_unit.hpp"
+#include "scheduler/task_queue.hpp"
+#include "scheduler/worker.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+std::shared_ptr<Table> generate_scheduler_statistics_table() {
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("node_id", DataType::Int);
+  column_definitions.emplace_back("cpu_id", DataType::Int);
+  column_definitions.emplace_back("worker_id", DataType::Int);
+  column_definitions.emplace_back("queue_size", DataType::Long);
+  column_definitions.emplace_back("executed_tasks", DataType::Long);
+  column_definitions.emplace_back("local_tasks", DataType::Long);
+  column_definitions.emplace_back("queue_tasks", DataType::Long);
+  column_definitions.emplace_back("stolen_node_tasks", DataType::Long);
+  column_definitions.emplace_back("stolen_remote_tasks", DataType::Long);
+  column_definitions.emplace_back("failed_steals", DataType::Long);
+  column_definitions.emplace_back("parks", DataType::Long);
+  column_definitions.emplace_back("busy_time_us", DataType::Long);
+  column_definitions.emplace_back("queue_wait_time_us", DataType::Long);
+
+  auto table = std::make_shared<Table>(column_definitions, TableType::Data, Chunk::MAX_SIZE, UseMvcc::Yes);
+
+  const auto scheduler = std::dynamic_pointer_cast<NodeQueueScheduler>(CurrentScheduler::get());
+  if (!scheduler) return table;
+
+  for (const auto& processing_unit : scheduler->processing_units()) {
+    for (const auto& worker : processing_unit->workers()) {
+      const auto& statistics = worker->statistics();
+      const auto& queue = worker->queue();
+
+      table->append({static_cast<int32_t>(queue->node_id()), static_cast<int32_t>(worker->cpu_id()),
+                     static_cast<int32_t>(worker->id()), static_cast<int64_t>(queue->size()),
+                     static_cast<int64_t>(statistics.num_executed_tasks.load()),
+                     static_cast<int64_t>(statistics.num_local_tasks.load()),
+                     static_cast<int64_t>(statistics.num_queue_tasks.load()),
+                     static_cast<int64_t>(statistics.num_stolen_node_tasks.load()),
+                     static_cast<int64_t>(statistics.num_stolen_remote_tasks.load()),
+                     static_cast<int64_t>(statistics.num_failed_steals.load()),
+                     static_cast<int64_t>(statistics.num_parks.load()),
+                     static_cast<int64_t>(statistics.busy_time_ns.load() / 1'000),
+                     static_cast<int64_t>(statistics.queue_wait_time_ns.load() / 1'000)});
+    }
+  }
+
+  // Table::append() adds uncommitted rows. Like the rows of a loaded table (see load_table()), they have to be visible
+  // to all transactions, since the Validate of a query would filter them otherwise.
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    auto mvcc_columns = table->get_chunk(chunk_id)->mvcc_columns();
+    for (auto& begin_cid : mvcc_columns->begin_cids) begin_cid = 0;
+    mvcc_columns->update_summary();
+  }
+
+  return table;
+}
+
+}  // namespace opossum
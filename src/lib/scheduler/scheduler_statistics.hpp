@@ -0,0 +1,52 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+/**
+ * Counters maintained by each Worker. They are only written by the Worker's own thread, so relaxed increments suffice
+ * and cost no more than a plain increment. Other threads may read them at any time (e.g., for meta_scheduler).
+ * Aligned to a cache line so that the counters of different Workers do not share one.
+ */
+struct alignas(64) WorkerStatistics {
+  // Tasks executed by this Worker, including those executed while waiting for other tasks
+  std::atomic<uint64_t> num_executed_tasks{0};
+
+  // Where the executed tasks came from
+  std::atomic<uint64_t> num_local_tasks{0};          // Deque of the Worker's own ProcessingUnit
+  std::atomic<uint64_t> num_queue_tasks{0};          // TaskQueue of the Worker's node
+  std::atomic<uint64_t> num_stolen_node_tasks{0};    // Deque of another ProcessingUnit of the same node
+  std::atomic<uint64_t> num_stolen_remote_tasks{0};  // Queue or deque of another node
+
+  // Number of times the Worker tried to steal a task from the queues of the other nodes and did not find any
+  std::atomic<uint64_t> num_failed_steals{0};
+
+  // Number of times the Worker parked in its TaskQueue because spinning did not find a task
+  std::atomic<uint64_t> num_parks{0};
+
+  // Time spent executing tasks. Tasks executed while waiting for another task only count towards the outer task.
+  std::atomic<uint64_t> busy_time_ns{0};
+
+  // Summed time between the executed tasks being enqueued and being started
+  std::atomic<uint64_t> queue_wait_time_ns{0};
+};
+
+inline void increment_statistic(std::atomic<uint64_t>& counter, uint64_t delta = 1) {
+  counter.store(counter.load(std::memory_order_relaxed) + delta, std::memory_order_relaxed);
+}
+
+/**
+ * Generates the contents of the meta_scheduler table (see StorageManager) from the current Scheduler. It holds one row
+ * per Worker with its counters and the number of ready tasks in the TaskQueue of its node. The table is empty if no
+ * NodeQueueScheduler is active.
+ */
+std::shared_ptr<Table> generate_scheduler_statistics_table();
+
+}  // namespace opossum
@@ -1,16 +1,36 @@
 #include "task_queue.hpp"
 
+#include <algorithm>
 #include <memory>
 #include <utility>
 
 #include "abstract_task.hpp"
 #include "utils/assert.hpp"
+#include "work_stealing_deque.hpp"
 
 namespace opossum {
 
 TaskQueue::TaskQueue(NodeID node_id) : _node_id(node_id) {}
 
-bool TaskQueue::empty() const { return _num_tasks == 0; }
+bool TaskQueue::empty() const {
+  if (_num_tasks > 0) return false;
+
+  for (const auto& deque : _local_deques) {
+    if (!deque->empty()) return false;
+  }
+
+  return true;
+}
+
+size_t TaskQueue::size() const {
+  auto size = static_cast<size_t>(_num_tasks);
+
+  for (const auto& deque : _local_deques) {
+    size += deque->size();
+  }
+
+  return size;
+}
 
 NodeID TaskQueue::node_id() const { return _node_id; }
 
@@ -24,6 +44,42 @@ void TaskQueue::push(std::shared_ptr<AbstractTask> task, uint32_t priority) {
   _queues[priority].push(task);
 
   _num_tasks++;
+
+  _notify_waiting_worker();
+}
+
+void TaskQueue::register_local_deque(const std::shared_ptr<WorkStealingDeque>& deque) {
+  _local_deques.emplace_back(deque);
+}
+
+void TaskQueue::push_local(WorkStealingDeque& deque, std::shared_ptr<AbstractTask> task) {
+  if (!task->try_mark_as_enqueued()) return;
+
+  task->set_node_id(_node_id);
+
+  if (deque.push(task)) {
+    // Make the task visible before checking for parked Workers, see _notify_waiting_worker()
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+  } else {
+    _queues[static_cast<uint32_t>(SchedulePriority::Normal)].push(task);
+    _num_tasks++;
+  }
+
+  _notify_waiting_worker();
+}
+
+void TaskQueue::_notify_waiting_worker() {
+  /**
+   * The task counters and _num_waiting_workers are sequentially consistent. Thus, either the parking Worker sees the
+   * new task before it waits, or we see the Worker and signal it. Acquiring the mutex makes sure that the Worker is
+   * either not yet checking its wait condition or is already waiting, so that the signal does not get lost.
+   */
+  if (_num_waiting_workers > 0) {
+    {
+      std::lock_guard<std::mutex> lock(_wakeup_mutex);
+    }
+    _wakeup_cv.notify_one();
+  }
 }
 
 std::shared_ptr<AbstractTask> TaskQueue::pull() {
@@ -39,18 +95,75 @@ std::shared_ptr<AbstractTask> TaskQueue::pull() {
   return nullptr;
 }
 
-std::shared_ptr<AbstractTask> TaskQueue::steal() {
-  std::shared_ptr<AbstractTask> task;
-  for (auto i : {SchedulePriority::High, SchedulePriority::Normal}) {
-    auto& queue = _queues[static_cast<uint32_t>(i)];
-    queue.try_pop(task);
+std::shared_ptr<AbstractTask> TaskQueue::steal_local(const WorkStealingDeque* excluded_deque) {
+  // Start at a different deque every time, so that thieves do not all compete for the first one
+  const auto num_deques = _local_deques.size();
+  const auto first_victim = _next_steal_victim++;
+
+  for (auto deque_idx = size_t{0}; deque_idx < num_deques; ++deque_idx) {
+    const auto& deque = _local_deques[(first_victim + deque_idx) % num_deques];
+    if (deque.get() == excluded_deque) continue;
+
+    auto task = deque->steal();
+    if (task) return task;
+  }
+  return nullptr;
+}
+
+void TaskQueue::wait_for_task(std::chrono::microseconds timeout) {
+  std::unique_lock<std::mutex> lock(_wakeup_mutex);
+
+  const auto wakeup_epoch = _wakeup_epoch;
+
+  _num_waiting_workers++;
+  _wakeup_cv.wait_for(lock, timeout, [&]() { return !empty() || _wakeup_epoch != wakeup_epoch; });
+  _num_waiting_workers--;
+}
+
+void TaskQueue::notify_all_workers() {
+  {
+    std::lock_guard<std::mutex> lock(_wakeup_mutex);
+    ++_wakeup_epoch;
+  }
+  _wakeup_cv.notify_all();
+}
+
+std::shared_ptr<AbstractTask> TaskQueue::steal(TaskQueue& thief_queue) {
+  DebugAssert(&thief_queue != this, "A TaskQueue cannot steal from itself");
+
+  std::shared_ptr<AbstractTask> stolen_task;
+
+  for (auto priority : {SchedulePriority::High, SchedulePriority::Normal}) {
+    auto& queue = _queues[static_cast<uint32_t>(priority)];
+
+    // unsafe_size() is only a snapshot, but a batch of the wrong size does no harm
+    const auto batch_size = std::max(static_cast<size_t>(queue.unsafe_size()) / 2, size_t{1});
+
+    for (auto task_idx = size_t{0}; task_idx < batch_size; ++task_idx) {
+      std::shared_ptr<AbstractTask> task;
+      if (!queue.try_pop(task)) break;
 
-    if (task) {
       _num_tasks--;
-      return task;
+      task->set_node_id(thief_queue.node_id());
+
+      if (!stolen_task) {
+        stolen_task = std::move(task);
+      } else {
+        thief_queue.push_enqueued(std::move(task), static_cast<uint32_t>(priority));
+      }
     }
+
+    if (stolen_task) return stolen_task;
   }
+
   return nullptr;
 }
 
+void TaskQueue::push_enqueued(std::shared_ptr<AbstractTask> task, uint32_t priority) {
+  _queues[priority].push(std::move(task));
+  _num_tasks++;
+
+  _notify_waiting_worker();
+}
+
 }  // namespace opossum
@@ -4,16 +4,23 @@
 #include <tbb/concurrent_queue.h>
 #include <array>
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <memory>
+#include <mutex>
+#include <vector>
 
 #include "types.hpp"
 
 namespace opossum {
 
 class AbstractTask;
+class WorkStealingDeque;
 
 /**
- * Holds a queue of AbstractTasks, usually one of these exists per node
+ * Holds a queue of AbstractTasks, usually one of these exists per node.
+ * Additionally, it knows the WorkStealingDeques of the node's ProcessingUnits, which hold the tasks spawned by their
+ * Workers. Those tasks are counted as part of this queue (e.g., by empty()) and can be stolen via steal_local().
  */
 class TaskQueue {
  public:
@@ -23,24 +30,80 @@ class TaskQueue {
 
   bool empty() const;
 
+  /**
+   * Number of ready tasks in this queue and the registered deques. Only a snapshot, as Workers push and pull
+   * concurrently.
+   */
+  size_t size() const;
+
   NodeID node_id() const;
 
   void push(std::shared_ptr<AbstractTask> task, uint32_t priority);
 
+  /**
+   * Registers the deque of a ProcessingUnit of this node. Must be called before the first Worker of the node starts.
+   */
+  void register_local_deque(const std::shared_ptr<WorkStealingDeque>& deque);
+
+  /**
+   * Pushes a task into one of the registered deques. Only to be called by the owner of the deque (see
+   * ProcessingUnit::try_push_local_task()). Falls back to push() with normal priority if the deque is full.
+   */
+  void push_local(WorkStealingDeque& deque, std::shared_ptr<AbstractTask> task);
+
   /**
    * Returns a Tasks that is ready to be executed and removes it from the queue
    */
   std::shared_ptr<AbstractTask> pull();
 
   /**
-   * Returns a Tasks that is ready to be executed and removes it from one of the stealable queues
+   * Steals half of the tasks in the stealable queues (i.e., all but SchedulePriority::Unstealable), but at least one.
+   * Returns one of them to be executed by the thief and pushes the others into @param thief_queue, where the other
+   * Workers of the thief's node can pick them up. Stealing in batches means that the thieves do not have to come back
+   * (and compete with the victim's Workers) for every single task.
+   * Returns nullptr if there are no stealable tasks.
+   */
+  std::shared_ptr<AbstractTask> steal(TaskQueue& thief_queue);
+
+  /**
+   * Returns the oldest task of one of the registered deques and removes it from there. excluded_deque, usually the
+   * deque of the calling Worker, is skipped.
    */
-  std::shared_ptr<AbstractTask> steal();
+  std::shared_ptr<AbstractTask> steal_local(const WorkStealingDeque* excluded_deque = nullptr);
+
+  /**
+   * Pushes a task that was enqueued before, e.g., in another TaskQueue that it was stolen from, or that was deferred
+   * because its query reached its task limit (see QueryTaskLimit)
+   */
+  void push_enqueued(std::shared_ptr<AbstractTask> task, uint32_t priority);
+
+  /**
+   * Parks the calling Worker until a task is pushed into this queue, notify_all_workers() is called or the timeout
+   * expires, whichever comes first. Returns immediately if the queue is not empty.
+   * The timeout makes sure that parked Workers still check the other queues for tasks to steal from time to time.
+   */
+  void wait_for_task(std::chrono::microseconds timeout);
+
+  /**
+   * Wakes up all Workers parked in wait_for_task(), e.g., to let them notice that the Scheduler is shutting down
+   */
+  void notify_all_workers();
 
  private:
+  void _notify_waiting_worker();
+
   NodeID _node_id;
   std::array<tbb::concurrent_queue<std::shared_ptr<AbstractTask>>, NUM_PRIORITY_LEVELS> _queues;
   std::atomic_uint _num_tasks{0};
+
+  std::vector<std::shared_ptr<WorkStealingDeque>> _local_deques;
+  std::atomic_uint _next_steal_victim{0};
+
+  // push() only has to acquire the mutex and signal the condition variable if any Worker is parked
+  std::atomic_uint _num_waiting_workers{0};
+  std::mutex _wakeup_mutex;
+  std::condition_variable _wakeup_cv;
+  uint64_t _wakeup_epoch{0};  // Guarded by _wakeup_mutex, incremented by notify_all_workers()
 };
 
 }  // namespace opossum
@@ -0,0 +1,80 @@
+#include "task_tracer.hpp"
+
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "json.hpp"
+
+namespace opossum {
+
+TaskTracer& TaskTracer::get() {
+  static TaskTracer instance;
+  return instance;
+}
+
+void TaskTracer::reset() {
+  auto& task_tracer = get();
+
+  task_tracer.disable();
+
+  std::lock_guard<std::mutex> lock(task_tracer._mutex);
+  task_tracer._events.clear();
+}
+
+void TaskTracer::enable() { _enabled = true; }
+
+void TaskTracer::disable() { _enabled = false; }
+
+bool TaskTracer::is_enabled() const { return _enabled.load(std::memory_order_relaxed); }
+
+void TaskTracer::record(TaskTraceEvent event) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  if (_events.size() >= MAX_NUM_EVENTS) return;
+
+  _events.emplace_back(std::move(event));
+}
+
+std::vector<TaskTraceEvent> TaskTracer::events() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _events;
+}
+
+void TaskTracer::write_chrome_trace(std::ostream& stream) const {
+  const auto events = this->events();
+
+  auto trace_start = std::chrono::steady_clock::time_point::max();
+  for (const auto& event : events) {
+    trace_start = std::min(trace_start, event.enqueue_time);
+  }
+
+  const auto to_microseconds = [](const auto duration) {
+    return std::chrono::duration<double, std::micro>(duration).count();
+  };
+
+  auto trace_events = nlohmann::json::array();
+  for (const auto& event : events) {
+    nlohmann::json trace_event;
+    trace_event["name"] = event.description;
+    trace_event["cat"] = "task";
+    trace_event["ph"] = "X";
+    trace_event["pid"] = static_cast<NodeID::base_type>(event.node_id);
+    trace_event["tid"] = event.worker_id;
+    trace_event["ts"] = to_microseconds(event.begin_time - trace_start);
+    trace_event["dur"] = to_microseconds(event.end_time - event.begin_time);
+    trace_event["args"]["task_id"] = event.task_id;
+    trace_event["args"]["query_id"] = event.query_id;
+    trace_event["args"]["queue_wait_us"] = to_microseconds(event.begin_time - event.enqueue_time);
+
+    trace_events.push_back(std::move(trace_event));
+  }
+
+  nlohmann::json trace;
+  trace["traceEvents"] = std::move(trace_events);
+  trace["displayTimeUnit"] = "ms";
+
+  stream << trace << std::endl;
+}
+
+}  // namespace opossum
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+struct TaskTraceEvent {
+  TaskID task_id;
+  QueryID query_id;
+  WorkerID worker_id;
+  NodeID node_id;
+  std::string description;
+  std::chrono::steady_clock::time_point enqueue_time;
+  std::chrono::steady_clock::time_point begin_time;
+  std::chrono::steady_clock::time_point end_time;
+};
+
+/**
+ * Records one event per task executed by a Worker while it is enabled. Disabled by default, in which case the Workers
+ * only pay for checking is_enabled(). The recorded events can be written in the Chrome trace format, which can be
+ * opened in chrome://tracing or https://ui.perfetto.dev.
+ *
+ * Since every event is recorded under a mutex, tracing is meant for diagnosing single workloads, not for running
+ * permanently.
+ */
+class TaskTracer : private Noncopyable {
+ public:
+  // Recording stops once this many events are buffered
+  static constexpr size_t MAX_NUM_EVENTS = 1'000'000;
+
+  static TaskTracer& get();
+  static void reset();
+
+  void enable();
+  void disable();
+  bool is_enabled() const;
+
+  void record(TaskTraceEvent event);
+
+  std::vector<TaskTraceEvent> events() const;
+
+  /**
+   * Writes all events as a Chrome trace JSON object. Each node is shown as a process, each Worker as a thread.
+   * Timestamps are relative to the first recorded event.
+   */
+  void write_chrome_trace(std::ostream& stream) const;
+
+ private:
+  TaskTracer() = default;
+
+  std::atomic_bool _enabled{false};
+
+  mutable std::mutex _mutex;
+  std::vector<TaskTraceEvent> _events;
+};
+
+}  // namespace opossum
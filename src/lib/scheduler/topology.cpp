@@ -5,11 +5,102 @@
 #endif
 
 #include <algorithm>
+#include <fstream>
+#include <map>
 #include <memory>
+#include <optional>
+#include <set>
+#include <sstream>
+#include <string>
 #include <thread>
 #include <utility>
 #include <vector>
 
+#include "utils/filesystem.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+std::optional<std::string> read_sysfs_file(const filesystem::path& path) {
+  auto file = std::ifstream{path};
+  if (!file) return std::nullopt;
+
+  auto content = std::string{};
+  std::getline(file, content);
+  return content;
+}
+
+// Parses CPU lists as used by sysfs, e.g., "0-3,8,10-11"
+std::vector<CpuID> parse_cpu_list(const std::string& cpu_list) {
+  std::vector<CpuID> cpu_ids;
+
+  auto stream = std::stringstream{cpu_list};
+  auto range = std::string{};
+  while (std::getline(stream, range, ',')) {
+    if (range.empty()) continue;
+
+    const auto dash_pos = range.find('-');
+    const auto first = std::stoul(range.substr(0, dash_pos));
+    const auto last = dash_pos == std::string::npos ? first : std::stoul(range.substr(dash_pos + 1));
+    for (auto cpu_id = first; cpu_id <= last; ++cpu_id) {
+      cpu_ids.emplace_back(static_cast<CpuID::base_type>(cpu_id));
+    }
+  }
+
+  return cpu_ids;
+}
+
+struct SysfsCpu {
+  CpuID cpu_id;
+
+  // The lowest CPU id among the SMT siblings identifies the physical core
+  CpuID core_id;
+
+  // The lowest CPU id among the CPUs sharing the L3 cache identifies the L3 domain, INVALID_CPU_ID if unknown
+  CpuID l3_cache_id;
+
+  NodeID numa_node_id;
+};
+
+SysfsCpu read_sysfs_cpu(const filesystem::path& cpu_path, CpuID cpu_id) {
+  auto sysfs_cpu = SysfsCpu{cpu_id, cpu_id, INVALID_CPU_ID, NodeID{0}};
+
+  const auto smt_siblings = read_sysfs_file(cpu_path / "topology" / "thread_siblings_list");
+  if (smt_siblings) {
+    const auto sibling_ids = parse_cpu_list(*smt_siblings);
+    if (!sibling_ids.empty()) sysfs_cpu.core_id = *std::min_element(sibling_ids.cbegin(), sibling_ids.cend());
+  }
+
+  for (const auto& entry : filesystem::directory_iterator(cpu_path)) {
+    // The CPU's NUMA node is linked as "node<id>"
+    const auto file_name = entry.path().filename().string();
+    if (file_name.size() > 4 && file_name.compare(0, 4, "node") == 0 &&
+        std::all_of(file_name.cbegin() + 4, file_name.cend(), ::isdigit)) {
+      sysfs_cpu.numa_node_id = NodeID{static_cast<NodeID::base_type>(std::stoul(file_name.substr(4)))};
+    }
+  }
+
+  const auto cache_path = cpu_path / "cache";
+  if (filesystem::exists(cache_path)) {
+    for (const auto& entry : filesystem::directory_iterator(cache_path)) {
+      if (read_sysfs_file(entry.path() / "level") != std::optional<std::string>{"3"}) continue;
+
+      const auto shared_cpus = read_sysfs_file(entry.path() / "shared_cpu_list");
+      if (!shared_cpus) continue;
+
+      const auto shared_cpu_ids = parse_cpu_list(*shared_cpus);
+      if (!shared_cpu_ids.empty()) {
+        sysfs_cpu.l3_cache_id = *std::min_element(shared_cpu_ids.cbegin(), shared_cpu_ids.cend());
+      }
+    }
+  }
+
+  return sysfs_cpu;
+}
+
+}  // namespace
+
 namespace opossum {
 
 void TopologyNode::print(std::ostream& stream) const {
@@ -89,20 +180,91 @@ std::shared_ptr<Topology> Topology::create_numa_topology(uint32_t max_num_cores)
         }
       }
 
-      TopologyNode node(std::move(cpus));
+      TopologyNode node(std::move(cpus), NodeID{static_cast<NodeID::base_type>(n)});
       nodes.emplace_back(std::move(node));
     }
   }
 
   numa_free_cpumask(cpu_bitmask);
-  return std::make_shared<Topology>(std::move(nodes), num_configured_cpus);
+  return std::make_shared<Topology>(std::move(nodes), num_configured_cpus, true);
+#endif
+}
+
+std::shared_ptr<Topology> Topology::create_topology(const TopologyOptions& options,
+                                                    const std::string& sysfs_cpu_path) {
+  const auto online_cpus = read_sysfs_file(filesystem::path{sysfs_cpu_path} / "online");
+  if (!online_cpus) return create_numa_topology(options.max_num_cores);
+
+  std::vector<SysfsCpu> sysfs_cpus;
+  for (const auto cpu_id : parse_cpu_list(*online_cpus)) {
+    const auto cpu_path = filesystem::path{sysfs_cpu_path} / ("cpu" + std::to_string(cpu_id));
+    if (!filesystem::exists(cpu_path)) continue;
+
+    sysfs_cpus.emplace_back(read_sysfs_cpu(cpu_path, cpu_id));
+  }
+  if (sysfs_cpus.empty()) return create_numa_topology(options.max_num_cores);
+
+  // Reserve the physical cores with the highest ids, but keep at least one
+  auto core_ids = std::set<CpuID>{};
+  for (const auto& sysfs_cpu : sysfs_cpus) {
+    core_ids.emplace(sysfs_cpu.core_id);
+  }
+
+  const auto num_reserved_cores = std::min<size_t>(options.num_reserved_cores, core_ids.size() - 1);
+  const auto reserved_core_ids = std::set<CpuID>(std::prev(core_ids.cend(), num_reserved_cores), core_ids.cend());
+
+  // Group the CPUs into nodes, sorted by NUMA node and L3 domain
+  auto cpus_by_node = std::map<std::pair<NodeID, CpuID>, std::vector<TopologyCpu>>{};
+  auto reserved_cpus = std::vector<CpuID>{};
+  auto num_cores = uint32_t{0};
+
+  for (const auto& sysfs_cpu : sysfs_cpus) {
+    if (reserved_core_ids.count(sysfs_cpu.core_id)) {
+      reserved_cpus.emplace_back(sysfs_cpu.cpu_id);
+      continue;
+    }
+
+    if (options.one_worker_per_core && sysfs_cpu.cpu_id != sysfs_cpu.core_id) continue;
+    if (options.max_num_cores != 0 && num_cores >= options.max_num_cores) continue;
+
+    const auto l3_cache_id = options.node_per_l3_cache ? sysfs_cpu.l3_cache_id : INVALID_CPU_ID;
+    cpus_by_node[{sysfs_cpu.numa_node_id, l3_cache_id}].emplace_back(sysfs_cpu.cpu_id);
+    ++num_cores;
+  }
+
+  std::vector<TopologyNode> nodes;
+  for (auto& [node_key, cpus] : cpus_by_node) {
+    nodes.emplace_back(std::move(cpus), node_key.first);
+  }
+
+  auto has_numa_distances = false;
+#if HYRISE_NUMA_SUPPORT
+  // Only the actual sysfs describes the NUMA nodes that libnuma knows about
+  has_numa_distances = sysfs_cpu_path == "/sys/devices/system/cpu" && numa_available() >= 0;
 #endif
+
+  return std::make_shared<Topology>(std::move(nodes), sysfs_cpus.size(), has_numa_distances,
+                                    std::move(reserved_cpus));
 }
 
 const std::vector<TopologyNode>& Topology::nodes() { return _nodes; }
 
 size_t Topology::num_cpus() const { return _num_cpus; }
 
+const std::vector<CpuID>& Topology::reserved_cpus() const { return _reserved_cpus; }
+
+uint32_t Topology::node_distance(NodeID from, NodeID to) const {
+#if HYRISE_NUMA_SUPPORT
+  const auto from_numa_node_id = _nodes[from].numa_node_id;
+  const auto to_numa_node_id = _nodes[to].numa_node_id;
+  if (_has_numa_distances && from_numa_node_id != INVALID_NODE_ID && to_numa_node_id != INVALID_NODE_ID) {
+    return static_cast<uint32_t>(numa_distance(from_numa_node_id, to_numa_node_id));
+  }
+#endif
+
+  return from == to ? LOCAL_NODE_DISTANCE : REMOTE_NODE_DISTANCE;
+}
+
 void Topology::print(std::ostream& stream) const {
   stream << "Number of CPUs: " << _num_cpus << std::endl;
   for (size_t node_idx = 0; node_idx < _nodes.size(); ++node_idx) {
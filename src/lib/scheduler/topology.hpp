@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <ostream>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -16,11 +17,33 @@ struct TopologyCpu final {
 };
 
 struct TopologyNode final {
-  explicit TopologyNode(std::vector<TopologyCpu>&& cpus) : cpus(std::move(cpus)) {}
+  explicit TopologyNode(std::vector<TopologyCpu>&& cpus, NodeID numa_node_id = INVALID_NODE_ID)
+      : cpus(std::move(cpus)), numa_node_id(numa_node_id) {}
 
   void print(std::ostream& stream = std::cout) const;
 
   std::vector<TopologyCpu> cpus;
+
+  // The NUMA node of the CPUs, INVALID_NODE_ID for fake topologies. If the CPUs are grouped by L3 cache (see
+  // TopologyOptions), multiple TopologyNodes share a NUMA node.
+  NodeID numa_node_id;
+};
+
+struct TopologyOptions final {
+  // A value of zero indicates no limit
+  uint32_t max_num_cores = 0;
+
+  // Only use the first hardware thread of each physical core, leaving its SMT siblings idle. Useful for workloads
+  // that are bound by the execution units or the caches the siblings would share.
+  bool one_worker_per_core = false;
+
+  // Create one node (and thus one TaskQueue) per group of cores that share an L3 cache instead of one per NUMA node.
+  // On chiplet CPUs with several L3 domains per socket, this keeps tasks and their successors within one L3 domain.
+  bool node_per_l3_cache = false;
+
+  // Number of physical cores (including their SMT siblings) that are left out of the topology, e.g., to run the
+  // server's network thread on them (see Topology::reserved_cpus()). At least one core is always kept.
+  uint32_t num_reserved_cores = 0;
 };
 
 /**
@@ -37,16 +60,49 @@ class Topology final {
                                                              uint32_t workers_per_node = 1);
   static std::shared_ptr<Topology> create_numa_topology(uint32_t max_num_cores = 0);
 
-  Topology(std::vector<TopologyNode>&& nodes, size_t num_cpus) : _nodes(std::move(nodes)), _num_cpus(num_cpus) {}
+  /**
+   * Detects the topology from @param sysfs_cpu_path, including the SMT siblings and the L3 caches shared by the CPUs,
+   * and applies @param options. Falls back to create_numa_topology() if the CPUs cannot be read from there (e.g., on
+   * non-Linux systems).
+   */
+  static std::shared_ptr<Topology> create_topology(const TopologyOptions& options = {},
+                                                   const std::string& sysfs_cpu_path = "/sys/devices/system/cpu");
+
+  /**
+   * @param has_numa_distances Whether node_distance() may ask libnuma for the distances of the nodes' NUMA nodes
+   */
+  Topology(std::vector<TopologyNode>&& nodes, size_t num_cpus, bool has_numa_distances = false,
+           std::vector<CpuID> reserved_cpus = {})
+      : _nodes(std::move(nodes)),
+        _num_cpus(num_cpus),
+        _has_numa_distances(has_numa_distances),
+        _reserved_cpus(std::move(reserved_cpus)) {}
 
   const std::vector<TopologyNode>& nodes();
 
   size_t num_cpus() const;
 
+  /**
+   * CPUs that are not used by any node because their cores were reserved (see TopologyOptions::num_reserved_cores)
+   */
+  const std::vector<CpuID>& reserved_cpus() const;
+
+  /**
+   * Relative cost of accessing the memory of node @param to from node @param from, as reported by the ACPI SLIT table
+   * (i.e., 10 for local accesses). Fake topologies report LOCAL_NODE_DISTANCE for the same node and
+   * REMOTE_NODE_DISTANCE for all other nodes.
+   */
+  uint32_t node_distance(NodeID from, NodeID to) const;
+
+  static constexpr uint32_t LOCAL_NODE_DISTANCE = 10;
+  static constexpr uint32_t REMOTE_NODE_DISTANCE = 20;
+
   void print(std::ostream& stream = std::cout) const;
 
  private:
   std::vector<TopologyNode> _nodes;
   size_t _num_cpus;
+  bool _has_numa_distances;
+  std::vector<CpuID> _reserved_cpus;
 };
 }  // namespace opossum
@@ -0,0 +1,74 @@
+#include "work_stealing_deque.hpp"
+
+#include <memory>
+
+#include "abstract_task.hpp"
+
+namespace opossum {
+
+WorkStealingDeque::~WorkStealingDeque() {
+  while (pop()) {
+  }
+}
+
+bool WorkStealingDeque::empty() const { return _bottom.load() <= _top.load(); }
+
+size_t WorkStealingDeque::size() const {
+  const auto size = _bottom.load() - _top.load();
+  return size > 0 ? static_cast<size_t>(size) : size_t{0};
+}
+
+bool WorkStealingDeque::push(const std::shared_ptr<AbstractTask>& task) {
+  const auto bottom = _bottom.load(std::memory_order_relaxed);
+  const auto top = _top.load(std::memory_order_acquire);
+
+  if (bottom - top >= CAPACITY) return false;
+
+  _slots[bottom & (CAPACITY - 1)].store(new std::shared_ptr<AbstractTask>(task), std::memory_order_relaxed);
+  _bottom.store(bottom + 1, std::memory_order_release);
+
+  return true;
+}
+
+std::shared_ptr<AbstractTask> WorkStealingDeque::pop() {
+  const auto bottom = _bottom.load(std::memory_order_relaxed) - 1;
+  _bottom.store(bottom, std::memory_order_seq_cst);
+  auto top = _top.load(std::memory_order_seq_cst);
+
+  if (top > bottom) {
+    // The deque was empty
+    _bottom.store(bottom + 1, std::memory_order_relaxed);
+    return nullptr;
+  }
+
+  auto* slot = _slots[bottom & (CAPACITY - 1)].load(std::memory_order_relaxed);
+
+  if (top == bottom) {
+    // This is the last task, race the thieves for it
+    const auto won = _top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst);
+    _bottom.store(bottom + 1, std::memory_order_relaxed);
+    if (!won) return nullptr;
+  }
+
+  auto task = std::move(*slot);
+  delete slot;
+  return task;
+}
+
+std::shared_ptr<AbstractTask> WorkStealingDeque::steal() {
+  auto top = _top.load(std::memory_order_seq_cst);
+  const auto bottom = _bottom.load(std::memory_order_seq_cst);
+
+  if (top >= bottom) return nullptr;
+
+  auto* slot = _slots[top & (CAPACITY - 1)].load(std::memory_order_acquire);
+
+  // If another thief or the owner took the task in the meantime, give up instead of retrying
+  if (!_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst)) return nullptr;
+
+  auto task = std::move(*slot);
+  delete slot;
+  return task;
+}
+
+}  // namespace opossum
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractTask;
+
+/**
+ * Chase-Lev work-stealing deque (see "Correct and Efficient Work-Stealing for Weak Memory Models", Lê et al., 2013)
+ * holding the ready JobTasks spawned on a ProcessingUnit.
+ *
+ * The owner, i.e., the active Worker of the ProcessingUnit, pushes and pops tasks at the bottom (LIFO), so that it
+ * executes the most recently spawned task first, whose data is most likely still in the cache. Other Workers steal
+ * tasks from the top (FIFO), which are the oldest and usually the largest pieces of remaining work.
+ *
+ * push() and pop() must only be called by one thread at a time, steal() can be called concurrently from any thread.
+ * The capacity is fixed. If the deque is full, push() fails and the caller has to put the task somewhere else.
+ */
+class WorkStealingDeque final : private Noncopyable {
+ public:
+  static constexpr int64_t CAPACITY = 4096;
+
+  ~WorkStealingDeque();
+
+  bool empty() const;
+
+  // Approximate if called concurrently with push(), pop() or steal()
+  size_t size() const;
+
+  // Owner only. Returns false if the deque is full.
+  bool push(const std::shared_ptr<AbstractTask>& task);
+
+  // Owner only. Returns the most recently pushed task, or nullptr if there is none.
+  std::shared_ptr<AbstractTask> pop();
+
+  // Returns the least recently pushed task, or nullptr if there is none or another thread won the race for it.
+  std::shared_ptr<AbstractTask> steal();
+
+ private:
+  static_assert((CAPACITY & (CAPACITY - 1)) == 0, "CAPACITY must be a power of two");
+
+  // Slots only hold raw pointers, which can be read and written atomically. The shared_ptr they point to is owned by
+  // the deque until exactly one thread wins the task in pop() or steal() and takes ownership of it.
+  std::array<std::atomic<std::shared_ptr<AbstractTask>*>, CAPACITY> _slots{};
+
+  std::atomic<int64_t> _top{0};
+  std::atomic<int64_t> _bottom{0};
+};
+
+}  // namespace opossum
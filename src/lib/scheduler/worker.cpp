@@ -4,6 +4,7 @@
 #include <sched.h>
 #include <unistd.h>
 
+#include <algorithm>
 #include <chrono>
 #include <iostream>
 #include <memory>
@@ -12,8 +13,10 @@
 
 #include "abstract_scheduler.hpp"
 #include "abstract_task.hpp"
+#include "admission_control.hpp"
 #include "current_scheduler.hpp"
 #include "task_queue.hpp"
+#include "task_tracer.hpp"
 
 namespace {
 
@@ -40,6 +43,8 @@ CpuID Worker::cpu_id() const { return _cpu_id; }
 
 std::weak_ptr<ProcessingUnit> Worker::processing_unit() const { return _processing_unit; }
 
+const WorkerStatistics& Worker::statistics() const { return _statistics; }
+
 void Worker::operator()() {
   DebugAssert((this_thread_worker.expired()), "Thread already has a worker");
 
@@ -47,9 +52,7 @@ void Worker::operator()() {
 
   _set_affinity();
 
-  auto scheduler = CurrentScheduler::get();
-
-  DebugAssert(static_cast<bool>(scheduler), "No scheduler");
+  DebugAssert(static_cast<bool>(CurrentScheduler::get()), "No scheduler");
 
   auto processing_unit = _processing_unit.lock();
 
@@ -65,41 +68,198 @@ void Worker::operator()() {
       }
     }
 
-    auto task = _queue->pull();
+    auto task = _pull_task(*processing_unit);
 
-    // TODO(all): this might shutdown the worker and leave non-ready tasks in the queue.
-    // Figure out how we want to deal with that later.
+    // Spin for a while and park afterwards iff there is no ready task in our queue and work stealing was not
+    // successful.
     if (!task) {
-      // Simple work stealing without explicitly transferring data between nodes.
-      auto work_stealing_successful = false;
-      for (auto& queue : scheduler->queues()) {
-        if (queue == _queue) {
-          continue;
-        }
-
-        task = queue->steal();
-        if (task) {
-          task->set_node_id(_queue->node_id());
-          work_stealing_successful = true;
-          break;
-        }
-      }
+      _wait_for_work();
+      continue;
+    }
 
-      // Sleep iff there is no ready task in our queue and work stealing was not successful.
-      if (!work_stealing_successful) {
-        std::this_thread::sleep_for(std::chrono::milliseconds(10));
-        continue;
+    // Spinning paid off if a task was found before parking. Spin longer next time.
+    if (_num_idle_spins > 0) {
+      _spin_budget = std::min(_spin_budget * 2, MAX_SPIN_BUDGET);
+      _num_idle_spins = 0;
+    }
+
+    _execute_task(*processing_unit, task);
+  }
+
+  processing_unit->yield_active_worker_token(_id);
+}
+
+std::shared_ptr<AbstractTask> Worker::_pull_task(ProcessingUnit& processing_unit) {
+  auto task = _pull_node_task(processing_unit);
+  if (task) {
+    _idle_since = {};
+    return task;
+  }
+
+  // Leave the tasks of remote nodes to their own Workers until this Worker has been idle for a while (see WORK
+  // STEALING in node_queue_scheduler.hpp)
+  const auto now = std::chrono::steady_clock::now();
+  if (_idle_since == std::chrono::steady_clock::time_point{}) _idle_since = now;
+
+  if (now - _idle_since >= processing_unit.steal_delay()) {
+    const auto& remote_queues = processing_unit.remote_queues();
+    for (const auto& remote_queue : remote_queues) {
+      task = remote_queue->steal(*_queue);
+      if (!task) task = remote_queue->steal_local();
+
+      if (task) {
+        increment_statistic(_statistics.num_stolen_remote_tasks);
+        task->set_node_id(_queue->node_id());
+        _idle_since = {};
+        return task;
       }
     }
 
-    task->execute();
+    if (!remote_queues.empty()) increment_statistic(_statistics.num_failed_steals);
+  }
+
+  return nullptr;
+}
+
+std::shared_ptr<AbstractTask> Worker::_pull_node_task(ProcessingUnit& processing_unit) {
+  // Tasks spawned on this ProcessingUnit come first, the most recent one is most likely to still be cached
+  auto task = processing_unit.pop_local_task();
+  if (task) {
+    increment_statistic(_statistics.num_local_tasks);
+    return task;
+  }
+
+  task = _queue->pull();
+  if (task) {
+    increment_statistic(_statistics.num_queue_tasks);
+    return task;
+  }
+
+  // Steal the oldest task of another ProcessingUnit of the same node
+  task = _queue->steal_local(processing_unit.deque().get());
+  if (task) {
+    increment_statistic(_statistics.num_stolen_node_tasks);
+    return task;
+  }
+
+  return nullptr;
+}
+
+void Worker::_execute_task(ProcessingUnit& processing_unit, const std::shared_ptr<AbstractTask>& task_ptr) {
+  auto& task = *task_ptr;
+
+  const auto& task_limit = task.task_limit();
+  if (task_limit && !task_limit->try_start_task(task_ptr)) return;
+
+  const auto outer_task_limit = std::move(_current_task_limit);
+  _current_task_limit = task_limit;
+
+  const auto begin_time = std::chrono::steady_clock::now();
+
+  task.execute();
+
+  const auto end_time = std::chrono::steady_clock::now();
+
+  _current_task_limit = outer_task_limit;
+  if (task_limit) _release_task_slot(*task_limit);
+
+  increment_statistic(_statistics.num_executed_tasks);
+  increment_statistic(_statistics.queue_wait_time_ns,
+                      std::chrono::duration_cast<std::chrono::nanoseconds>(begin_time - task.enqueue_time()).count());
+  if (_num_nested_waits == 0) {
+    increment_statistic(_statistics.busy_time_ns,
+                        std::chrono::duration_cast<std::chrono::nanoseconds>(end_time - begin_time).count());
+  }
+
+  auto& task_tracer = TaskTracer::get();
+  if (task_tracer.is_enabled()) {
+    task_tracer.record({task.id(), task.query_id(), _id, _queue->node_id(), task.description(), task.enqueue_time(),
+                        begin_time, end_time});
+  }
+
+  // This is part of the Scheduler shutdown system. Count the number of tasks a ProcessingUnit executed to allow the
+  // Scheduler to determine whether all tasks finished
+  processing_unit.on_worker_finished_task();
+}
+
+void Worker::_wait_for_task(AbstractTask& task) {
+  if (task.is_done()) return;
+
+  auto processing_unit = _processing_unit.lock();
+  DebugAssert(static_cast<bool>(processing_unit), "Bug: Locking the processing unit failed");
+
+  // The waiting task does not count towards the task limit of its query, otherwise the awaited tasks of the same query
+  // might never be started
+  const auto task_limit = _current_task_limit;
+  if (task_limit) _release_task_slot(*task_limit);
+
+  if (_num_nested_waits >= MAX_NESTED_WAITS) {
+    // Executing further tasks on this thread's stack might overflow it. Let another worker take over the CPU instead.
+    _hand_off_active_worker_token();
+    task._join_without_replacement_worker();
+    if (task_limit) task_limit->resume_task();
+    return;
+  }
+
+  ++_num_nested_waits;
+
+  while (!task.is_done()) {
+    // Another Worker became active on this ProcessingUnit while this one was blocked (e.g., waiting for admission). It
+    // keeps the CPU busy, so this one does not have to.
+    if (!processing_unit->try_acquire_active_worker_token(_id)) {
+      task._join_without_replacement_worker();
+      break;
+    }
+
+    auto other_task = _pull_task(*processing_unit);
+    if (other_task) {
+      _execute_task(*processing_unit, other_task);
+    } else {
+      // The awaited task is being executed by another Worker. Park until it is done, but look for other tasks from
+      // time to time, since this Worker keeps the ProcessingUnit's active worker token in the meantime.
+      task._wait_until_done(AWAITED_TASK_POLL_INTERVAL);
+    }
+  }
+
+  --_num_nested_waits;
+
+  if (task_limit) task_limit->resume_task();
+}
+
+void Worker::_release_task_slot(QueryTaskLimit& task_limit) {
+  for (auto& task : task_limit.finish_task()) {
+    _queue->push_enqueued(std::move(task), static_cast<uint32_t>(SchedulePriority::Normal));
+  }
+}
+
+bool Worker::_try_push_local_task(const std::shared_ptr<AbstractTask>& task) {
+  auto processing_unit = _processing_unit.lock();
+  DebugAssert(static_cast<bool>(processing_unit), "Bug: Locking the processing unit failed");
+
+  return processing_unit->try_push_local_task(task, _id);
+}
 
-    // This is part of the Scheduler shutdown system. Count the number of tasks a ProcessingUnit executed to allow the
-    // Scheduler to determine whether all tasks finished
-    processing_unit->on_worker_finished_task();
+void Worker::_wait_for_work() {
+  if (_num_idle_spins < _spin_budget) {
+    ++_num_idle_spins;
+    std::this_thread::yield();
+    return;
   }
 
+  // Spinning did not find a task. Spin shorter next time and park until a task is pushed into our queue.
+  _spin_budget = std::max(_spin_budget / 2, MIN_SPIN_BUDGET);
+  _num_idle_spins = 0;
+
+  increment_statistic(_statistics.num_parks);
+  _queue->wait_for_task(STEALING_INTERVAL);
+}
+
+void Worker::_hand_off_active_worker_token() {
+  auto processing_unit = _processing_unit.lock();
+  DebugAssert(static_cast<bool>(processing_unit), "Bug: Locking the processing unit failed");
+
   processing_unit->yield_active_worker_token(_id);
+  processing_unit->wake_or_create_worker();
 }
 
 void Worker::_set_affinity() {
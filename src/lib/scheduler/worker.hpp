@@ -1,14 +1,18 @@
 #pragma once
 
+#include <chrono>
 #include <memory>
 #include <vector>
 
 #include "processing_unit.hpp"
+#include "scheduler_statistics.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
 
+class AbstractTask;
+class QueryTaskLimit;
 class TaskQueue;
 
 /**
@@ -17,6 +21,7 @@ class TaskQueue;
  */
 class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable {
   friend class AbstractTask;
+  friend class AdmissionControl;
   friend class CurrentScheduler;
   friend class NodeQueueScheduler;
 
@@ -33,6 +38,8 @@ class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable
   std::weak_ptr<ProcessingUnit> processing_unit() const;
   CpuID cpu_id() const;
 
+  const WorkerStatistics& statistics() const;
+
   void operator()();
 
   void operator=(const Worker&) = delete;
@@ -42,17 +49,12 @@ class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable
   template <typename TaskType>
   void _wait_for_tasks(const std::vector<std::shared_ptr<TaskType>>& tasks) {
     /**
-     * This method blocks the calling thread (worker) until all tasks have been completed.
-     * It hands off the active worker token so that another worker can execute tasks while the calling worker is blocked.
+     * This method returns once all tasks have been completed. Instead of blocking, the calling worker executes other
+     * tasks in the meantime, most likely the ones that it waits for, as they were just pushed into the deque of its
+     * ProcessingUnit. Thus, waiting does not require additional threads, even for deeply nested jobs.
      */
-    auto processing_unit = _processing_unit.lock();
-    DebugAssert(static_cast<bool>(processing_unit), "Bug: Locking the processing unit failed");
-
-    processing_unit->yield_active_worker_token(_id);
-    processing_unit->wake_or_create_worker();
-
     for (auto& task : tasks) {
-      task->_join_without_replacement_worker();
+      _wait_for_task(*task);
     }
   }
 
@@ -63,10 +65,78 @@ class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable
    */
   void _set_affinity();
 
+  /**
+   * Returns the next task to be executed by this Worker, nullptr if there is none in any queue or the Worker has not
+   * been idle for long enough to steal from other nodes
+   */
+  std::shared_ptr<AbstractTask> _pull_task(ProcessingUnit& processing_unit);
+
+  /**
+   * Returns the next task of this Worker's node, nullptr if there is none
+   */
+  std::shared_ptr<AbstractTask> _pull_node_task(ProcessingUnit& processing_unit);
+
+  /**
+   * Executes the task, unless its query already executes as many tasks as it may (see QueryTaskLimit). The task is
+   * deferred then and pushed into a queue again once the query finishes one of its tasks.
+   */
+  void _execute_task(ProcessingUnit& processing_unit, const std::shared_ptr<AbstractTask>& task);
+
+  // Frees the slot of a task in the limit of its query and pushes the deferred tasks that may start now
+  void _release_task_slot(QueryTaskLimit& task_limit);
+
+  /**
+   * Executes other tasks until @param task is done, parks if there are none. Beyond MAX_NESTED_WAITS (i.e., if the
+   * tasks executed while waiting wait themselves), the worker blocks instead and another worker takes over the
+   * ProcessingUnit. The waiting task frees its slot in the task limit of its query in the meantime.
+   */
+  void _wait_for_task(AbstractTask& task);
+
+  /**
+   * Called before the worker blocks. Lets another worker of the ProcessingUnit execute tasks in the meantime.
+   */
+  void _hand_off_active_worker_token();
+
+  /**
+   * Pushes a ready task into the deque of the Worker's ProcessingUnit. Returns false if this Worker is not the active
+   * Worker of its ProcessingUnit, which is the only one allowed to push.
+   */
+  bool _try_push_local_task(const std::shared_ptr<AbstractTask>& task);
+
+  /**
+   * Called when neither our queue nor the other queues hold a ready task. Before parking the worker in its queue, it
+   * spins for a number of rounds (yielding the CPU in between). The number of rounds adapts to how often spinning
+   * actually found a task, so that workers do not burn CPU on idle systems but react quickly under load.
+   */
+  void _wait_for_work();
+
+  // Bounds of _spin_budget, i.e., the number of rounds a worker spins before parking
+  static constexpr size_t MIN_SPIN_BUDGET = 4;
+  static constexpr size_t MAX_SPIN_BUDGET = 1024;
+
+  // Limits the stack depth of tasks that are executed while waiting for other tasks
+  static constexpr size_t MAX_NESTED_WAITS = 16;
+
+  // Parked workers wake up after this interval to try to steal tasks from other queues
+  static constexpr std::chrono::microseconds STEALING_INTERVAL = std::chrono::milliseconds{10};
+
+  // Workers that wait for a task that another Worker executes wake up after this interval to look for other tasks
+  static constexpr std::chrono::microseconds AWAITED_TASK_POLL_INTERVAL = std::chrono::milliseconds{1};
+
   std::weak_ptr<ProcessingUnit> _processing_unit;
   std::shared_ptr<TaskQueue> _queue;
   WorkerID _id;
   CpuID _cpu_id;
+  size_t _spin_budget{MIN_SPIN_BUDGET};
+  size_t _num_idle_spins{0};
+  size_t _num_nested_waits{0};
+
+  // The limit of the query whose task is currently executed by this Worker, if any
+  std::shared_ptr<QueryTaskLimit> _current_task_limit;
+
+  // When _pull_task() last started to come back empty-handed, time_point{} while it finds tasks
+  std::chrono::steady_clock::time_point _idle_since{};
+  WorkerStatistics _statistics;
 };
 
 }  // namespace opossum
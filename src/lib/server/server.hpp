@@ -3,13 +3,18 @@
 #include <boost/asio/io_service.hpp>
 #include <boost/asio/ip/tcp.hpp>
 
+#include <chrono>
+#include <optional>
+
 #include "server_session.hpp"
 
 namespace opossum {
 
 class Server {
  public:
-  Server(boost::asio::io_service& io_service, uint16_t port);
+  // Statements running longer than @param statement_timeout are cancelled
+  Server(boost::asio::io_service& io_service, uint16_t port,
+         std::optional<std::chrono::microseconds> statement_timeout = std::nullopt);
 
   uint16_t get_port_number();
 
@@ -20,6 +25,7 @@ class Server {
   boost::asio::io_service& _io_service;
   boost::asio::ip::tcp::acceptor _acceptor;
   boost::asio::ip::tcp::socket _socket;
+  const std::optional<std::chrono::microseconds> _statement_timeout;
 };
 
 }  // namespace opossum
@@ -4,7 +4,9 @@
 #include <boost/asio/ip/tcp.hpp>
 #include <boost/thread/future.hpp>
 
+#include <chrono>
 #include <memory>
+#include <optional>
 
 #include "client_connection.hpp"
 #include "postgres_wire_handler.hpp"
@@ -17,8 +19,9 @@ namespace opossum {
 template <typename TConnection, typename TTaskRunner>
 class ServerSessionImpl : public std::enable_shared_from_this<ServerSessionImpl<TConnection, TTaskRunner>> {
  public:
-  explicit ServerSessionImpl(std::shared_ptr<TConnection> connection, std::shared_ptr<TTaskRunner> task_runner)
-      : _connection(connection), _task_runner(task_runner) {}
+  explicit ServerSessionImpl(std::shared_ptr<TConnection> connection, std::shared_ptr<TTaskRunner> task_runner,
+                             std::optional<std::chrono::microseconds> statement_timeout = std::nullopt)
+      : _connection(connection), _task_runner(task_runner), _statement_timeout(statement_timeout) {}
 
   boost::future<void> start();
 
@@ -39,6 +42,9 @@ class ServerSessionImpl : public std::enable_shared_from_this<ServerSessionImpl<
   std::shared_ptr<TConnection> _connection;
   std::shared_ptr<TTaskRunner> _task_runner;
 
+  // Statements running longer than this are cancelled
+  const std::optional<std::chrono::microseconds> _statement_timeout;
+
   std::shared_ptr<TransactionContext> _transaction;
   std::unordered_map<std::string, std::shared_ptr<SQLPipeline>> _prepared_statements;
   // TODO(lawben): The type of _portals will change when prepared statements are supported in the SQLPipeline
@@ -11,8 +11,12 @@ namespace opossum {
 
 SQLPipeline::SQLPipeline(const std::string& sql, std::shared_ptr<TransactionContext> transaction_context,
                          const UseMvcc use_mvcc, const std::shared_ptr<LQPTranslator>& lqp_translator,
-                         const std::shared_ptr<Optimizer>& optimizer, const PreparedStatementCache& prepared_statements)
-    : _transaction_context(transaction_context), _optimizer(optimizer) {
+                         const std::shared_ptr<Optimizer>& optimizer, const PreparedStatementCache& prepared_statements,
+                         const UsePipelining use_pipelining,
+                         const std::shared_ptr<CancellationToken>& cancellation_token)
+    : _transaction_context(transaction_context),
+      _optimizer(optimizer),
+      _cancellation_token(cancellation_token ? cancellation_token : std::make_shared<CancellationToken>()) {
   DebugAssert(!_transaction_context || _transaction_context->phase() == TransactionPhase::Active,
               "The transaction context cannot have been committed already.");
   DebugAssert(!_transaction_context || use_mvcc == UseMvcc::Yes,
@@ -73,9 +77,9 @@ SQLPipeline::SQLPipeline(const std::string& sql, std::shared_ptr<TransactionCont
     const auto statement_string = boost::trim_copy(sql.substr(sql_string_offset, statement_string_length));
     sql_string_offset += statement_string_length;
 
-    auto pipeline_statement =
-        std::make_shared<SQLPipelineStatement>(statement_string, std::move(parsed_statement), use_mvcc,
-                                               transaction_context, lqp_translator, optimizer, prepared_statements);
+    auto pipeline_statement = std::make_shared<SQLPipelineStatement>(
+        statement_string, std::move(parsed_statement), use_mvcc, transaction_context, lqp_translator, optimizer,
+        prepared_statements, use_pipelining, _cancellation_token);
     _sql_pipeline_statements.push_back(std::move(pipeline_statement));
   }
 
@@ -202,6 +206,8 @@ std::shared_ptr<const Table> SQLPipeline::get_result_table() {
   return _result_table;
 }
 
+void SQLPipeline::cancel() { _cancellation_token->cancel(); }
+
 std::shared_ptr<TransactionContext> SQLPipeline::transaction_context() const { return _transaction_context; }
 
 std::shared_ptr<SQLPipelineStatement> SQLPipeline::failed_pipeline_statement() const {
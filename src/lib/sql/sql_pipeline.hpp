@@ -45,7 +45,9 @@ class SQLPipeline : public Noncopyable {
   // Prefer using the SQLPipelineBuilder interface for constructing SQLPipelines conveniently
   SQLPipeline(const std::string& sql, std::shared_ptr<TransactionContext> transaction_context, const UseMvcc use_mvcc,
               const std::shared_ptr<LQPTranslator>& lqp_translator, const std::shared_ptr<Optimizer>& optimizer,
-              const PreparedStatementCache& prepared_statements);
+              const PreparedStatementCache& prepared_statements,
+              const UsePipelining use_pipelining = UsePipelining::No,
+              const std::shared_ptr<CancellationToken>& cancellation_token = nullptr);
 
   // Returns the SQL string for each statement.
   const std::vector<std::string>& get_sql_strings();
@@ -67,8 +69,12 @@ class SQLPipeline : public Noncopyable {
   const std::vector<std::vector<std::shared_ptr<OperatorTask>>>& get_tasks();
 
   // Executes all tasks, waits for them to finish, and returns the resulting table of the last statement.
+  // Throws if the pipeline was cancelled or timed out, see SQLPipelineStatement::get_result_table().
   std::shared_ptr<const Table> get_result_table();
 
+  // Stops the execution of all statements. May be called from any thread.
+  void cancel();
+
   // Returns the TransactionContext that was passed to the SQLPipelineStatement, or nullptr if none was passed in.
   std::shared_ptr<TransactionContext> transaction_context() const;
 
@@ -88,6 +94,7 @@ class SQLPipeline : public Noncopyable {
 
   const std::shared_ptr<TransactionContext> _transaction_context;
   const std::shared_ptr<Optimizer> _optimizer;
+  const std::shared_ptr<CancellationToken> _cancellation_token;
 
   // Execution results
   std::vector<std::string> _sql_strings;
@@ -1,5 +1,7 @@
 #include "sql_pipeline_builder.hpp"
 
+#include "utils/assert.hpp"
+
 namespace opossum {
 
 SQLPipelineBuilder::SQLPipelineBuilder(const std::string& sql) : _sql(sql) {}
@@ -33,21 +35,49 @@ SQLPipelineBuilder& SQLPipelineBuilder::with_transaction_context(
   return *this;
 }
 
+SQLPipelineBuilder& SQLPipelineBuilder::with_pipelining(const UsePipelining use_pipelining) {
+  _use_pipelining = use_pipelining;
+  return *this;
+}
+
+SQLPipelineBuilder& SQLPipelineBuilder::with_timeout(const std::chrono::microseconds timeout) {
+  _timeout = timeout;
+  return *this;
+}
+
+SQLPipelineBuilder& SQLPipelineBuilder::with_sort_memory_budget(const size_t memory_budget) {
+  _sort_memory_budget = memory_budget;
+  return *this;
+}
+
 SQLPipelineBuilder& SQLPipelineBuilder::disable_mvcc() { return with_mvcc(UseMvcc::No); }
 
 SQLPipeline SQLPipelineBuilder::create_pipeline() const {
-  auto lqp_translator = _lqp_translator ? _lqp_translator : std::make_shared<LQPTranslator>();
+  auto lqp_translator = _create_lqp_translator();
   auto optimizer = _optimizer ? _optimizer : Optimizer::create_default_optimizer();
 
-  return {_sql, _transaction_context, _use_mvcc, lqp_translator, optimizer, _prepared_statements};
+  return {_sql, _transaction_context, _use_mvcc, lqp_translator, optimizer, _prepared_statements, _use_pipelining,
+          _create_cancellation_token()};
 }
 
 SQLPipelineStatement SQLPipelineBuilder::create_pipeline_statement(
     std::shared_ptr<hsql::SQLParserResult> parsed_sql) const {
-  auto lqp_translator = _lqp_translator ? _lqp_translator : std::make_shared<LQPTranslator>();
+  auto lqp_translator = _create_lqp_translator();
   auto optimizer = _optimizer ? _optimizer : Optimizer::create_default_optimizer();
 
-  return {_sql, parsed_sql, _use_mvcc, _transaction_context, lqp_translator, optimizer, _prepared_statements};
+  return {_sql, parsed_sql, _use_mvcc, _transaction_context, lqp_translator, optimizer, _prepared_statements,
+          _use_pipelining, _create_cancellation_token()};
+}
+
+std::shared_ptr<CancellationToken> SQLPipelineBuilder::_create_cancellation_token() const {
+  return _timeout ? std::make_shared<CancellationToken>(*_timeout) : std::make_shared<CancellationToken>();
+}
+
+std::shared_ptr<LQPTranslator> SQLPipelineBuilder::_create_lqp_translator() const {
+  if (!_lqp_translator) return std::make_shared<LQPTranslator>(_sort_memory_budget);
+
+  Assert(!_sort_memory_budget, "The sort memory budget cannot be passed to a custom LQPTranslator");
+  return _lqp_translator;
 }
 
 }  // namespace opossum
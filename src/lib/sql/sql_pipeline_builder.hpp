@@ -1,6 +1,8 @@
 #pragma once
 
+#include <chrono>
 #include <memory>
+#include <optional>
 #include <string>
 
 #include "types.hpp"
@@ -28,6 +30,9 @@ class Optimizer;
  *  - MVCC is enabled
  *  - The default Optimizer (Optimizer::create_default_optimizer() is used.
  *  - No JIT operators
+ *  - No pipelining, i.e., every operator is executed by a task of its own
+ *  - No timeout
+ *  - No memory budget for sorts
  *
  * Favour this interface over calling the SQLPipeline[Statement] constructors with their long parameter list.
  * See SQLPipeline[Statement] doc for these classes, in short SQLPipeline ist for queries with multiple statement,
@@ -42,6 +47,18 @@ class SQLPipelineBuilder final {
   SQLPipelineBuilder& with_optimizer(const std::shared_ptr<Optimizer>& optimizer);
   SQLPipelineBuilder& with_prepared_statement_cache(const PreparedStatementCache& prepared_statements);
   SQLPipelineBuilder& with_transaction_context(const std::shared_ptr<TransactionContext>& transaction_context);
+  SQLPipelineBuilder& with_pipelining(const UsePipelining use_pipelining);
+
+  /**
+   * Cancels the execution once @param timeout passed, starting when the execution of the (first) statement starts
+   */
+  SQLPipelineBuilder& with_timeout(const std::chrono::microseconds timeout);
+
+  /**
+   * Sorts spill sorted runs to disk once their materialized sort column exceeds @param memory_budget bytes. Passed on
+   * to the default LQPTranslator, cannot be combined with with_lqp_translator().
+   */
+  SQLPipelineBuilder& with_sort_memory_budget(const size_t memory_budget);
 
   /**
    * Short for with_mvcc(UseMvcc::No)
@@ -57,9 +74,15 @@ class SQLPipelineBuilder final {
   SQLPipelineStatement create_pipeline_statement(std::shared_ptr<hsql::SQLParserResult> parsed_sql = nullptr) const;
 
  private:
+  std::shared_ptr<CancellationToken> _create_cancellation_token() const;
+  std::shared_ptr<LQPTranslator> _create_lqp_translator() const;
+
   const std::string _sql;
 
   UseMvcc _use_mvcc{UseMvcc::Yes};
+  UsePipelining _use_pipelining{UsePipelining::No};
+  std::optional<std::chrono::microseconds> _timeout;
+  std::optional<size_t> _sort_memory_budget;
   std::shared_ptr<TransactionContext> _transaction_context;
   std::shared_ptr<LQPTranslator> _lqp_translator;
   std::shared_ptr<Optimizer> _optimizer;
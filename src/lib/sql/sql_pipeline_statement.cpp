@@ -8,6 +8,7 @@
 #include "SQLParser.h"
 #include "concurrency/transaction_manager.hpp"
 #include "optimizer/optimizer.hpp"
+#include "scheduler/admission_control.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "sql/hsql_expr_translator.hpp"
 #include "sql/sql_pipeline_builder.hpp"
@@ -22,13 +23,17 @@ SQLPipelineStatement::SQLPipelineStatement(const std::string& sql, std::shared_p
                                            const std::shared_ptr<TransactionContext>& transaction_context,
                                            const std::shared_ptr<LQPTranslator>& lqp_translator,
                                            const std::shared_ptr<Optimizer>& optimizer,
-                                           const PreparedStatementCache& prepared_statements)
+                                           const PreparedStatementCache& prepared_statements,
+                                           const UsePipelining use_pipelining,
+                                           const std::shared_ptr<CancellationToken>& cancellation_token)
     : _sql_string(sql),
       _use_mvcc(use_mvcc),
+      _use_pipelining(use_pipelining),
       _auto_commit(_use_mvcc == UseMvcc::Yes && !transaction_context),
       _transaction_context(transaction_context),
       _lqp_translator(lqp_translator),
       _optimizer(optimizer),
+      _cancellation_token(cancellation_token ? cancellation_token : std::make_shared<CancellationToken>()),
       _parsed_sql_statement(std::move(parsed_sql)),
       _metrics(std::make_shared<SQLPipelineStatementMetrics>()),
       _prepared_statements(prepared_statements) {
@@ -124,9 +129,14 @@ const std::shared_ptr<SQLQueryPlan>& SQLPipelineStatement::get_query_plan() {
     return _query_plan;
   }
 
-  // If we need a transaction context but haven't passed one in, this is the latest point where we can create it
+  const auto* statement = get_parsed_sql_statement()->getStatement(0);
+
+  // If we need a transaction context but haven't passed one in, this is the latest point where we can create it.
+  // SELECTs only read, so they do not need a full transaction.
   if (!_transaction_context && _use_mvcc == UseMvcc::Yes) {
-    _transaction_context = TransactionManager::get().new_transaction_context();
+    _transaction_context = statement->isType(hsql::kStmtSelect)
+                               ? TransactionManager::get().new_read_only_transaction_context()
+                               : TransactionManager::get().new_transaction_context();
   }
 
   _query_plan = std::make_shared<SQLQueryPlan>();
@@ -135,8 +145,6 @@ const std::shared_ptr<SQLQueryPlan>& SQLPipelineStatement::get_query_plan() {
   auto started = std::chrono::high_resolution_clock::now();
   auto done = started;  // dummy value needed for initialization
 
-  const auto* statement = get_parsed_sql_statement()->getStatement(0);
-
   auto assert_same_mvcc_mode = [this](const SQLQueryPlan& plan) {
     if (plan.tree_roots().front()->transaction_context_is_set()) {
       Assert(_use_mvcc == UseMvcc::Yes, "Trying to use MVCC cached query without a transaction context.");
@@ -190,15 +198,26 @@ const std::shared_ptr<SQLQueryPlan>& SQLPipelineStatement::get_query_plan() {
   }
 
   if (_use_mvcc == UseMvcc::Yes) _query_plan->set_transaction_context(_transaction_context);
+  _query_plan->set_cancellation_token(_cancellation_token);
+
+  // The caches store copies of the plan. Otherwise, the operators that are executed (and hold the cancellation token
+  // and the outputs of this execution) would be reused by later executions.
+  const auto create_cached_plan = [&]() {
+    auto cached_plan = _query_plan->recreate();
+    cached_plan.set_num_parameters(_query_plan->num_parameters());
+    // Only used to check the MVCC mode when the plan is taken from the cache, see assert_same_mvcc_mode
+    if (_use_mvcc == UseMvcc::Yes) cached_plan.set_transaction_context(_transaction_context);
+    return cached_plan;
+  };
 
   if (const auto* prepared_statement = dynamic_cast<const hsql::PrepareStatement*>(statement)) {
     Assert(_prepared_statements, "Cannot prepare statement without prepared statement cache.");
-    _prepared_statements->set(prepared_statement->name, *_query_plan);
+    _prepared_statements->set(prepared_statement->name, create_cached_plan());
   }
 
   // Cache newly created plan for the according sql statement (only if not already cached)
   if (!_metrics->query_plan_cache_hit) {
-    SQLQueryCache<SQLQueryPlan>::get().set(_sql_string, *_query_plan);
+    SQLQueryCache<SQLQueryPlan>::get().set(_sql_string, create_cached_plan());
   }
 
   _metrics->compile_time_micros = std::chrono::duration_cast<std::chrono::microseconds>(done - started);
@@ -216,7 +235,7 @@ const std::vector<std::shared_ptr<OperatorTask>>& SQLPipelineStatement::get_task
               "Physical query plan creation returned no or more than one plan for a single statement.");
 
   const auto& root = query_plan->tree_roots().front();
-  _tasks = OperatorTask::make_tasks_from_operator(root);
+  _tasks = OperatorTask::make_tasks_from_operator(root, _use_pipelining);
   return _tasks;
 }
 
@@ -238,7 +257,26 @@ const std::shared_ptr<const Table>& SQLPipelineStatement::get_result_table() {
     return _result_table;
   }
 
-  CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+  // The timeout includes the time the query waits for admission
+  _cancellation_token->start();
+
+  {
+    // Blocks until AdmissionControl lets the query run. Its slot is released once all tasks finished.
+    const auto admission = AdmissionControl::get().admit(AdmissionControl::estimate_cost(tasks));
+    for (const auto& task : tasks) {
+      task->set_query(admission->query_id(), admission->priority(), admission->task_limit());
+    }
+
+    CurrentScheduler::schedule_and_wait_for_tasks(tasks, admission->priority());
+  }
+
+  if (_cancellation_token->is_cancelled()) {
+    // Some operators did not execute (completely), so neither the result nor the modifications are valid
+    if (_transaction_context) _transaction_context->rollback();
+
+    throw std::runtime_error(_cancellation_token->has_timed_out() ? "Statement timeout exceeded"
+                                                                  : "Statement was cancelled");
+  }
 
   if (_auto_commit) {
     _transaction_context->commit();
@@ -296,5 +334,11 @@ std::string SQLPipelineStatement::create_parse_error_message(const std::string&
   return error_msg.str();
 }
 
+void SQLPipelineStatement::cancel() { _cancellation_token->cancel(); }
+
+const std::shared_ptr<CancellationToken>& SQLPipelineStatement::cancellation_token() const {
+  return _cancellation_token;
+}
+
 const std::shared_ptr<SQLPipelineStatementMetrics>& SQLPipelineStatement::metrics() const { return _metrics; }
 }  // namespace opossum
@@ -6,6 +6,7 @@
 #include "concurrency/transaction_context.hpp"
 #include "logical_query_plan/lqp_translator.hpp"
 #include "optimizer/optimizer.hpp"
+#include "scheduler/cancellation_token.hpp"
 #include "sql/sql_query_cache.hpp"
 #include "sql/sql_query_plan.hpp"
 #include "storage/table.hpp"
@@ -45,7 +46,9 @@ class SQLPipelineStatement : public Noncopyable {
   SQLPipelineStatement(const std::string& sql, std::shared_ptr<hsql::SQLParserResult> parsed_sql,
                        const UseMvcc use_mvcc, const std::shared_ptr<TransactionContext>& transaction_context,
                        const std::shared_ptr<LQPTranslator>& lqp_translator,
-                       const std::shared_ptr<Optimizer>& optimizer, const PreparedStatementCache& prepared_statements);
+                       const std::shared_ptr<Optimizer>& optimizer, const PreparedStatementCache& prepared_statements,
+                       const UsePipelining use_pipelining = UsePipelining::No,
+                       const std::shared_ptr<CancellationToken>& cancellation_token = nullptr);
 
   // Returns the raw SQL string.
   const std::string& get_sql_string();
@@ -66,8 +69,15 @@ class SQLPipelineStatement : public Noncopyable {
   const std::vector<std::shared_ptr<OperatorTask>>& get_tasks();
 
   // Executes all tasks, waits for them to finish, and returns the resulting table.
+  // Throws if the statement was cancelled or timed out during execution. Its transaction is rolled back in that case.
   const std::shared_ptr<const Table>& get_result_table();
 
+  // Stops the execution of the statement. May be called from any thread.
+  void cancel();
+
+  // Shared with the other statements of the SQLPipeline the statement is part of, if any. Never nullptr.
+  const std::shared_ptr<CancellationToken>& cancellation_token() const;
+
   // Returns the TransactionContext that was either passed to or created by the SQLPipelineStatement.
   // This can be a nullptr if no transaction management is wanted.
   const std::shared_ptr<TransactionContext>& transaction_context() const;
@@ -80,6 +90,7 @@ class SQLPipelineStatement : public Noncopyable {
  private:
   const std::string _sql_string;
   const UseMvcc _use_mvcc;
+  const UsePipelining _use_pipelining;
 
   // Perform MVCC commit right after the Statement was executed
   const bool _auto_commit;
@@ -92,6 +103,8 @@ class SQLPipelineStatement : public Noncopyable {
 
   const std::shared_ptr<Optimizer> _optimizer;
 
+  const std::shared_ptr<CancellationToken> _cancellation_token;
+
   // Execution results
   std::shared_ptr<hsql::SQLParserResult> _parsed_sql_statement;
   std::shared_ptr<AbstractLQPNode> _unoptimized_logical_plan;
@@ -17,15 +17,7 @@ void SQLQueryPlan::append_plan(const SQLQueryPlan& other_plan) {
 }
 
 std::vector<std::shared_ptr<OperatorTask>> SQLQueryPlan::create_tasks() const {
-  std::vector<std::shared_ptr<OperatorTask>> tasks;
-
-  for (const auto& root : _roots) {
-    std::vector<std::shared_ptr<OperatorTask>> sub_list;
-    sub_list = OperatorTask::make_tasks_from_operator(root);
-    tasks.insert(tasks.end(), sub_list.begin(), sub_list.end());
-  }
-
-  return tasks;
+  return OperatorTask::make_tasks_from_operators(_roots);
 }
 
 const std::vector<std::shared_ptr<AbstractOperator>>& SQLQueryPlan::tree_roots() const { return _roots; }
@@ -48,6 +40,12 @@ void SQLQueryPlan::set_transaction_context(std::shared_ptr<TransactionContext> c
   }
 }
 
+void SQLQueryPlan::set_cancellation_token(const std::shared_ptr<const CancellationToken>& cancellation_token) {
+  for (const auto& root : _roots) {
+    root->set_cancellation_token_recursively(cancellation_token);
+  }
+}
+
 void SQLQueryPlan::set_num_parameters(uint16_t num_parameters) { _num_parameters = num_parameters; }
 
 uint16_t SQLQueryPlan::num_parameters() const { return _num_parameters; }
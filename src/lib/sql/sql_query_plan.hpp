@@ -26,7 +26,7 @@ class SQLQueryPlan {
   // Append all operator trees from the other plan.
   void append_plan(const SQLQueryPlan& other_plan);
 
-  // Wrap all operator trees in tasks and return them.
+  // Wrap all operator trees in tasks and return them. Operators shared between the trees are only executed once.
   std::vector<std::shared_ptr<OperatorTask>> create_tasks() const;
 
   // Returns the root nodes of all operator trees in the plan.
@@ -39,6 +39,9 @@ class SQLQueryPlan {
   // Calls set_transaction_context_recursively on all roots.
   void set_transaction_context(std::shared_ptr<TransactionContext> context);
 
+  // Calls set_cancellation_token_recursively on all roots.
+  void set_cancellation_token(const std::shared_ptr<const CancellationToken>& cancellation_token);
+
   // Set the number of parameters that this query plan contains.
   void set_num_parameters(uint16_t num_parameters);
 
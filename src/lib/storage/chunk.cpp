@@ -3,6 +3,7 @@
 #include <limits>
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -17,6 +18,7 @@
 #include "scheduler/job_task.hpp"
 #include "statistics/chunk_statistics/chunk_statistics.hpp"
 #include "utils/assert.hpp"
+#include "utils/numa_memory_resource.hpp"
 
 namespace opossum {
 
@@ -98,6 +100,13 @@ SharedScopedLockingPtr<const MvccColumns> Chunk::mvcc_columns() const {
   return {*_mvcc_columns, _mvcc_columns->_mutex};
 }
 
+void Chunk::shrink_mvcc_columns() {
+  DebugAssert((has_mvcc_columns()), "Chunk does not have mvcc columns");
+
+  std::unique_lock<std::shared_mutex> lock{_mvcc_columns->_mutex};
+  _mvcc_columns->shrink();
+}
+
 std::vector<std::shared_ptr<BaseIndex>> Chunk::get_indices(
     const std::vector<std::shared_ptr<const BaseColumn>>& columns) const {
   auto result = std::vector<std::shared_ptr<BaseIndex>>();
@@ -168,6 +177,24 @@ void Chunk::migrate(boost::container::pmr::memory_resource* memory_source) {
 
 const PolymorphicAllocator<Chunk>& Chunk::get_allocator() const { return _alloc; }
 
+NodeID Chunk::numa_node_id() const {
+  if (!_columns.empty()) {
+    if (const auto reference_column = std::dynamic_pointer_cast<const ReferenceColumn>(_columns.front())) {
+      const auto& pos_list = *reference_column->pos_list();
+      if (pos_list.empty() || pos_list.front().is_null()) return INVALID_NODE_ID;
+
+      return reference_column->referenced_table()->get_chunk(pos_list.front().chunk_id)->numa_node_id();
+    }
+  }
+
+  const auto memory_resource = dynamic_cast<const NUMAMemoryResource*>(_alloc.resource());
+  if (!memory_resource || memory_resource->get_node_id() == NUMAMemoryResource::UNDEFINED_NODE_ID) {
+    return INVALID_NODE_ID;
+  }
+
+  return NodeID{static_cast<NodeID::base_type>(memory_resource->get_node_id())};
+}
+
 size_t Chunk::estimate_memory_usage() const {
   auto bytes = size_t{sizeof(*this)};
 
@@ -226,6 +253,10 @@ void Chunk::delete_quotient_filter(ColumnID column_id) {
   _quotient_filters[column_id] = nullptr;
 }
 
+void Chunk::set_quotient_filter(ColumnID column_id, std::shared_ptr<BaseFilter> filter) {
+  _quotient_filters[column_id] = std::move(filter);
+}
+
 std::shared_ptr<const BaseFilter> Chunk::get_filter(ColumnID column_id) const {
   auto result = _quotient_filters.find(column_id);
   if (result == _quotient_filters.end()) {
@@ -43,6 +43,9 @@ using ChunkColumns = pmr_vector<std::shared_ptr<BaseColumn>>;
  * Find more information about this in our wiki: https://github.com/hyrise/hyrise/wiki/chunk-concept
  */
 class Chunk : private Noncopyable {
+  // Creates main chunks that share the MvccColumns of a delta chunk
+  friend class DeltaMerger;
+
  public:
   static const ChunkOffset MAX_SIZE;
 
@@ -96,6 +99,12 @@ class Chunk : private Noncopyable {
   SharedScopedLockingPtr<MvccColumns> mvcc_columns();
   SharedScopedLockingPtr<const MvccColumns> mvcc_columns() const;
 
+  /**
+   * Moves the mvcc columns into contiguous memory (see MvccColumns::shrink()) while they are locked exclusively.
+   * Called once the chunk has been encoded and cannot grow anymore.
+   */
+  void shrink_mvcc_columns();
+
   std::vector<std::shared_ptr<BaseIndex>> get_indices(
       const std::vector<std::shared_ptr<const BaseColumn>>& columns) const;
   std::vector<std::shared_ptr<BaseIndex>> get_indices(const std::vector<ColumnID> column_ids) const;
@@ -136,6 +145,14 @@ class Chunk : private Noncopyable {
 
   const PolymorphicAllocator<Chunk>& get_allocator() const;
 
+  /**
+   * The NUMA node whose memory the chunk was allocated from (see NUMAMemoryResource). For chunks of ReferenceColumns,
+   * this is the node of the chunk that their first row points to. INVALID_NODE_ID if the location is unknown, e.g.,
+   * without NUMA support.
+   * Used to schedule jobs working on this chunk on the same node (see AbstractTask::schedule()).
+   */
+  NodeID numa_node_id() const;
+
   std::shared_ptr<ChunkStatistics> statistics() const;
 
   void set_statistics(std::shared_ptr<ChunkStatistics> statistics);
@@ -153,6 +170,9 @@ class Chunk : private Noncopyable {
 
   void delete_quotient_filter(ColumnID column_id);
 
+  // Sets a filter that has been built elsewhere, e.g., read from a table snapshot
+  void set_quotient_filter(ColumnID column_id, std::shared_ptr<BaseFilter> filter);
+
   /**
   * Retrieves the filter for a specific column.
   */
@@ -0,0 +1,145 @@
+#include "delta_merger.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "storage/base_value_column.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+#include "utils/pausable_loop_thread.hpp"
+
+namespace opossum {
+
+DeltaMerger& DeltaMerger::get() {
+  static DeltaMerger instance;
+  return instance;
+}
+
+void DeltaMerger::reset() {
+  auto& delta_merger = get();
+  delta_merger.stop();
+
+  std::lock_guard<std::mutex> lock(delta_merger._merge_specs_mutex);
+  delta_merger._merge_specs.clear();
+}
+
+DeltaMerger::~DeltaMerger() { stop(); }
+
+void DeltaMerger::start(const DeltaMergerOptions& options) {
+  Assert(!is_running(), "DeltaMerger is already running");
+  Assert(options.max_chunks_per_pass > 0, "max_chunks_per_pass must be positive");
+
+  _options = options;
+  _loop_thread = std::make_unique<PausableLoopThread>(_options.interval, [this](size_t) { merge(); });
+}
+
+void DeltaMerger::stop() {
+  // The destructor waits for the current pass
+  _loop_thread.reset();
+  _options = DeltaMergerOptions{};
+}
+
+bool DeltaMerger::is_running() const { return _loop_thread != nullptr; }
+
+void DeltaMerger::set_merge_spec(const std::string& table_name, const DeltaMergeSpec& merge_spec) {
+  // Unencoded main chunks would still be mutable and would be merged again in every pass
+  Assert(merge_spec.column_encoding_spec.encoding_type != EncodingType::Unencoded,
+         "Main chunks have to be encoded");
+  Assert(merge_spec.art_index_column_ids.empty() ||
+             merge_spec.column_encoding_spec.encoding_type == EncodingType::Dictionary,
+         "AdaptiveRadixTreeIndex requires dictionary encoding");
+
+  std::lock_guard<std::mutex> lock(_merge_specs_mutex);
+  _merge_specs[table_name] = merge_spec;
+}
+
+size_t DeltaMerger::merge() {
+  std::lock_guard<std::mutex> lock(_merge_mutex);
+
+  const auto max_chunks_per_pass = _options.max_chunks_per_pass;
+
+  auto num_merged_chunks = size_t{0};
+  for (const auto& table_name : StorageManager::get().table_names()) {
+    if (num_merged_chunks == max_chunks_per_pass) break;
+    num_merged_chunks += _merge_table(table_name, max_chunks_per_pass - num_merged_chunks);
+  }
+  return num_merged_chunks;
+}
+
+size_t DeltaMerger::_merge_table(const std::string& table_name, const size_t max_chunk_count) {
+  const auto table = StorageManager::get().get_table(table_name);
+  if (table->has_mvcc() == UseMvcc::No) return 0;
+
+  auto merge_spec = DeltaMergeSpec{};
+  {
+    std::lock_guard<std::mutex> lock(_merge_specs_mutex);
+    const auto merge_spec_it = _merge_specs.find(table_name);
+    if (merge_spec_it != _merge_specs.end()) merge_spec = merge_spec_it->second;
+  }
+
+  auto num_merged_chunks = size_t{0};
+
+  // The last chunk might still receive inserts
+  const auto chunk_count = table->chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id + 1u < chunk_count && num_merged_chunks < max_chunk_count; ++chunk_id) {
+    const auto delta_chunk = table->get_chunk(chunk_id);
+
+    // The columns are loaded once, so that they cannot be encoded concurrently (e.g., by a ChunkCompressionTask)
+    // between the check and the creation of the main chunk
+    auto delta_columns = ChunkColumns{};
+    for (auto column_id = ColumnID{0}; column_id < delta_chunk->column_count(); ++column_id) {
+      delta_columns.push_back(delta_chunk->get_mutable_column(column_id));
+    }
+    const auto is_delta_chunk = std::all_of(delta_columns.cbegin(), delta_columns.cend(), [](const auto& column) {
+      return std::dynamic_pointer_cast<const BaseValueColumn>(column) != nullptr;
+    });
+    if (!is_delta_chunk) continue;
+
+    // The size has to be determined before the uncommitted rows are checked, see MvccColumns::is_fully_visible()
+    if (delta_chunk->size() != table->max_chunk_size()) continue;
+    if (delta_chunk->mvcc_columns()->has_uncommitted_rows()) continue;
+
+    const auto main_chunk = _create_main_chunk(*table, *delta_chunk, delta_columns, merge_spec);
+
+    // If the chunk has been replaced concurrently, e.g., by the GarbageCollector, the main chunk is dropped
+    if (table->replace_chunk_if_unchanged(chunk_id, delta_chunk, main_chunk)) ++num_merged_chunks;
+  }
+
+  return num_merged_chunks;
+}
+
+std::shared_ptr<Chunk> DeltaMerger::_create_main_chunk(const Table& table, const Chunk& delta_chunk,
+                                                       const ChunkColumns& delta_columns,
+                                                       const DeltaMergeSpec& merge_spec) {
+  // The columns are replaced in the main chunk only, the delta chunk stays untouched
+  const auto main_chunk = std::make_shared<Chunk>(delta_columns, delta_chunk._mvcc_columns,
+                                                  delta_chunk.get_allocator(), delta_chunk.access_counter());
+  ChunkEncoder::encode_chunk(main_chunk, table.column_data_types(), merge_spec.column_encoding_spec);
+
+  for (const auto column_id : merge_spec.art_index_column_ids) {
+    main_chunk->populate_art_index(column_id);
+  }
+
+  for (auto column_id = ColumnID{0}; column_id < table.column_count(); ++column_id) {
+    if (const auto filter = delta_chunk.get_filter(column_id)) {
+      main_chunk
+          ->populate_quotient_filter(column_id, table.column_data_type(column_id), filter->quotient_bits(),
+                                     filter->remainder_bits())
+          ->execute();
+    }
+  }
+
+  for (const auto& filter_spec : merge_spec.quotient_filter_specs) {
+    main_chunk
+        ->populate_quotient_filter(filter_spec.column_id, table.column_data_type(filter_spec.column_id),
+                                   filter_spec.quotient_bits, filter_spec.remainder_bits)
+        ->execute();
+  }
+
+  return main_chunk;
+}
+
+}  // namespace opossum
@@ -0,0 +1,111 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "storage/chunk.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+struct PausableLoopThread;
+
+struct DeltaMergerOptions {
+  // How long the background thread sleeps between two passes
+  std::chrono::milliseconds interval{1'000};
+
+  // Upper bound for the number of chunks merged per pass, so that a pass does not delay stop() for too long
+  size_t max_chunks_per_pass{16};
+};
+
+struct QuotientFilterSpec {
+  ColumnID column_id;
+  uint8_t quotient_bits;
+  uint8_t remainder_bits;
+};
+
+/**
+ * Describes the main chunks that the DeltaMerger builds for a table. Quotient filters that a delta chunk has already
+ * are built for its main chunk as well.
+ */
+struct DeltaMergeSpec {
+  ColumnEncodingSpec column_encoding_spec{};
+
+  // An AdaptiveRadixTreeIndex is built for each of these columns, which requires dictionary encoding
+  std::vector<ColumnID> art_index_column_ids;
+  std::vector<QuotientFilterSpec> quotient_filter_specs;
+};
+
+/**
+ * Insert appends rows to mutable chunks of ValueColumns, which are cheap to write but slow to scan. Together, these
+ * chunks form the write-optimized delta of a table. The DeltaMerger periodically turns completed delta chunks into
+ * read-optimized main chunks:
+ *
+ *  1. A delta chunk is completed once it is full, it is not the last chunk of the table, and none of its rows are
+ *     uncommitted. Insert does not write into such a chunk anymore.
+ *  2. A new chunk is created from the columns and the MvccColumns of the delta chunk. It is encoded as described by
+ *     the DeltaMergeSpec of the table (dictionary encoding by default), which also builds its statistics and moves
+ *     its MvccColumns into contiguous memory (see ChunkEncoder::encode_chunk()). Afterwards, its indexes and quotient
+ *     filters are built.
+ *  3. The new chunk replaces the delta chunk (see Table::replace_chunk_if_unchanged()).
+ *
+ * The columns of the delta chunk are not modified, so operators that hold a pointer to the delta chunk continue to
+ * use it, and RowIDs stay valid because the order of the rows does not change. Both chunks share their MvccColumns,
+ * so deletes are visible in both of them. Making the MvccColumns contiguous takes their exclusive lock, which briefly
+ * blocks readers of the MVCC data of the delta chunk, e.g., Validate, Delete, and Update.
+ *
+ * Only tables with MVCC are merged.
+ */
+class DeltaMerger : private Noncopyable {
+ public:
+  static DeltaMerger& get();
+
+  // Stops the background thread and removes all merge specs, used for tests
+  static void reset();
+
+  ~DeltaMerger();
+
+  // Starts running merge() in the background
+  void start(const DeltaMergerOptions& options = {});
+
+  // Waits for the current pass to finish and stops the background thread
+  void stop();
+
+  bool is_running() const;
+
+  // Tables without a merge spec use the default DeltaMergeSpec
+  void set_merge_spec(const std::string& table_name, const DeltaMergeSpec& merge_spec);
+
+  /**
+   * Runs a single pass over all tables of the StorageManager.
+   *
+   * @return the number of chunks that have been merged
+   */
+  size_t merge();
+
+ private:
+  DeltaMerger() = default;
+
+  size_t _merge_table(const std::string& table_name, size_t max_chunk_count);
+
+  static std::shared_ptr<Chunk> _create_main_chunk(const Table& table, const Chunk& delta_chunk,
+                                                   const ChunkColumns& delta_columns, const DeltaMergeSpec& spec);
+
+  DeltaMergerOptions _options;
+  std::unique_ptr<PausableLoopThread> _loop_thread;
+
+  std::mutex _merge_specs_mutex;
+  std::map<std::string, DeltaMergeSpec> _merge_specs;
+
+  // Passes of the background thread and direct calls to merge() do not run concurrently
+  std::mutex _merge_mutex;
+};
+
+}  // namespace opossum
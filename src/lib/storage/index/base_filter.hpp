@@ -18,6 +18,10 @@ class BaseFilter : private Noncopyable {
   virtual uint64_t memory_consumption() const = 0;
   virtual double load_factor() const = 0;
   virtual bool is_full() const = 0;
+
+  // The parameters the filter was created with, used to recreate it (e.g., from a snapshot)
+  virtual uint8_t quotient_bits() const = 0;
+  virtual uint8_t remainder_bits() const = 0;
 };
 
 } // namespace opossum
@@ -7,8 +7,40 @@
 #include "storage/create_iterable_from_column.hpp"
 
 #include <cmath>
+#include <cstring>
 #include <iostream>
+#include <memory>
 #include <string>
+#include <vector>
+
+namespace {
+
+/**
+ * The blocks of a quotient filter are a single array of equally sized blocks (see qf_init()), their size is what
+ * memory_consumption() of the respective gqf namespace returns. The pointer to the blocks is stored as well, but
+ * ignored when the filter is restored.
+ */
+template <typename QuotientFilter>
+void append_quotient_filter(std::vector<char>& data, const QuotientFilter& filter, const uint64_t blocks_size) {
+  const auto* const filter_data = reinterpret_cast<const char*>(&filter);
+  data.insert(data.end(), filter_data, filter_data + sizeof(QuotientFilter));
+
+  const auto* const blocks = reinterpret_cast<const char*>(filter.blocks);
+  data.insert(data.end(), blocks, blocks + blocks_size);
+}
+
+// The blocks of the filter have already been allocated by qf_init() with the same parameters
+template <typename QuotientFilter>
+void restore_quotient_filter(QuotientFilter& filter, const uint64_t blocks_size, const char* data, const size_t size) {
+  Assert(size == sizeof(QuotientFilter) + blocks_size, "Serialized filter does not match its parameters");
+
+  auto* const blocks = filter.blocks;
+  std::memcpy(&filter, data, sizeof(QuotientFilter));
+  filter.blocks = blocks;
+  std::memcpy(blocks, data + sizeof(QuotientFilter), blocks_size);
+}
+
+}  // namespace
 
 namespace opossum {
 
@@ -178,6 +210,66 @@ bool CountingQuotientFilter<ElementType>::is_full() const {
   return load_factor() > 0.99;
 }
 
+template <typename ElementType>
+uint8_t CountingQuotientFilter<ElementType>::quotient_bits() const {
+  return static_cast<uint8_t>(_quotient_bits);
+}
+
+template <typename ElementType>
+uint8_t CountingQuotientFilter<ElementType>::remainder_bits() const {
+  return static_cast<uint8_t>(_remainder_bits);
+}
+
+template <typename ElementType>
+std::vector<char> CountingQuotientFilter<ElementType>::serialize() const {
+  auto data = std::vector<char>(sizeof(_seed));
+  std::memcpy(data.data(), &_seed, sizeof(_seed));
+
+  if (_remainder_bits == 2) {
+    append_quotient_filter(data, *_quotient_filter2, gqf2::memory_consumption(*_quotient_filter2));
+  } else if (_remainder_bits == 4) {
+    append_quotient_filter(data, *_quotient_filter4, gqf4::memory_consumption(*_quotient_filter4));
+  } else if (_remainder_bits == 8) {
+    append_quotient_filter(data, *_quotient_filter8, gqf8::memory_consumption(*_quotient_filter8));
+  } else if (_remainder_bits == 16) {
+    append_quotient_filter(data, *_quotient_filter16, gqf16::memory_consumption(*_quotient_filter16));
+  } else {
+    append_quotient_filter(data, *_quotient_filter32, gqf32::memory_consumption(*_quotient_filter32));
+  }
+
+  return data;
+}
+
+template <typename ElementType>
+std::shared_ptr<CountingQuotientFilter<ElementType>> CountingQuotientFilter<ElementType>::deserialize(
+    uint8_t quotient_bits, uint8_t remainder_bits, const char* data, size_t size) {
+  auto filter = std::make_shared<CountingQuotientFilter<ElementType>>(quotient_bits, remainder_bits);
+
+  Assert(size >= sizeof(filter->_seed), "Serialized filter is truncated");
+  std::memcpy(&filter->_seed, data, sizeof(filter->_seed));
+  data += sizeof(filter->_seed);
+  size -= sizeof(filter->_seed);
+
+  if (remainder_bits == 2) {
+    auto& quotient_filter = *filter->_quotient_filter2;
+    restore_quotient_filter(quotient_filter, gqf2::memory_consumption(quotient_filter), data, size);
+  } else if (remainder_bits == 4) {
+    auto& quotient_filter = *filter->_quotient_filter4;
+    restore_quotient_filter(quotient_filter, gqf4::memory_consumption(quotient_filter), data, size);
+  } else if (remainder_bits == 8) {
+    auto& quotient_filter = *filter->_quotient_filter8;
+    restore_quotient_filter(quotient_filter, gqf8::memory_consumption(quotient_filter), data, size);
+  } else if (remainder_bits == 16) {
+    auto& quotient_filter = *filter->_quotient_filter16;
+    restore_quotient_filter(quotient_filter, gqf16::memory_consumption(quotient_filter), data, size);
+  } else {
+    auto& quotient_filter = *filter->_quotient_filter32;
+    restore_quotient_filter(quotient_filter, gqf32::memory_consumption(quotient_filter), data, size);
+  }
+
+  return filter;
+}
+
 EXPLICITLY_INSTANTIATE_DATA_TYPES(CountingQuotientFilter);
 
 } // namespace opossum
@@ -9,6 +9,7 @@
 #include "storage/index/base_filter.hpp"
 
 #include <cstdint>
+#include <memory>
 #include <vector>
 #include <string>
 #include <cstdlib>
@@ -35,6 +36,17 @@ class CountingQuotientFilter : public BaseFilter {
   uint64_t memory_consumption() const final;
   double load_factor() const final;
   bool is_full() const final;
+  uint8_t quotient_bits() const final;
+  uint8_t remainder_bits() const final;
+
+  /**
+   * The state of the filter (hash seed, counters, and slots), used to store it in a table snapshot. deserialize()
+   * restores the filter from it without inserting the values again.
+   */
+  std::vector<char> serialize() const;
+  static std::shared_ptr<CountingQuotientFilter<ElementType>> deserialize(uint8_t quotient_bits,
+                                                                          uint8_t remainder_bits, const char* data,
+                                                                          size_t size);
 
  private:
   std::optional<gqf2::quotient_filter> _quotient_filter2;
@@ -47,7 +59,7 @@ class CountingQuotientFilter : public BaseFilter {
   uint64_t _number_of_slots;
   uint64_t _hash_bits;
   uint64_t _hash(ElementType value) const;
-  const uint32_t _seed = std::rand();
+  uint32_t _seed = std::rand();
 
 };
 
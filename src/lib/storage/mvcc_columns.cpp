@@ -1,5 +1,6 @@
 #include "mvcc_columns.hpp"
 
+#include <algorithm>
 #include <shared_mutex>
 
 #include "utils/assert.hpp"
@@ -11,16 +12,113 @@ MvccColumns::MvccColumns(const size_t size) { grow_by(size, 0); }
 size_t MvccColumns::size() const { return _size; }
 
 void MvccColumns::shrink() {
-  tids.shrink_to_fit();
-  begin_cids.shrink_to_fit();
-  end_cids.shrink_to_fit();
+  tids.make_contiguous();
+  begin_cids.make_contiguous();
+  end_cids.make_contiguous();
 }
 
+bool MvccColumns::is_contiguous() const { return begin_cids.is_contiguous(); }
+
 void MvccColumns::grow_by(size_t delta, CommitID begin_cid) {
-  _size += delta;
-  tids.grow_to_at_least(_size);
-  begin_cids.grow_to_at_least(_size, begin_cid);
-  end_cids.grow_to_at_least(_size, MAX_COMMIT_ID);
+  // The rows are counted before they become part of the chunk, see is_fully_visible()
+  if (begin_cid == MAX_COMMIT_ID) {
+    add_uncommitted_rows(delta);
+  } else if (delta > 0) {
+    update_max_begin_cid(begin_cid);
+  }
+
+  _grow_to_at_least(_reserved_size += delta, begin_cid);
+}
+
+std::pair<ChunkOffset, ChunkOffset> MvccColumns::reserve_rows(ChunkOffset row_count, ChunkOffset max_size) {
+  if (is_contiguous()) return {ChunkOffset{0}, ChunkOffset{0}};
+
+  // The rows are counted before they are reserved. Otherwise, a concurrent Insert that reserves rows behind them
+  // could grow the vectors before they are counted. Surplus rows are removed afterwards.
+  add_uncommitted_rows(row_count);
+
+  auto first_row = _reserved_size.load();
+  auto reserved_row_count = ChunkOffset{0};
+  do {
+    if (first_row >= max_size) {
+      reserved_row_count = 0;
+      break;
+    }
+    reserved_row_count = static_cast<ChunkOffset>(std::min<size_t>(row_count, max_size - first_row));
+  } while (!_reserved_size.compare_exchange_weak(first_row, first_row + reserved_row_count));
+
+  remove_uncommitted_rows(row_count - reserved_row_count);
+  if (reserved_row_count > 0) _grow_to_at_least(first_row + reserved_row_count, MAX_COMMIT_ID);
+
+  return {static_cast<ChunkOffset>(first_row), reserved_row_count};
+}
+
+void MvccColumns::_grow_to_at_least(size_t size, CommitID begin_cid) {
+  // Concurrent calls pass the same begin_cid, so it does not matter which of them creates a row
+  tids.grow_to_at_least(size);
+  begin_cids.grow_to_at_least(size, begin_cid);
+  end_cids.grow_to_at_least(size, MAX_COMMIT_ID);
+
+  auto expected = _size.load();
+  while (expected < size && !_size.compare_exchange_weak(expected, size)) {
+  }
+}
+
+bool MvccColumns::is_fully_visible(CommitID snapshot_commit_id) const {
+  // Operators commit their rows before removing them from the uncommitted rows, so once there are no uncommitted rows,
+  // the commit ids are up to date. Callers have to determine the size of the chunk before calling this.
+  if (_uncommitted_row_count.load() != 0) return false;
+  return _max_begin_cid.load() <= snapshot_commit_id && snapshot_commit_id < _min_end_cid.load();
+}
+
+CommitID MvccColumns::max_begin_cid() const { return _max_begin_cid.load(); }
+
+CommitID MvccColumns::min_end_cid() const { return _min_end_cid.load(); }
+
+bool MvccColumns::has_deletes() const { return _min_end_cid.load() != MAX_COMMIT_ID; }
+
+bool MvccColumns::has_uncommitted_rows() const { return _uncommitted_row_count.load() != 0; }
+
+void MvccColumns::update_max_begin_cid(CommitID begin_cid) {
+  auto expected = _max_begin_cid.load();
+  while (expected < begin_cid && !_max_begin_cid.compare_exchange_weak(expected, begin_cid)) {
+  }
+}
+
+void MvccColumns::update_min_end_cid(CommitID end_cid) {
+  auto expected = _min_end_cid.load();
+  while (expected > end_cid && !_min_end_cid.compare_exchange_weak(expected, end_cid)) {
+  }
+}
+
+void MvccColumns::add_uncommitted_rows(size_t count) { _uncommitted_row_count += count; }
+
+void MvccColumns::remove_uncommitted_rows(size_t count) {
+  DebugAssert(_uncommitted_row_count.load() >= count, "More rows committed than have been registered");
+  _uncommitted_row_count -= count;
+}
+
+void MvccColumns::update_summary() {
+  auto max_begin_cid = CommitID{0};
+  auto min_end_cid = MAX_COMMIT_ID;
+  auto uncommitted_row_count = size_t{0};
+
+  const auto size = _size.load();
+  for (auto chunk_offset = size_t{0}; chunk_offset < size; ++chunk_offset) {
+    const auto begin_cid = begin_cids[chunk_offset];
+    const auto end_cid = end_cids[chunk_offset];
+
+    // Rows that are neither committed nor invalidated, or that are locked by a transaction that has not deleted them
+    if (end_cid == MAX_COMMIT_ID && (begin_cid == MAX_COMMIT_ID || tids[chunk_offset].load() != 0u)) {
+      ++uncommitted_row_count;
+    }
+    if (begin_cid != MAX_COMMIT_ID) max_begin_cid = std::max(max_begin_cid, begin_cid);
+    min_end_cid = std::min(min_end_cid, end_cid);
+  }
+
+  _max_begin_cid = max_begin_cid;
+  _min_end_cid = min_end_cid;
+  _uncommitted_row_count = uncommitted_row_count;
 }
 
 void MvccColumns::print(std::ostream& stream) const {
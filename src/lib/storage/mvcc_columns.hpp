@@ -2,7 +2,9 @@
 
 #include <atomic>
 #include <shared_mutex>  // NOLINT lint thinks this is a C header or something
+#include <utility>
 
+#include "mvcc_vector.hpp"
 #include "types.hpp"
 #include "utils/copyable_atomic.hpp"
 
@@ -19,21 +21,24 @@ struct MvccColumns {
   // The last commit id is reserved for uncommitted changes
   static constexpr CommitID MAX_COMMIT_ID = std::numeric_limits<CommitID>::max() - 1;
 
-  pmr_concurrent_vector<copyable_atomic<TransactionID>> tids;  ///< 0 unless locked by a transaction
-  pmr_concurrent_vector<CommitID> begin_cids;                  ///< commit id when record was added
-  pmr_concurrent_vector<CommitID> end_cids;                    ///< commit id when record was deleted
+  MvccVector<copyable_atomic<TransactionID>> tids;  ///< 0 unless locked by a transaction
+  MvccVector<CommitID> begin_cids;                  ///< commit id when record was added
+  MvccVector<CommitID> end_cids;                    ///< commit id when record was deleted
 
   explicit MvccColumns(const size_t size);
 
   size_t size() const;
 
   /**
-   * Compacts the internal representation of
-   * the mvcc columns in order to reduce fragmentation
-   * Locks mvcc columns exclusively in order to do so
+   * Moves the mvcc columns into contiguous memory once the chunk does not grow anymore, which removes the
+   * fragmentation of the concurrent vectors and the segment lookup on every access. Afterwards, grow_by() is not
+   * possible anymore. Requires the mvcc columns to be locked exclusively, see Chunk::shrink_mvcc_columns().
    */
   void shrink();
 
+  // True once shrink() has been called
+  bool is_contiguous() const;
+
   /**
    * Grows all mvcc columns by the given delta
    *
@@ -41,19 +46,79 @@ struct MvccColumns {
    */
   void grow_by(size_t delta, CommitID begin_cid);
 
+  /**
+   * Reserves up to row_count rows at the end of the mvcc columns for an Insert, but does not grow them beyond
+   * max_size. Inserts into the same chunk can reserve rows concurrently, without a lock. The reserved rows are
+   * uncommitted, see add_uncommitted_rows().
+   *
+   * @return the offset of the first reserved row and the number of reserved rows, which is zero if the chunk is full
+   *         or contiguous already
+   */
+  std::pair<ChunkOffset, ChunkOffset> reserve_rows(ChunkOffset row_count, ChunkOffset max_size);
+
+  /**
+   * @defgroup Summary of the MVCC columns
+   *
+   * The summary allows Validate to skip the per-row checks for chunks that have not been modified since a
+   * transaction started, which is the case for most chunks of read-mostly tables. It is maintained by the read-write
+   * operators and is conservative: max_begin_cid() is never smaller and min_end_cid() never greater than the commit ids
+   * of the rows, and every row that has been inserted or locked by an unfinished transaction is counted as
+   * uncommitted. Rows that have been added by grow_by() with MAX_COMMIT_ID as begin_cid are counted automatically.
+   * @{
+   */
+
+  // True if all rows are visible to every transaction with the given snapshot commit id
+  bool is_fully_visible(CommitID snapshot_commit_id) const;
+
+  CommitID max_begin_cid() const;
+  CommitID min_end_cid() const;
+
+  // True if rows have been deleted (or rolled back inserts invalidated)
+  bool has_deletes() const;
+
+  /**
+   * True if rows are inserted or locked by unfinished transactions. Otherwise, no row is locked by the calling
+   * transaction and the visibility of the rows only depends on their begin_cids and end_cids.
+   */
+  bool has_uncommitted_rows() const;
+
+  // Called when the begin_cid or end_cid of a row has been set
+  void update_max_begin_cid(CommitID begin_cid);
+  void update_min_end_cid(CommitID end_cid);
+
+  // Called before rows are locked or inserted and after they have been committed, rolled back or unlocked
+  void add_uncommitted_rows(size_t count);
+  void remove_uncommitted_rows(size_t count);
+
+  /**
+   * Recomputes the summary from the columns. Used after they have been written directly, e.g., when loading or
+   * recovering tables. Must not be called while transactions modify the chunk.
+   */
+  void update_summary();
+
+  /** @} */
+
   void print(std::ostream& stream = std::cout) const;
 
  private:
   /**
    * @brief Mutex used to manage access to MVCC columns
    *
-   * Exclusively locked in shrink()
+   * Exclusively locked in Chunk::shrink_mvcc_columns()
    * Locked for shared ownership when MVCC columns of a Chunk are accessed
    * via the mvcc_columns() getters
    */
   std::shared_mutex _mutex;
 
-  size_t _size{0};
+  void _grow_to_at_least(size_t size, CommitID begin_cid);
+
+  // Rows are reserved before the vectors grow, and size() only includes rows for which the vectors have grown
+  std::atomic<size_t> _reserved_size{0};
+  std::atomic<size_t> _size{0};
+
+  std::atomic<CommitID> _max_begin_cid{0};
+  std::atomic<CommitID> _min_end_cid{MAX_COMMIT_ID};
+  std::atomic<size_t> _uncommitted_row_count{0};
 };
 
 }  // namespace opossum
@@ -0,0 +1,116 @@
+#pragma once
+
+#include <boost/iterator/iterator_facade.hpp>
+
+#include <cstddef>
+#include <utility>
+
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+/**
+ * @brief Vector of per-row MVCC data (see MvccColumns)
+ *
+ * While a chunk is mutable, rows are appended while other transactions read the chunk. The values are then stored in
+ * a segmented pmr_concurrent_vector, which never moves existing elements when it grows. Once the chunk has been
+ * encoded, its size does not change anymore and make_contiguous() moves the values into a single array. Accessing an
+ * element of the array does not have to look up its segment first, and loops over data() can be vectorized.
+ *
+ * Element access dispatches on the layout. Since all rows of a chunk share the layout, the branch is well predicted.
+ */
+template <typename T>
+class MvccVector {
+ public:
+  using value_type = T;
+
+  template <typename Vector, typename Value>
+  class Iterator : public boost::iterator_facade<Iterator<Vector, Value>, Value, boost::random_access_traversal_tag> {
+   public:
+    Iterator(Vector& vector, const size_t index) : _vector{&vector}, _index{index} {}
+
+   private:
+    friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
+
+    void increment() { ++_index; }
+    void decrement() { --_index; }
+    void advance(const std::ptrdiff_t n) { _index += n; }
+    std::ptrdiff_t distance_to(const Iterator& other) const {
+      return static_cast<std::ptrdiff_t>(other._index) - static_cast<std::ptrdiff_t>(_index);
+    }
+    bool equal(const Iterator& other) const { return _vector == other._vector && _index == other._index; }
+    Value& dereference() const { return (*_vector)[_index]; }
+
+    Vector* _vector;
+    size_t _index;
+  };
+
+  using iterator = Iterator<MvccVector<T>, T>;
+  using const_iterator = Iterator<const MvccVector<T>, const T>;
+
+  T& operator[](const size_t index) {
+    return _is_contiguous ? _contiguous_values[index] : _concurrent_values[index];
+  }
+
+  const T& operator[](const size_t index) const {
+    return _is_contiguous ? _contiguous_values[index] : _concurrent_values[index];
+  }
+
+  T& at(const size_t index) { return _is_contiguous ? _contiguous_values.at(index) : _concurrent_values.at(index); }
+
+  const T& at(const size_t index) const {
+    return _is_contiguous ? _contiguous_values.at(index) : _concurrent_values.at(index);
+  }
+
+  T& back() { return _is_contiguous ? _contiguous_values.back() : _concurrent_values.back(); }
+  const T& back() const { return _is_contiguous ? _contiguous_values.back() : _concurrent_values.back(); }
+
+  size_t size() const { return _is_contiguous ? _contiguous_values.size() : _concurrent_values.size(); }
+
+  iterator begin() { return iterator{*this, 0u}; }
+  iterator end() { return iterator{*this, size()}; }
+  const_iterator begin() const { return const_iterator{*this, 0u}; }
+  const_iterator end() const { return const_iterator{*this, size()}; }
+  const_iterator cbegin() const { return begin(); }
+  const_iterator cend() const { return end(); }
+
+  // Only possible as long as the values are not contiguous
+  void grow_to_at_least(const size_t size, const T& value = T{}) {
+    Assert(!_is_contiguous, "Cannot grow contiguous MVCC vector");
+    _concurrent_values.grow_to_at_least(size, value);
+  }
+
+  bool is_contiguous() const { return _is_contiguous; }
+
+  /**
+   * Moves the values into contiguous memory. Must not be called concurrently with any other access, see
+   * MvccColumns::shrink().
+   */
+  void make_contiguous() {
+    if (_is_contiguous) return;
+
+    _contiguous_values = pmr_vector<T>(_concurrent_values.cbegin(), _concurrent_values.cend());
+    _concurrent_values.clear();
+    _concurrent_values.shrink_to_fit();
+    _is_contiguous = true;
+  }
+
+  // Only available once the values are contiguous
+  T* data() {
+    DebugAssert(_is_contiguous, "MVCC vector is not contiguous");
+    return _contiguous_values.data();
+  }
+
+  const T* data() const {
+    DebugAssert(_is_contiguous, "MVCC vector is not contiguous");
+    return _contiguous_values.data();
+  }
+
+ private:
+  pmr_concurrent_vector<T> _concurrent_values;
+  pmr_vector<T> _contiguous_values;
+  bool _is_contiguous{false};
+};
+
+}  // namespace opossum
@@ -1,5 +1,7 @@
 #include "storage_manager.hpp"
 
+#include <functional>
+#include <map>
 #include <memory>
 #include <string>
 #include <utility>
@@ -9,10 +11,20 @@
 #include "operators/export_csv.hpp"
 #include "operators/table_wrapper.hpp"
 #include "scheduler/job_task.hpp"
+#include "scheduler/scheduler_statistics.hpp"
 #include "statistics/generate_table_statistics.hpp"
 #include "statistics/table_statistics.hpp"
 #include "utils/assert.hpp"
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+const std::map<std::string, std::function<std::shared_ptr<Table>()>> meta_table_generators = {
+    {"meta_scheduler", generate_scheduler_statistics_table}};
+
+}  // namespace
+
 namespace opossum {
 
 // singleton
@@ -23,6 +35,7 @@ StorageManager& StorageManager::get() {
 
 void StorageManager::add_table(const std::string& name, std::shared_ptr<Table> table) {
   Assert(_tables.find(name) == _tables.end(), "A table with the name " + name + " already exists");
+  Assert(!is_meta_table(name), "Cannot add table " + name + " - a meta table with the same name exists");
   Assert(_views.find(name) == _views.end(), "Cannot add table " + name + " - a view with the same name already exists");
 
   for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); chunk_id++) {
@@ -39,13 +52,22 @@ void StorageManager::drop_table(const std::string& name) {
 }
 
 std::shared_ptr<Table> StorageManager::get_table(const std::string& name) const {
+  const auto meta_table_iter = meta_table_generators.find(name);
+  if (meta_table_iter != meta_table_generators.end()) {
+    auto meta_table = meta_table_iter->second();
+    meta_table->set_table_statistics(std::make_shared<TableStatistics>(generate_table_statistics(*meta_table)));
+    return meta_table;
+  }
+
   const auto iter = _tables.find(name);
   Assert(iter != _tables.end(), "No such table named '" + name + "'");
 
   return iter->second;
 }
 
-bool StorageManager::has_table(const std::string& name) const { return _tables.count(name); }
+bool StorageManager::has_table(const std::string& name) const { return _tables.count(name) || is_meta_table(name); }
+
+bool StorageManager::is_meta_table(const std::string& name) { return meta_table_generators.count(name); }
 
 std::vector<std::string> StorageManager::table_names() const {
   std::vector<std::string> table_names;
@@ -61,6 +83,7 @@ std::vector<std::string> StorageManager::table_names() const {
 void StorageManager::add_view(const std::string& name, std::shared_ptr<const AbstractLQPNode> view) {
   Assert(_tables.find(name) == _tables.end(),
          "Cannot add view " + name + " - a table with the same name already exists");
+  Assert(!is_meta_table(name), "Cannot add view " + name + " - a meta table with the same name exists");
   Assert(_views.find(name) == _views.end(), "A view with the name " + name + " already exists");
 
   _views.emplace(name, std::move(view));
@@ -15,6 +15,8 @@ class AbstractLQPNode;
 
 // The StorageManager is a singleton that maintains all tables
 // by mapping table names to table instances.
+// Additionally, it provides read-only meta tables (e.g., meta_scheduler), whose contents are generated on every access
+// to get_table(). They cannot be added or dropped and are not listed by table_names().
 class StorageManager : private Noncopyable {
  public:
   static StorageManager& get();
@@ -31,6 +33,9 @@ class StorageManager : private Noncopyable {
   // returns whether the storage manager holds a table with the given name
   bool has_table(const std::string& name) const;
 
+  // returns whether the given name refers to a meta table
+  static bool is_meta_table(const std::string& name);
+
   // returns a list of all table names
   std::vector<std::string> table_names() const;
 
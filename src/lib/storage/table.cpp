@@ -107,40 +107,57 @@ void Table::append_mutable_chunk() {
   append_chunk(columns);
 }
 
+void Table::replace_chunk(ChunkID chunk_id, const std::shared_ptr<Chunk>& chunk) {
+  Assert(chunk_id < _chunks.size(), "ChunkID " + std::to_string(chunk_id) + " out of range");
+  Assert(chunk->column_count() == column_count(), "Chunk does not match the columns of the table");
+  Assert(chunk->has_mvcc_columns() == (_use_mvcc == UseMvcc::Yes),
+         "Chunk does not match the MVCC setting of the table");
+  std::atomic_store(&_chunks[chunk_id], chunk);
+}
+
+bool Table::replace_chunk_if_unchanged(ChunkID chunk_id, std::shared_ptr<Chunk> expected_chunk,
+                                       const std::shared_ptr<Chunk>& chunk) {
+  Assert(chunk_id < _chunks.size(), "ChunkID " + std::to_string(chunk_id) + " out of range");
+  Assert(chunk->column_count() == column_count(), "Chunk does not match the columns of the table");
+  Assert(chunk->has_mvcc_columns() == (_use_mvcc == UseMvcc::Yes),
+         "Chunk does not match the MVCC setting of the table");
+  return std::atomic_compare_exchange_strong(&_chunks[chunk_id], &expected_chunk, chunk);
+}
+
 uint64_t Table::row_count() const {
   uint64_t ret = 0;
-  for (const auto& chunk : _chunks) {
-    ret += chunk->size();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count(); ++chunk_id) {
+    ret += get_chunk(chunk_id)->size();
   }
   return ret;
 }
 
 bool Table::empty() const { return row_count() == 0u; }
 
-ChunkID Table::chunk_count() const { return static_cast<ChunkID>(_chunks.size()); }
+ChunkID Table::chunk_count() const { return static_cast<ChunkID>(_chunk_count.load()); }
 
-const std::vector<std::shared_ptr<Chunk>>& Table::chunks() const { return _chunks; }
+const tbb::concurrent_vector<std::shared_ptr<Chunk>>& Table::chunks() const { return _chunks; }
 
 uint32_t Table::max_chunk_size() const { return _max_chunk_size; }
 
 std::shared_ptr<Chunk> Table::get_chunk(ChunkID chunk_id) {
   DebugAssert(chunk_id < _chunks.size(), "ChunkID " + std::to_string(chunk_id) + " out of range");
-  return _chunks[chunk_id];
+  return std::atomic_load(&_chunks[chunk_id]);
 }
 
 std::shared_ptr<const Chunk> Table::get_chunk(ChunkID chunk_id) const {
   DebugAssert(chunk_id < _chunks.size(), "ChunkID " + std::to_string(chunk_id) + " out of range");
-  return _chunks[chunk_id];
+  return std::atomic_load(&_chunks[chunk_id]);
 }
 
 ProxyChunk Table::get_chunk_with_access_counting(ChunkID chunk_id) {
   DebugAssert(chunk_id < _chunks.size(), "ChunkID " + std::to_string(chunk_id) + " out of range");
-  return ProxyChunk(_chunks[chunk_id]);
+  return ProxyChunk(std::atomic_load(&_chunks[chunk_id]));
 }
 
 const ProxyChunk Table::get_chunk_with_access_counting(ChunkID chunk_id) const {
   DebugAssert(chunk_id < _chunks.size(), "ChunkID " + std::to_string(chunk_id) + " out of range");
-  return ProxyChunk(_chunks[chunk_id]);
+  return ProxyChunk(std::atomic_load(&_chunks[chunk_id]));
 }
 
 void Table::append_chunk(const ChunkColumns& columns, const std::optional<PolymorphicAllocator<Chunk>>& alloc,
@@ -169,6 +186,7 @@ void Table::append_chunk(const ChunkColumns& columns, const std::optional<Polymo
   }
 
   _chunks.emplace_back(std::make_shared<Chunk>(columns, mvcc_columns, alloc, access_counter));
+  ++_chunk_count;
 }
 
 void Table::append_chunk(const std::shared_ptr<Chunk> chunk) {
@@ -190,6 +208,7 @@ void Table::append_chunk(const std::shared_ptr<Chunk> chunk) {
               "Chunk does not have the same MVCC setting as the table.");
 
   _chunks.emplace_back(chunk);
+  ++_chunk_count;
 }
 
 std::unique_lock<std::mutex> Table::acquire_append_mutex() { return std::unique_lock<std::mutex>(*_append_mutex); }
@@ -199,8 +218,8 @@ std::vector<IndexInfo> Table::get_indexes() const { return _indexes; }
 size_t Table::estimate_memory_usage() const {
   auto bytes = size_t{sizeof(*this)};
 
-  for (const auto& chunk : _chunks) {
-    bytes += chunk->estimate_memory_usage();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count(); ++chunk_id) {
+    bytes += get_chunk(chunk_id)->estimate_memory_usage();
   }
 
   for (const auto& column_definition : _column_definitions) {
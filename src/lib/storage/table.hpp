@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -79,8 +80,8 @@ class Table : private Noncopyable {
   // returns the number of chunks (cannot exceed ChunkID (uint32_t))
   ChunkID chunk_count() const;
 
-  // Returns all Chunks
-  const std::vector<std::shared_ptr<Chunk>>& chunks() const;
+  // Returns all Chunks. The elements must not be read while chunks might be replaced concurrently, use get_chunk().
+  const tbb::concurrent_vector<std::shared_ptr<Chunk>>& chunks() const;
 
   // returns the chunk with the given id
   std::shared_ptr<Chunk> get_chunk(ChunkID chunk_id);
@@ -107,6 +108,22 @@ class Table : private Noncopyable {
   // Create and append a Chunk consisting of ValueColumns.
   void append_mutable_chunk();
 
+  /**
+   * Atomically replaces the chunk at chunk_id. Used to free chunks whose rows are invisible to all transactions (see
+   * concurrency/garbage_collector.hpp). Like with Chunk::replace_column(), operators that hold a pointer to the old
+   * chunk can continue to use it.
+   */
+  void replace_chunk(ChunkID chunk_id, const std::shared_ptr<Chunk>& chunk);
+
+  /**
+   * Like replace_chunk(), but only replaces the chunk if it is still expected_chunk, i.e., if it has not been replaced
+   * concurrently. Used by the DeltaMerger (see storage/delta_merger.hpp).
+   *
+   * @return true if the chunk has been replaced
+   */
+  bool replace_chunk_if_unchanged(ChunkID chunk_id, std::shared_ptr<Chunk> expected_chunk,
+                                  const std::shared_ptr<Chunk>& chunk);
+
   /** @} */
 
   /**
@@ -141,6 +158,8 @@ class Table : private Noncopyable {
 
   /** @} */
 
+  // Chunks that are appended while other threads might append chunks as well (e.g., by Insert once the last chunk is
+  // full) are appended while holding this mutex. Rows are inserted without it, see MvccColumns::reserve_rows().
   std::unique_lock<std::mutex> acquire_append_mutex();
 
   void set_table_statistics(std::shared_ptr<TableStatistics> table_statistics) { _table_statistics = table_statistics; }
@@ -185,7 +204,10 @@ class Table : private Noncopyable {
   const TableType _type;
   const UseMvcc _use_mvcc;
   const uint32_t _max_chunk_size;
-  std::vector<std::shared_ptr<Chunk>> _chunks;
+  // Chunks never move when the vector grows, so that chunks can be appended while other threads access the table.
+  // _chunk_count is increased once a chunk is completely appended.
+  tbb::concurrent_vector<std::shared_ptr<Chunk>> _chunks;
+  std::atomic<uint32_t> _chunk_count{0};
   std::shared_ptr<TableStatistics> _table_statistics;
   std::unique_ptr<std::mutex> _append_mutex;
   std::vector<IndexInfo> _indexes;
@@ -33,6 +33,8 @@ class Chunk;
  *
  * Note: Reference columns are not invalidated by this task because the order in which
  *       records are stored does not change.
+ *
+ * To compress completed chunks automatically, see storage/delta_merger.hpp.
  */
 class ChunkCompressionTask : public AbstractTask {
  public:
@@ -2,6 +2,8 @@
 
 #include "concurrency/transaction_context.hpp"
 #include "concurrency/transaction_manager.hpp"
+#include "scheduler/admission_control.hpp"
+#include "scheduler/cancellation_token.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "sql/sql_query_plan.hpp"
 
@@ -9,8 +11,32 @@ namespace opossum {
 
 void ExecuteServerPreparedStatementTask::_on_execute() {
   try {
+    auto cancellation_token = std::shared_ptr<CancellationToken>{};
+    if (_statement_timeout) {
+      cancellation_token = std::make_shared<CancellationToken>(*_statement_timeout);
+      _prepared_plan->set_cancellation_token(cancellation_token);
+    }
+
     const auto tasks = _prepared_plan->create_tasks();
-    CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+    if (cancellation_token) cancellation_token->start();
+
+    {
+      const auto admission = AdmissionControl::get().admit(AdmissionControl::estimate_cost(tasks));
+      for (const auto& task : tasks) {
+        task->set_query(admission->query_id(), admission->priority(), admission->task_limit());
+      }
+
+      CurrentScheduler::schedule_and_wait_for_tasks(tasks, admission->priority());
+    }
+
+    if (cancellation_token && cancellation_token->is_cancelled()) {
+      // See SQLPipelineStatement::get_result_table()
+      if (const auto transaction_context = tasks.back()->get_operator()->transaction_context()) {
+        transaction_context->rollback();
+      }
+      throw std::runtime_error("Statement timeout exceeded");
+    }
+
     auto result_table = tasks.back()->get_operator()->get_output();
     _promise.set_value(std::move(result_table));
   } catch (const std::exception&) {
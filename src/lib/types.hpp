@@ -122,6 +122,7 @@ struct RowID {
 
 using WorkerID = uint32_t;
 using TaskID = uint32_t;
+using QueryID = uint32_t;
 
 // When changing these to 64-bit types, reading and writing to them might not be atomic anymore.
 // Among others, the validate operator might break when another operator is simultaneously writing begin or end CIDs.
@@ -137,6 +138,7 @@ using ColumnIDPair = std::pair<ColumnID, ColumnID>;
 
 constexpr NodeID INVALID_NODE_ID{std::numeric_limits<NodeID::base_type>::max()};
 constexpr TaskID INVALID_TASK_ID{std::numeric_limits<TaskID>::max()};
+constexpr QueryID INVALID_QUERY_ID{std::numeric_limits<QueryID>::max()};
 constexpr CpuID INVALID_CPU_ID{std::numeric_limits<CpuID::base_type>::max()};
 constexpr WorkerID INVALID_WORKER_ID{std::numeric_limits<WorkerID>::max()};
 constexpr ColumnID INVALID_COLUMN_ID{std::numeric_limits<ColumnID::base_type>::max()};
@@ -256,6 +258,8 @@ enum class DescriptionMode { SingleLine, MultiLine };
 
 enum class UseMvcc : bool { Yes = true, No = false };
 
+enum class UsePipelining : bool { Yes = true, No = false };
+
 class Noncopyable {
  protected:
   Noncopyable() = default;
@@ -12,4 +12,13 @@ namespace opossum {
 template <typename T>
 std::function<T(const T&, const T&)> function_for_arithmetic_expression(ExpressionType type);
 
+/**
+ * Calls functor with the arithmetic operator function object equivalent to the given ExpressionType. In contrast to
+ * function_for_arithmetic_expression(), the operator is passed as its concrete type, so that loops applying it to
+ * entire vectors can be inlined and vectorized by the compiler.
+ * Integer divisions (and modulos) by 0 return 0, the caller is responsible for rejecting them beforehand.
+ */
+template <typename T, typename Functor>
+void resolve_arithmetic_operator(ExpressionType type, const Functor& functor);
+
 }  // namespace opossum
@@ -1,5 +1,9 @@
 #pragma once
 
+#include <functional>
+#include <string>
+#include <type_traits>
+
 #include <types.hpp>
 
 namespace opossum {
@@ -75,4 +79,41 @@ inline std::function<int(const int&, const int&)> function_for_arithmetic_expres
   return _get_base_operator_function<int>(type);
 }
 
+template <typename T, typename Functor>
+void resolve_arithmetic_operator(ExpressionType type, const Functor& functor) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    Assert(type == ExpressionType::Addition, "Arithmetic operator except for addition not defined for std::string");
+    functor(std::plus<std::string>());
+  } else {
+    switch (type) {
+      case ExpressionType::Addition:
+        functor(std::plus<T>());
+        return;
+      case ExpressionType::Subtraction:
+        functor(std::minus<T>());
+        return;
+      case ExpressionType::Multiplication:
+        functor(std::multiplies<T>());
+        return;
+      case ExpressionType::Division:
+        if constexpr (std::is_integral_v<T>) {
+          functor([](const T& lhs, const T& rhs) { return rhs == 0 ? T{0} : lhs / rhs; });
+        } else {
+          functor(std::divides<T>());
+        }
+        return;
+      case ExpressionType::Modulo:
+        if constexpr (std::is_integral_v<T>) {
+          functor([](const T& lhs, const T& rhs) { return rhs == 0 ? T{0} : lhs % rhs; });
+          return;
+        } else {
+          Fail("Modulo is not defined for floating point types");
+        }
+
+      default:
+        Fail("Unknown arithmetic operator");
+    }
+  }
+}
+
 }  // namespace opossum
@@ -58,6 +58,10 @@ std::shared_ptr<Table> load_table(const std::string& file_name, size_t chunk_siz
     auto mvcc_columns = chunk->mvcc_columns();
     mvcc_columns->begin_cids.back() = 0;
   }
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < test_table->chunk_count(); ++chunk_id) {
+    test_table->get_chunk(chunk_id)->mvcc_columns()->update_summary();
+  }
   return test_table;
 }
 
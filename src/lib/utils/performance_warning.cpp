@@ -2,7 +2,7 @@
 
 namespace opossum {
 
-bool PerformanceWarningClass::_disabled = []() {
+std::atomic_uint32_t PerformanceWarningClass::_disabler_count = []() {
 // static initializer hack to print some warnings in various binaries
 
 #if !IS_DEBUG && !defined(WITH_LTO)
@@ -13,7 +13,7 @@ bool PerformanceWarningClass::_disabled = []() {
   PerformanceWarning("Hyrise is running as a debug build.");
 #endif
 
-  return false;
+  return 0u;
 }();
 
 }  // namespace opossum
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <boost/preprocessor/stringize.hpp>
+#include <atomic>
 #include <iostream>
 #include <string>
 
@@ -18,7 +19,8 @@
  * }
  * // warnings are enabled again
  *
- * Warnings do not print in tests.
+ * Warnings do not print in tests. As operators disable warnings from within parallel jobs, which can overlap in any
+ * order, the disablers are counted atomically. Warnings are enabled again once the last disabler is destroyed.
  */
 
 namespace opossum {
@@ -28,33 +30,28 @@ class PerformanceWarningDisabler;
 class PerformanceWarningClass {
  public:
   explicit PerformanceWarningClass(const std::string& text) {
-    if (_disabled) return;
+    if (_disabler_count > 0) return;
     std::cout << "[PERF] " << text << "\n\tPerformance can be affected. This warning is only shown once.\n"
               << std::endl;
   }
 
  protected:
-  static bool _disabled;
+  static std::atomic_uint32_t _disabler_count;
 
-  static bool disable() {
-    bool previous = _disabled;
-    _disabled = true;
-    return previous;
-  }
+  static void disable() { ++_disabler_count; }
 
-  static void enable() { _disabled = false; }
+  static void enable() { --_disabler_count; }
 
   friend class PerformanceWarningDisabler;
 };
 
 class PerformanceWarningDisabler {
-  bool _previously_disabled;
-
  public:
-  PerformanceWarningDisabler() : _previously_disabled(PerformanceWarningClass::disable()) {}
-  ~PerformanceWarningDisabler() {
-    if (!_previously_disabled) PerformanceWarningClass::enable();
-  }
+  PerformanceWarningDisabler() { PerformanceWarningClass::disable(); }
+  ~PerformanceWarningDisabler() { PerformanceWarningClass::enable(); }
+
+  PerformanceWarningDisabler(const PerformanceWarningDisabler&) = delete;
+  PerformanceWarningDisabler& operator=(const PerformanceWarningDisabler&) = delete;
 };
 
 #ifndef __FILENAME__
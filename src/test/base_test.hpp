@@ -5,11 +5,16 @@
 #include <utility>
 #include <vector>
 
+#include "concurrency/garbage_collector.hpp"
 #include "concurrency/transaction_manager.hpp"
 #include "gtest/gtest.h"
+#include "logging/logger.hpp"
 #include "operators/abstract_operator.hpp"
+#include "scheduler/admission_control.hpp"
 #include "scheduler/current_scheduler.hpp"
+#include "scheduler/task_tracer.hpp"
 #include "storage/column_encoding_utils.hpp"
+#include "storage/delta_merger.hpp"
 #include "storage/dictionary_column.hpp"
 #include "storage/numa_placement_manager.hpp"
 #include "storage/storage_manager.hpp"
@@ -70,8 +75,13 @@ class BaseTestWithParam : public std::conditional<std::is_same<ParamType, void>:
     NUMAPlacementManager::get().pause();
 #endif
 
+    DeltaMerger::reset();
+    GarbageCollector::reset();
+    Logger::reset();
     StorageManager::reset();
     TransactionManager::reset();
+    AdmissionControl::reset();
+    TaskTracer::reset();
   }
 };
 
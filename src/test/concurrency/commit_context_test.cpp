@@ -17,32 +17,26 @@ class CommitContextTest : public BaseTest {
   void SetUp() override {}
 };
 
-TEST_F(CommitContextTest, HasNextReturnsFalse) {
+TEST_F(CommitContextTest, IsNotPendingInitially) {
   auto context = std::make_unique<CommitContext>(0u);
 
-  EXPECT_EQ(context->has_next(), false);
+  EXPECT_FALSE(context->is_pending());
 }
 
-TEST_F(CommitContextTest, HasNextReturnsTrueAfterNextHasBeenSet) {
+TEST_F(CommitContextTest, CallbackFiresAfterMakePending) {
   auto context = std::make_unique<CommitContext>(0u);
 
-  auto next_context = std::make_shared<CommitContext>(context->commit_id() + 1u);
+  auto committed_transaction_id = TransactionID{0};
+  context->make_pending(TransactionID{17}, [&](TransactionID transaction_id) {
+    committed_transaction_id = transaction_id;
+  });
 
-  EXPECT_TRUE(context->try_set_next(next_context));
+  EXPECT_TRUE(context->is_pending());
+  EXPECT_EQ(committed_transaction_id, TransactionID{0});
 
-  EXPECT_EQ(context->has_next(), true);
-}
-
-TEST_F(CommitContextTest, TrySetNextFailsIfNotNullptr) {
-  auto context = std::make_unique<CommitContext>(0u);
-
-  auto next_context = std::make_shared<CommitContext>(context->commit_id() + 1u);
-
-  EXPECT_TRUE(context->try_set_next(next_context));
-
-  next_context = std::make_shared<CommitContext>(context->commit_id() + 1u);
+  context->fire_callback();
 
-  EXPECT_FALSE(context->try_set_next(next_context));
+  EXPECT_EQ(committed_transaction_id, TransactionID{17});
 }
 
 }  // namespace opossum
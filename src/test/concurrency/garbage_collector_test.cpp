@@ -0,0 +1,164 @@
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/garbage_collector.hpp"
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "logging/log_recovery.hpp"
+#include "logging/logger.hpp"
+#include "operators/delete.hpp"
+#include "operators/get_table.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/validate.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "utils/filesystem.hpp"
+
+namespace opossum {
+
+class GarbageCollectorTest : public BaseTest {
+ protected:
+  void SetUp() override { _add_table(); }
+
+  // Chunks: [1, 24, 234, 25], [23, 4, 2, 5], [234, 234]
+  void _add_table() {
+    _table = load_table("src/test/tables/10_ints.tbl", 4);
+    ChunkEncoder::encode_chunks(_table, {ChunkID{0}, ChunkID{1}}, {EncodingType::Dictionary});
+    StorageManager::get().add_table("table_a", _table);
+  }
+
+  static std::shared_ptr<const Table> _validate(const std::shared_ptr<TransactionContext>& context) {
+    const auto get_table = std::make_shared<GetTable>("table_a");
+    get_table->execute();
+
+    const auto validate = std::make_shared<Validate>(get_table);
+    validate->set_transaction_context(context);
+    validate->execute();
+    return validate->get_output();
+  }
+
+  static std::shared_ptr<const Table> _select() {
+    return _validate(TransactionManager::get().new_transaction_context());
+  }
+
+  static void _delete(const PredicateCondition predicate_condition, const int value) {
+    const auto context = TransactionManager::get().new_transaction_context();
+
+    const auto get_table = std::make_shared<GetTable>("table_a");
+    get_table->execute();
+
+    const auto validate = std::make_shared<Validate>(get_table);
+    validate->set_transaction_context(context);
+    validate->execute();
+
+    const auto table_scan = std::make_shared<TableScan>(validate, ColumnID{0}, predicate_condition, value);
+    table_scan->execute();
+
+    const auto delete_op = std::make_shared<Delete>("table_a", table_scan);
+    delete_op->set_transaction_context(context);
+    delete_op->execute();
+    ASSERT_FALSE(delete_op->execute_failed());
+    context->commit();
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(GarbageCollectorTest, OldestActiveSnapshotCommitId) {
+  auto& manager = TransactionManager::get();
+  EXPECT_EQ(manager.oldest_active_snapshot_commit_id(), manager.last_commit_id());
+
+  auto first_context = manager.new_transaction_context();
+  manager.new_transaction_context()->commit();
+  auto second_context = manager.new_transaction_context();
+  EXPECT_LT(first_context->snapshot_commit_id(), second_context->snapshot_commit_id());
+  EXPECT_EQ(manager.oldest_active_snapshot_commit_id(), first_context->snapshot_commit_id());
+
+  first_context.reset();
+  EXPECT_EQ(manager.oldest_active_snapshot_commit_id(), second_context->snapshot_commit_id());
+
+  manager.new_transaction_context()->commit();
+  second_context.reset();
+  EXPECT_EQ(manager.oldest_active_snapshot_commit_id(), manager.last_commit_id());
+}
+
+TEST_F(GarbageCollectorTest, CompactsAndFreesChunks) {
+  auto& garbage_collector = GarbageCollector::get();
+
+  // The deleted rows are still visible to a transaction that started before the delete
+  auto old_context = TransactionManager::get().new_transaction_context();
+  _delete(PredicateCondition::LessThan, 24);
+  EXPECT_EQ(garbage_collector.collect(), 0u);
+  EXPECT_EQ(_validate(old_context)->row_count(), 10u);
+
+  // Afterwards, the second chunk is freed. Only one row of the first chunk has been deleted, so it is left alone.
+  old_context.reset();
+  EXPECT_EQ(garbage_collector.collect(), 1u);
+  EXPECT_EQ(_table->get_chunk(ChunkID{1})->size(), 0u);
+  EXPECT_EQ(_table->get_chunk(ChunkID{0})->size(), 4u);
+
+  // Once most rows of the first chunk have been deleted, the remaining row is moved into a new chunk
+  _delete(PredicateCondition::LessThan, 200);
+  const auto expected_table = _select();
+  EXPECT_EQ(expected_table->row_count(), 3u);
+
+  old_context = TransactionManager::get().new_transaction_context();
+  EXPECT_EQ(garbage_collector.collect(), 1u);
+  ASSERT_EQ(_table->chunk_count(), 4u);
+  EXPECT_EQ(_table->get_chunk(ChunkID{3})->size(), 1u);
+  EXPECT_TABLE_EQ_UNORDERED(_validate(old_context), expected_table);
+  EXPECT_TABLE_EQ_UNORDERED(_select(), expected_table);
+
+  // The first chunk is freed once no transaction can see its rows anymore
+  EXPECT_EQ(garbage_collector.collect(), 0u);
+  old_context.reset();
+  EXPECT_EQ(garbage_collector.collect(), 1u);
+  EXPECT_EQ(_table->get_chunk(ChunkID{0})->size(), 0u);
+  EXPECT_EQ(_table->row_count(), 3u);
+  EXPECT_TABLE_EQ_UNORDERED(_select(), expected_table);
+}
+
+TEST_F(GarbageCollectorTest, RunsInBackground) {
+  auto& garbage_collector = GarbageCollector::get();
+  garbage_collector.start({std::chrono::milliseconds{1}, 0.5});
+  EXPECT_TRUE(garbage_collector.is_running());
+
+  _delete(PredicateCondition::LessThan, 24);
+  for (auto attempt = 0; attempt < 1000 && _table->get_chunk(ChunkID{1})->size() > 0; ++attempt) {
+    std::this_thread::sleep_for(std::chrono::milliseconds{1});
+  }
+  EXPECT_EQ(_table->get_chunk(ChunkID{1})->size(), 0u);
+
+  garbage_collector.stop();
+  EXPECT_FALSE(garbage_collector.is_running());
+}
+
+TEST_F(GarbageCollectorTest, CompactionIsRecovered) {
+  const auto log_file_path = test_data_path + "garbage_collector_test.log";
+  filesystem::remove(log_file_path);
+  Logger::get().enable(log_file_path);
+
+  // Frees the second chunk and moves the remaining rows of the first one
+  _delete(PredicateCondition::LessThan, 25);
+  EXPECT_EQ(GarbageCollector::get().collect(), 2u);
+  _delete(PredicateCondition::Equals, 25);
+  const auto expected_table = _select();
+
+  // Restart from the original table and replay the log, which contains the moved rows
+  Logger::reset();
+  StorageManager::reset();
+  TransactionManager::reset();
+  _add_table();
+  recover_from_log(log_file_path);
+  filesystem::remove(log_file_path);
+
+  EXPECT_TABLE_EQ_UNORDERED(_select(), expected_table);
+}
+
+}  // namespace opossum
@@ -2,6 +2,7 @@
 #include <limits>
 #include <memory>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -106,4 +107,93 @@ TEST_F(TransactionContextTest, CallbackFiresWhenCommitted) {
   EXPECT_EQ(context_2->phase(), TransactionPhase::Committed);
 }
 
+TEST_F(TransactionContextTest, CommitBatchAssignsConsecutiveCommitIds) {
+  const auto prev_last_commit_id = manager().last_commit_id();
+
+  auto contexts = std::vector<std::shared_ptr<TransactionContext>>{};
+  for (auto index = 0; index < 3; ++index) {
+    contexts.emplace_back(manager().new_transaction_context());
+  }
+
+  // Committed transactions are skipped
+  contexts[1]->commit();
+  EXPECT_EQ(contexts[1]->commit_id(), prev_last_commit_id + 1);
+
+  manager().commit_batch(contexts);
+
+  EXPECT_EQ(contexts[0]->commit_id(), prev_last_commit_id + 2);
+  EXPECT_EQ(contexts[2]->commit_id(), prev_last_commit_id + 3);
+  EXPECT_EQ(manager().last_commit_id(), prev_last_commit_id + 3);
+
+  for (const auto& context : contexts) {
+    EXPECT_EQ(context->phase(), TransactionPhase::Committed);
+  }
+}
+
+TEST_F(TransactionContextTest, ConcurrentCommits) {
+  const auto prev_last_commit_id = manager().last_commit_id();
+
+  const auto thread_count = 8u;
+  const auto commit_count = 500u;
+
+  auto threads = std::vector<std::thread>{};
+  for (auto thread_id = 0u; thread_id < thread_count; ++thread_id) {
+    threads.emplace_back([&, thread_id]() {
+      // Every other thread commits batches of five transactions
+      const auto batch_size = thread_id % 2 == 0 ? 1u : 5u;
+      for (auto commit_index = 0u; commit_index < commit_count; commit_index += batch_size) {
+        auto contexts = std::vector<std::shared_ptr<TransactionContext>>{};
+        for (auto index = 0u; index < batch_size; ++index) {
+          contexts.emplace_back(manager().new_transaction_context());
+        }
+
+        if (batch_size == 1u) {
+          contexts.front()->commit();
+        } else {
+          manager().commit_batch(contexts);
+        }
+
+        // Once committed, a transaction is visible
+        EXPECT_GE(manager().last_commit_id(), contexts.back()->commit_id());
+      }
+    });
+  }
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(manager().last_commit_id(), prev_last_commit_id + thread_count * commit_count);
+}
+
+TEST_F(TransactionContextTest, ReadOnlyTransaction) {
+  const auto prev_last_commit_id = manager().last_commit_id();
+
+  auto read_only_context = manager().new_read_only_transaction_context();
+  EXPECT_TRUE(read_only_context->is_read_only());
+  EXPECT_EQ(read_only_context->snapshot_commit_id(), prev_last_commit_id);
+  EXPECT_EQ(manager().oldest_active_snapshot_commit_id(), prev_last_commit_id);
+
+  // Read-only transactions do not take transaction ids from other transactions
+  auto context_1 = manager().new_transaction_context();
+  manager().new_read_only_transaction_context();
+  auto context_2 = manager().new_transaction_context();
+  EXPECT_FALSE(context_1->is_read_only());
+  EXPECT_EQ(context_2->transaction_id(), context_1->transaction_id() + 1);
+
+  // Read-write operators cannot be executed
+  auto commit_op = std::make_shared<CommitFuncOp>([]() {});
+  auto other_read_only_context = manager().new_read_only_transaction_context();
+  commit_op->set_transaction_context(other_read_only_context);
+  EXPECT_THROW(commit_op->execute(), std::logic_error);
+
+  // Committing does not assign a commit id
+  EXPECT_TRUE(read_only_context->commit());
+  EXPECT_EQ(read_only_context->phase(), TransactionPhase::Committed);
+  EXPECT_EQ(manager().last_commit_id(), prev_last_commit_id);
+
+  context_1->commit();
+  EXPECT_EQ(context_1->commit_id(), prev_last_commit_id + 1);
+}
+
 }  // namespace opossum
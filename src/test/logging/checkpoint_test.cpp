@@ -0,0 +1,182 @@
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+
+#include "concurrency/transaction_context.hpp"
+#include "import_export/table_snapshot.hpp"
+#include "logging/checkpoint.hpp"
+#include "logging/log_recovery.hpp"
+#include "logging/logger.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "storage/base_encoded_column.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/index/base_filter.hpp"
+#include "utils/filesystem.hpp"
+
+namespace opossum {
+
+class CheckpointTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _checkpoint_directory = test_data_path + "checkpoint_test";
+    _log_file_path = test_data_path + "checkpoint_test.log";
+    filesystem::remove_all(_checkpoint_directory);
+    filesystem::remove(_log_file_path);
+
+    StorageManager::get().add_table("table_a", load_table("src/test/tables/int_int_int.tbl", 2));
+  }
+
+  void TearDown() override {
+    filesystem::remove_all(_checkpoint_directory);
+    filesystem::remove(_log_file_path);
+  }
+
+  static std::shared_ptr<const Table> _execute(const std::string& sql) {
+    return SQLPipelineBuilder{sql}.create_pipeline().get_result_table();
+  }
+
+  // Simulates a restart from the checkpoint and the log
+  size_t _restart(const CommitID expected_checkpoint_commit_id) {
+    Logger::reset();
+    StorageManager::reset();
+    TransactionManager::reset();
+
+    EXPECT_EQ(load_checkpoint(_checkpoint_directory), expected_checkpoint_commit_id);
+    return recover_from_log(_log_file_path);
+  }
+
+  std::string _checkpoint_directory;
+  std::string _log_file_path;
+};
+
+TEST_F(CheckpointTest, TableSnapshotKeepsEncodings) {
+  const auto table = load_table("src/test/tables/int_int4_with_null.tbl", 3);
+  ChunkEncoder::encode_chunks(
+      table, {ChunkID{0}, ChunkID{1}, ChunkID{2}},
+      std::map<ChunkID, ChunkEncodingSpec>{
+          {ChunkID{0}, ChunkEncodingSpec(2, {EncodingType::Dictionary, VectorCompressionType::FixedSizeByteAligned})},
+          {ChunkID{1}, ChunkEncodingSpec(2, {EncodingType::RunLength})},
+          {ChunkID{2}, ChunkEncodingSpec(2, {EncodingType::FrameOfReference, VectorCompressionType::SimdBp128})}});
+
+  const auto file_path = test_data_path + "checkpoint_test.snapshot";
+  write_table_snapshot(table, CommitID{0}, file_path);
+  const auto read_table = read_table_snapshot(file_path);
+  filesystem::remove(file_path);
+
+  EXPECT_TABLE_EQ_ORDERED(read_table, table);
+  ASSERT_EQ(read_table->chunk_count(), 4u);
+
+  const auto encoding_type_of_chunk = [&](const ChunkID chunk_id) {
+    const auto column = read_table->get_chunk(chunk_id)->get_column(ColumnID{1});
+    const auto encoded_column = std::dynamic_pointer_cast<const BaseEncodedColumn>(column);
+    return encoded_column ? encoded_column->encoding_type() : EncodingType::Unencoded;
+  };
+  EXPECT_EQ(encoding_type_of_chunk(ChunkID{0}), EncodingType::Dictionary);
+  EXPECT_EQ(encoding_type_of_chunk(ChunkID{1}), EncodingType::RunLength);
+  EXPECT_EQ(encoding_type_of_chunk(ChunkID{2}), EncodingType::FrameOfReference);
+  EXPECT_EQ(encoding_type_of_chunk(ChunkID{3}), EncodingType::Unencoded);
+  EXPECT_NE(read_table->get_chunk(ChunkID{0})->statistics(), nullptr);
+
+  // The last chunk is still mutable
+  read_table->append({1, 2});
+  EXPECT_EQ(read_table->row_count(), table->row_count() + 1);
+}
+
+TEST_F(CheckpointTest, TableSnapshotRestoresSecondaryStructures) {
+  const auto table = load_table("src/test/tables/int_float_double_string.tbl", 4);
+  ChunkEncoder::encode_all_chunks(table, {EncodingType::Dictionary, VectorCompressionType::SimdBp128});
+
+  const auto chunk = table->get_chunk(ChunkID{0});
+  chunk->populate_art_index(ColumnID{0});
+  chunk->populate_quotient_filter(ColumnID{3}, DataType::String, 4, 8)->execute();
+
+  const auto file_path = test_data_path + "checkpoint_test.snapshot";
+  write_table_snapshot(table, CommitID{0}, file_path);
+  const auto read_table = read_table_snapshot(file_path);
+  filesystem::remove(file_path);
+
+  EXPECT_TABLE_EQ_ORDERED(read_table, table);
+
+  const auto read_chunk = read_table->get_chunk(ChunkID{0});
+  EXPECT_NE(read_chunk->get_art_index(ColumnID{0}), nullptr);
+  EXPECT_EQ(read_chunk->get_art_index(ColumnID{1}), nullptr);
+
+  const auto filter = read_chunk->get_filter(ColumnID{3});
+  ASSERT_NE(filter, nullptr);
+  EXPECT_EQ(filter->quotient_bits(), 4u);
+  EXPECT_EQ(filter->remainder_bits(), 8u);
+  EXPECT_GT(filter->count_all_type("b"), 0u);
+  EXPECT_EQ(read_table->get_chunk(ChunkID{1})->get_filter(ColumnID{3}), nullptr);
+
+  // The filter is restored as it was, including its false positives
+  const auto original_filter = chunk->get_filter(ColumnID{3});
+  EXPECT_EQ(filter->load_factor(), original_filter->load_factor());
+  for (const auto& value : {"a", "b", "c", "d", "e", "f", "g", "h", "i", "j"}) {
+    EXPECT_EQ(filter->count_all_type(std::string{value}), original_filter->count_all_type(std::string{value}));
+  }
+}
+
+TEST_F(CheckpointTest, RestartFromCheckpointAndLog) {
+  EXPECT_EQ(load_checkpoint(_checkpoint_directory), std::nullopt);
+
+  Logger::get().enable(_log_file_path);
+  _execute("INSERT INTO table_a VALUES (1, 2, 3)");
+  _execute("DELETE FROM table_a WHERE a = 9");
+
+  const auto checkpoint_commit_id = create_checkpoint(_checkpoint_directory);
+  EXPECT_EQ(checkpoint_commit_id, TransactionManager::get().last_commit_id());
+
+  // The log only contains transactions after the checkpoint
+  EXPECT_EQ(filesystem::file_size(_log_file_path), 0u);
+
+  _execute("INSERT INTO table_a VALUES (4, 5, 6)");
+  _execute("UPDATE table_a SET b = 20 WHERE a = 1");
+  const auto expected_table = _execute("SELECT * FROM table_a");
+
+  EXPECT_EQ(_restart(checkpoint_commit_id), 2u);
+  EXPECT_TABLE_EQ_UNORDERED(_execute("SELECT * FROM table_a"), expected_table);
+
+  // A second checkpoint replaces the first one
+  const auto second_checkpoint_commit_id = create_checkpoint(_checkpoint_directory);
+  EXPECT_GT(second_checkpoint_commit_id, checkpoint_commit_id);
+
+  EXPECT_EQ(_restart(second_checkpoint_commit_id), 0u);
+  EXPECT_TABLE_EQ_UNORDERED(_execute("SELECT * FROM table_a"), expected_table);
+}
+
+TEST_F(CheckpointTest, CheckpointIsConsistent) {
+  Logger::get().enable(_log_file_path);
+
+  // The transaction is still active during the checkpoint and commits afterwards
+  const auto transaction_context = TransactionManager::get().new_transaction_context();
+  for (const auto& sql : {"INSERT INTO table_a VALUES (1, 2, 3)", "DELETE FROM table_a WHERE a = 9"}) {
+    SQLPipelineBuilder{sql}.with_transaction_context(transaction_context).create_pipeline().get_result_table();
+  }
+
+  const auto checkpoint_commit_id = create_checkpoint(_checkpoint_directory);
+  transaction_context->commit();
+  const auto expected_table = _execute("SELECT * FROM table_a");
+
+  Logger::reset();
+  StorageManager::reset();
+  TransactionManager::reset();
+  EXPECT_EQ(load_checkpoint(_checkpoint_directory), checkpoint_commit_id);
+
+  // The checkpoint does not contain the changes of the transaction. The query does not commit, so that the
+  // TransactionManager is still at the commit id of the checkpoint when the log is recovered.
+  const auto read_transaction_context = TransactionManager::get().new_transaction_context();
+  EXPECT_TABLE_EQ_UNORDERED(SQLPipelineBuilder{"SELECT * FROM table_a"}
+                                .with_transaction_context(read_transaction_context)
+                                .create_pipeline()
+                                .get_result_table(),
+                            load_table("src/test/tables/int_int_int.tbl"));
+
+  // They are replayed from the log
+  EXPECT_EQ(recover_from_log(_log_file_path), 1u);
+  EXPECT_TABLE_EQ_UNORDERED(_execute("SELECT * FROM table_a"), expected_table);
+}
+
+}  // namespace opossum
@@ -0,0 +1,200 @@
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../base_test.hpp"
+
+#include "concurrency/transaction_context.hpp"
+#include "logging/log_entry.hpp"
+#include "logging/log_recovery.hpp"
+#include "logging/logger.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "utils/filesystem.hpp"
+
+namespace opossum {
+
+class LoggerTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _log_file_path = test_data_path + "logger_test.log";
+    filesystem::remove(_log_file_path);
+
+    StorageManager::get().add_table("table_a", load_table("src/test/tables/int_int_int.tbl", 2));
+    StorageManager::get().add_table("table_b", load_table("src/test/tables/int_string.tbl", 4));
+  }
+
+  void TearDown() override { filesystem::remove(_log_file_path); }
+
+  static std::shared_ptr<const Table> _execute(const std::string& sql) {
+    return SQLPipelineBuilder{sql}.create_pipeline().get_result_table();
+  }
+
+  // Simulates a restart: all tables are loaded from their original files and the log is replayed
+  size_t _restart() {
+    Logger::reset();
+    StorageManager::reset();
+    TransactionManager::reset();
+
+    StorageManager::get().add_table("table_a", load_table("src/test/tables/int_int_int.tbl", 2));
+    StorageManager::get().add_table("table_b", load_table("src/test/tables/int_string.tbl", 4));
+    return recover_from_log(_log_file_path);
+  }
+
+  std::string _log_file_path;
+};
+
+TEST_F(LoggerTest, SerializeLogEntry) {
+  auto entry = LogEntry{TransactionID{5}, CommitID{7}};
+  entry.add_insert("table_a", RowID{ChunkID{1}, 2u}, {int32_t{1}, int64_t{2}, 3.5f, 4.5, "five", NULL_VALUE});
+  entry.add_delete("table_b", RowID{ChunkID{3}, 4u});
+
+  auto buffer = std::vector<char>{};
+  entry.serialize(buffer);
+  entry.serialize(buffer);
+
+  auto offset = size_t{0};
+  for (auto entry_idx = 0; entry_idx < 2; ++entry_idx) {
+    const auto deserialized_entry = LogEntry::deserialize(buffer, offset);
+    ASSERT_TRUE(deserialized_entry);
+    EXPECT_EQ(deserialized_entry->transaction_id, TransactionID{5});
+    EXPECT_EQ(deserialized_entry->commit_id, CommitID{7});
+    ASSERT_EQ(deserialized_entry->records.size(), 2u);
+
+    const auto& insert_record = deserialized_entry->records[0];
+    EXPECT_EQ(insert_record.type, LogRecordType::Insert);
+    EXPECT_EQ(insert_record.table_name, "table_a");
+    EXPECT_EQ(insert_record.row_id, (RowID{ChunkID{1}, 2u}));
+    ASSERT_EQ(insert_record.values.size(), 6u);
+    EXPECT_EQ(insert_record.values[1], AllTypeVariant{int64_t{2}});
+    EXPECT_EQ(insert_record.values[4], AllTypeVariant{"five"});
+    EXPECT_TRUE(variant_is_null(insert_record.values[5]));
+
+    const auto& delete_record = deserialized_entry->records[1];
+    EXPECT_EQ(delete_record.type, LogRecordType::Delete);
+    EXPECT_EQ(delete_record.table_name, "table_b");
+    EXPECT_TRUE(delete_record.values.empty());
+  }
+  EXPECT_EQ(offset, buffer.size());
+
+  // Incomplete or corrupted entries are not read
+  auto truncated_buffer = std::vector<char>(buffer.begin(), buffer.end() - 1);
+  offset = buffer.size() / 2;
+  EXPECT_FALSE(LogEntry::deserialize(truncated_buffer, offset));
+
+  buffer.back() ^= 1;
+  offset = buffer.size() / 2;
+  EXPECT_FALSE(LogEntry::deserialize(buffer, offset));
+}
+
+TEST_F(LoggerTest, RecoverCommittedTransactions) {
+  Logger::get().enable(_log_file_path);
+
+  _execute("INSERT INTO table_a VALUES (1, 2, 3)");
+  _execute("INSERT INTO table_a VALUES (4, 5, 6)");
+  _execute("DELETE FROM table_a WHERE a = 9");
+  _execute("UPDATE table_a SET b = 20 WHERE a = 4");
+
+  // Transactions that did not commit are not recovered
+  auto rolled_back_transaction = TransactionManager::get().new_transaction_context();
+  SQLPipelineBuilder{"INSERT INTO table_a VALUES (7, 8, 9)"}
+      .with_transaction_context(rolled_back_transaction)
+      .create_pipeline()
+      .get_result_table();
+  rolled_back_transaction->rollback();
+
+  _execute("INSERT INTO table_a VALUES (10, 11, 12)");
+
+  const auto expected_table = _execute("SELECT * FROM table_a");
+  EXPECT_EQ(expected_table->row_count(), 5u);
+
+  EXPECT_EQ(_restart(), 5u);
+  EXPECT_TABLE_EQ_UNORDERED(_execute("SELECT * FROM table_a"), expected_table);
+
+  // Logging continues after recovery, later transactions use the recovered RowIDs
+  Logger::get().enable(_log_file_path);
+  _execute("DELETE FROM table_a WHERE a = 10");
+  const auto expected_table_2 = _execute("SELECT * FROM table_a");
+
+  EXPECT_EQ(_restart(), 6u);
+  EXPECT_TABLE_EQ_UNORDERED(_execute("SELECT * FROM table_a"), expected_table_2);
+}
+
+TEST_F(LoggerTest, RecoverUpdateOfOwnInsert) {
+  Logger::get().enable(_log_file_path);
+
+  // Strings are not updated in place, so the inserted row gets a new version and the old one is invalidated
+  auto transaction_context = TransactionManager::get().new_transaction_context();
+  SQLPipelineBuilder{"INSERT INTO table_b VALUES (30, 'test30'); UPDATE table_b SET b = 'updated' WHERE a = 30"}
+      .with_transaction_context(transaction_context)
+      .create_pipeline()
+      .get_result_table();
+  transaction_context->commit();
+
+  const auto expected_table = _execute("SELECT * FROM table_b");
+  EXPECT_EQ(expected_table->row_count(), 13u);
+
+  EXPECT_EQ(_restart(), 1u);
+  EXPECT_TABLE_EQ_UNORDERED(_execute("SELECT * FROM table_b"), expected_table);
+  EXPECT_EQ(_execute("SELECT * FROM table_b WHERE a = 30")->row_count(), 1u);
+}
+
+TEST_F(LoggerTest, GroupCommit) {
+  auto options = LoggerOptions{};
+  options.group_commit_interval = std::chrono::milliseconds{50};
+  options.sync_policy = LogSyncPolicy::None;
+  Logger::get().enable(_log_file_path, options);
+
+  constexpr auto NUM_THREADS = 8;
+  std::vector<std::thread> threads;
+  for (auto thread_idx = 0; thread_idx < NUM_THREADS; ++thread_idx) {
+    threads.emplace_back([thread_idx]() {
+      _execute("INSERT INTO table_a VALUES (" + std::to_string(thread_idx) + ", 0, 0)");
+    });
+  }
+  for (auto& thread : threads) thread.join();
+
+  // All transactions were acknowledged, but written in fewer groups
+  EXPECT_EQ(_execute("SELECT * FROM table_a")->row_count(), 4u + NUM_THREADS);
+  EXPECT_LT(Logger::get().num_group_commits(), static_cast<size_t>(NUM_THREADS));
+
+  EXPECT_EQ(_restart(), static_cast<size_t>(NUM_THREADS));
+  EXPECT_EQ(_execute("SELECT * FROM table_a")->row_count(), 4u + NUM_THREADS);
+}
+
+TEST_F(LoggerTest, FailedWriteRollsBackCommits) {
+  // Every write to /dev/full fails with ENOSPC
+  Logger::get().enable("/dev/full");
+
+  EXPECT_THROW(_execute("INSERT INTO table_a VALUES (1, 2, 3)"), std::runtime_error);
+
+  // The log might end with a partial group now, so later commits are not logged behind it
+  EXPECT_THROW(_execute("INSERT INTO table_a VALUES (4, 5, 6)"), std::runtime_error);
+  EXPECT_THROW(Logger::get().flush(), std::runtime_error);
+  Logger::get().disable();
+
+  // The rows of the failed transactions are invisible, and their commit ids do not block later transactions
+  _execute("INSERT INTO table_a VALUES (7, 8, 9)");
+  EXPECT_EQ(_execute("SELECT * FROM table_a")->row_count(), 5u);
+}
+
+TEST_F(LoggerTest, DropIncompleteEntry) {
+  Logger::get().enable(_log_file_path);
+  _execute("INSERT INTO table_a VALUES (1, 2, 3)");
+  Logger::get().disable();
+
+  const auto log_file_size = filesystem::file_size(_log_file_path);
+
+  // The process crashed while writing the next group
+  {
+    auto log_file = std::ofstream{_log_file_path, std::ios::binary | std::ios::app};
+    log_file << "incomplete";
+  }
+
+  EXPECT_EQ(_restart(), 1u);
+  EXPECT_EQ(_execute("SELECT * FROM table_a")->row_count(), 5u);
+  EXPECT_EQ(filesystem::file_size(_log_file_path), log_file_size);
+}
+
+}  // namespace opossum
@@ -0,0 +1,146 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "operators/compact_chunks.hpp"
+#include "operators/delete.hpp"
+#include "operators/get_table.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/validate.hpp"
+#include "storage/base_encoded_column.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class OperatorsCompactChunksTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // Chunks: [1, 24, 234, 25], [23, 4, 2, 5], [234, 234]
+    _table = load_table("src/test/tables/10_ints.tbl", 4);
+    StorageManager::get().add_table("table_a", _table);
+  }
+
+  static std::shared_ptr<const Table> _validate(const std::shared_ptr<TransactionContext>& context) {
+    const auto get_table = std::make_shared<GetTable>("table_a");
+    get_table->execute();
+
+    const auto validate = std::make_shared<Validate>(get_table);
+    validate->set_transaction_context(context);
+    validate->execute();
+    return validate->get_output();
+  }
+
+  static std::shared_ptr<Delete> _delete(const std::shared_ptr<TransactionContext>& context,
+                                         const PredicateCondition predicate_condition, const int value) {
+    const auto get_table = std::make_shared<GetTable>("table_a");
+    get_table->execute();
+
+    const auto validate = std::make_shared<Validate>(get_table);
+    validate->set_transaction_context(context);
+    validate->execute();
+
+    const auto table_scan = std::make_shared<TableScan>(validate, ColumnID{0}, predicate_condition, value);
+    table_scan->execute();
+
+    const auto delete_op = std::make_shared<Delete>("table_a", table_scan);
+    delete_op->set_transaction_context(context);
+    delete_op->execute();
+    return delete_op;
+  }
+
+  static std::shared_ptr<CompactChunks> _compact(const std::shared_ptr<TransactionContext>& context,
+                                                 const std::vector<ChunkID>& chunk_ids) {
+    const auto compact_chunks = std::make_shared<CompactChunks>("table_a", chunk_ids);
+    compact_chunks->set_transaction_context(context);
+    compact_chunks->execute();
+    return compact_chunks;
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(OperatorsCompactChunksTest, MovesVisibleRows) {
+  ChunkEncoder::encode_chunks(_table, {ChunkID{0}, ChunkID{1}}, {EncodingType::RunLength});
+  _table->get_chunk(ChunkID{0})->populate_art_index(ColumnID{0});
+
+  const auto delete_context = TransactionManager::get().new_transaction_context();
+  _delete(delete_context, PredicateCondition::LessThan, 24);
+  delete_context->commit();
+
+  const auto old_context = TransactionManager::get().new_transaction_context();
+  const auto expected_table = _validate(old_context);
+  EXPECT_EQ(expected_table->row_count(), 5u);
+
+  const auto context = TransactionManager::get().new_transaction_context();
+  const auto compact_chunks = _compact(context, {ChunkID{0}, ChunkID{1}});
+  ASSERT_FALSE(compact_chunks->execute_failed());
+  context->commit();
+
+  // All rows of the second chunk have been deleted, so only three rows are moved
+  ASSERT_EQ(compact_chunks->compacted_chunk_id(), ChunkID{3});
+  const auto chunk = _table->get_chunk(ChunkID{3});
+  EXPECT_EQ(chunk->size(), 3u);
+
+  const auto encoded_column = std::dynamic_pointer_cast<const BaseEncodedColumn>(chunk->get_column(ColumnID{0}));
+  ASSERT_NE(encoded_column, nullptr);
+  EXPECT_EQ(encoded_column->encoding_type(), EncodingType::RunLength);
+  EXPECT_NE(chunk->statistics(), nullptr);
+  EXPECT_NE(chunk->get_art_index(ColumnID{0}), nullptr);
+
+  // Transactions that started before the compaction see the old rows, all others see the new ones
+  EXPECT_TABLE_EQ_UNORDERED(_validate(old_context), expected_table);
+  EXPECT_TABLE_EQ_UNORDERED(_validate(TransactionManager::get().new_transaction_context()), expected_table);
+
+  const auto old_mvcc_columns = _table->get_chunk(ChunkID{0})->mvcc_columns();
+  for (const auto end_cid : old_mvcc_columns->end_cids) {
+    EXPECT_LE(end_cid, context->commit_id());
+  }
+}
+
+TEST_F(OperatorsCompactChunksTest, FailsOnConcurrentModification) {
+  // Locks the last row of the first chunk
+  const auto delete_context = TransactionManager::get().new_transaction_context();
+  _delete(delete_context, PredicateCondition::Equals, 25);
+
+  const auto context = TransactionManager::get().new_transaction_context();
+  const auto compact_chunks = _compact(context, {ChunkID{0}});
+  EXPECT_TRUE(compact_chunks->execute_failed());
+  context->rollback();
+
+  // The rows that had been locked before the conflict was detected are unlocked again
+  const auto mvcc_columns = _table->get_chunk(ChunkID{0})->mvcc_columns();
+  EXPECT_EQ(mvcc_columns->tids[0], 0u);
+  EXPECT_EQ(mvcc_columns->tids[1], 0u);
+  EXPECT_EQ(mvcc_columns->tids[2], 0u);
+  EXPECT_EQ(mvcc_columns->tids[3], delete_context->transaction_id());
+  EXPECT_EQ(_table->chunk_count(), 3u);
+
+  delete_context->commit();
+  EXPECT_EQ(_validate(TransactionManager::get().new_transaction_context())->row_count(), 9u);
+}
+
+TEST_F(OperatorsCompactChunksTest, Rollback) {
+  const auto expected_table = load_table("src/test/tables/10_ints.tbl");
+
+  const auto context = TransactionManager::get().new_transaction_context();
+  const auto compact_chunks = _compact(context, {ChunkID{0}});
+  ASSERT_FALSE(compact_chunks->execute_failed());
+  context->rollback();
+
+  // The new chunk is invisible for everyone and the old rows can be modified again
+  EXPECT_EQ(_table->chunk_count(), 4u);
+  EXPECT_TABLE_EQ_UNORDERED(_validate(TransactionManager::get().new_transaction_context()), expected_table);
+
+  const auto delete_context = TransactionManager::get().new_transaction_context();
+  EXPECT_FALSE(_delete(delete_context, PredicateCondition::LessThan, 24)->execute_failed());
+  delete_context->commit();
+}
+
+}  // namespace opossum
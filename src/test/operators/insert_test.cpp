@@ -1,5 +1,6 @@
 #include <memory>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "../base_test.hpp"
@@ -257,4 +258,49 @@ TEST_F(OperatorsInsertTest, InsertSingleNullFromDummyProjection) {
   EXPECT_TRUE(variant_is_null(null_val));
 }
 
+TEST_F(OperatorsInsertTest, ConcurrentInserts) {
+  // 3 Rows each
+  StorageManager::get().add_table("source", load_table("src/test/tables/int.tbl", 2u));
+  auto t = load_table("src/test/tables/int.tbl", 5u);
+  StorageManager::get().add_table("target", t);
+
+  constexpr auto num_threads = 8u;
+  constexpr auto num_inserts_per_thread = 20u;
+
+  auto threads = std::vector<std::thread>{};
+  for (auto thread_id = 0u; thread_id < num_threads; ++thread_id) {
+    threads.emplace_back([&]() {
+      for (auto insert_id = 0u; insert_id < num_inserts_per_thread; ++insert_id) {
+        auto gt = std::make_shared<GetTable>("source");
+        gt->execute();
+
+        auto ins = std::make_shared<Insert>("target", gt);
+        auto context = TransactionManager::get().new_transaction_context();
+        ins->set_transaction_context(context);
+        ins->execute();
+        context->commit();
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+
+  const auto expected_row_count = 3u + num_threads * num_inserts_per_thread * 3u;
+  EXPECT_EQ(t->row_count(), expected_row_count);
+
+  // Reserved rows never exceed the chunk size and no row is left uncommitted
+  for (auto chunk_id = ChunkID{0}; chunk_id < t->chunk_count(); ++chunk_id) {
+    const auto chunk = t->get_chunk(chunk_id);
+    EXPECT_LE(chunk->size(), 5u);
+    EXPECT_EQ(chunk->mvcc_columns()->size(), chunk->size());
+    EXPECT_FALSE(chunk->mvcc_columns()->has_uncommitted_rows());
+  }
+
+  auto gt = std::make_shared<GetTable>("target");
+  gt->execute();
+  auto validate = std::make_shared<Validate>(gt);
+  validate->set_transaction_context(TransactionManager::get().new_transaction_context());
+  validate->execute();
+  EXPECT_EQ(validate->get_output()->row_count(), expected_row_count);
+}
+
 }  // namespace opossum
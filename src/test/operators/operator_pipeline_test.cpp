@@ -0,0 +1,170 @@
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_context.hpp"
+#include "operators/limit.hpp"
+#include "operators/operator_pipeline.hpp"
+#include "operators/pqp_expression.hpp"
+#include "operators/projection.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/validate.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/topology.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class OperatorPipelineTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    auto table = load_table("src/test/tables/sqlite/mixed_types_null_100.tbl", 10);
+
+    // Every row but the first one of each chunk is visible
+    for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      auto mvcc_columns = table->get_chunk(chunk_id)->mvcc_columns();
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < table->get_chunk(chunk_id)->size(); ++chunk_offset) {
+        mvcc_columns->begin_cids[chunk_offset] = 0u;
+        mvcc_columns->end_cids[chunk_offset] = chunk_offset == 0 ? CommitID{0} : MvccColumns::MAX_COMMIT_ID;
+      }
+      mvcc_columns->update_summary();
+    }
+
+    ChunkEncoder::encode_chunks(table, {ChunkID{1}, ChunkID{3}});
+
+    _table_wrapper = std::make_shared<TableWrapper>(std::move(table));
+    _table_wrapper->execute();
+
+    _transaction_context = std::make_shared<TransactionContext>(1u, 1u);
+  }
+
+  // Executes the operators one after another and, after recreating them, as a pipeline. Returns both outputs.
+  std::pair<std::shared_ptr<const Table>, std::shared_ptr<const Table>> execute_with_and_without_pipeline(
+      const std::vector<std::shared_ptr<AbstractOperator>>& operators) {
+    for (const auto& op : operators) {
+      op->set_transaction_context(_transaction_context);
+      op->execute();
+    }
+
+    const auto sink = operators.back()->recreate();
+    sink->set_transaction_context_recursively(_transaction_context);
+
+    auto pipelined_operators = std::vector<std::shared_ptr<AbstractOperator>>{sink};
+    while (pipelined_operators.size() < operators.size()) {
+      pipelined_operators.insert(pipelined_operators.begin(), pipelined_operators.front()->mutable_input_left());
+    }
+    pipelined_operators.front()->mutable_input_left()->execute();
+
+    OperatorPipeline pipeline{pipelined_operators};
+    pipeline.execute();
+
+    return {operators.back()->get_output(), sink->get_output()};
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper;
+  std::shared_ptr<TransactionContext> _transaction_context;
+};
+
+TEST_F(OperatorPipelineTest, ScanValidateProject) {
+  const auto validate = std::make_shared<Validate>(_table_wrapper);
+  const auto scan_a = std::make_shared<TableScan>(validate, ColumnID{1}, PredicateCondition::GreaterThan, 20);
+  const auto scan_b =
+      std::make_shared<TableScan>(scan_a, ColumnID{3}, PredicateCondition::NotLike, std::string{"%a%"});
+  const auto projection = std::make_shared<Projection>(
+      scan_b, Projection::ColumnExpressions{PQPExpression::create_column(ColumnID{3}),
+                                            PQPExpression::create_binary_operator(
+                                                ExpressionType::Addition, PQPExpression::create_column(ColumnID{1}),
+                                                PQPExpression::create_column(ColumnID{1}))});
+
+  const auto [expected, actual] = execute_with_and_without_pipeline({validate, scan_a, scan_b, projection});
+
+  EXPECT_GT(expected->row_count(), 0u);
+  EXPECT_TABLE_EQ_ORDERED(actual, expected);
+}
+
+TEST_F(OperatorPipelineTest, ProjectionIsOnlySink) {
+  // The scan would reference the table of a single morsel in each of its output chunks
+  const auto b_plus_five = PQPExpression::create_binary_operator(
+      ExpressionType::Addition, PQPExpression::create_column(ColumnID{1}), PQPExpression::create_literal(5));
+  const auto projection = std::make_shared<Projection>(
+      _table_wrapper, Projection::ColumnExpressions{b_plus_five, PQPExpression::create_column(ColumnID{0})});
+  const auto scan = std::make_shared<TableScan>(projection, ColumnID{0}, PredicateCondition::LessThan, 40);
+
+  EXPECT_THROW(OperatorPipeline({projection, scan}), std::logic_error);
+}
+
+TEST_F(OperatorPipelineTest, Limit) {
+  for (const auto num_rows : {size_t{0}, size_t{3}, size_t{17}, size_t{1000}}) {
+    const auto scan =
+        std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, PredicateCondition::NotEquals, std::string{"a"});
+    const auto limit = std::make_shared<Limit>(scan, num_rows);
+
+    const auto [expected, actual] = execute_with_and_without_pipeline({scan, limit});
+
+    EXPECT_TABLE_EQ_ORDERED(actual, expected);
+  }
+}
+
+TEST_F(OperatorPipelineTest, LimitWithScheduler) {
+  // The morsels are scanned concurrently, but the Limit still gets them in the order of the input
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(Topology::create_fake_numa_topology(4, 2)));
+
+  for (const auto num_rows : {size_t{0}, size_t{3}, size_t{17}, size_t{1000}}) {
+    const auto scan_a =
+        std::make_shared<TableScan>(_table_wrapper, ColumnID{3}, PredicateCondition::Like, std::string{"%a%"});
+    const auto scan_b = std::make_shared<TableScan>(scan_a, ColumnID{1}, PredicateCondition::IsNotNull, 0);
+    const auto limit = std::make_shared<Limit>(scan_b, num_rows);
+    const auto validate = std::make_shared<Validate>(limit);
+
+    const auto [expected, actual] = execute_with_and_without_pipeline({scan_a, scan_b, limit, validate});
+
+    EXPECT_TABLE_EQ_ORDERED(actual, expected);
+  }
+
+  CurrentScheduler::get()->finish();
+}
+
+TEST_F(OperatorPipelineTest, RethrowsExceptionOfMorsel) {
+  // The exception is thrown in a job on a Worker, but has to reach the caller
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(Topology::create_fake_numa_topology(4, 2)));
+
+  const auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{1}, PredicateCondition::IsNotNull, 0);
+  const auto projection = std::make_shared<Projection>(
+      scan, Projection::ColumnExpressions{PQPExpression::create_binary_operator(
+                ExpressionType::Division, PQPExpression::create_column(ColumnID{1}), PQPExpression::create_literal(0))});
+
+  OperatorPipeline pipeline{{scan, projection}};
+  EXPECT_THROW(pipeline.execute(), std::runtime_error);
+
+  CurrentScheduler::get()->finish();
+}
+
+TEST_F(OperatorPipelineTest, OnlySinkHasOutput) {
+  const auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{1}, PredicateCondition::IsNotNull, 0);
+  const auto validate = std::make_shared<Validate>(scan);
+  validate->set_transaction_context(_transaction_context);
+
+  OperatorPipeline pipeline{{scan, validate}};
+  pipeline.execute();
+
+  EXPECT_EQ(scan->get_output(), nullptr);
+  ASSERT_NE(validate->get_output(), nullptr);
+  EXPECT_GT(validate->get_output()->row_count(), 0u);
+}
+
+TEST_F(OperatorPipelineTest, RejectsNonChain) {
+  const auto scan_a = std::make_shared<TableScan>(_table_wrapper, ColumnID{1}, PredicateCondition::IsNotNull, 0);
+  const auto scan_b = std::make_shared<TableScan>(_table_wrapper, ColumnID{1}, PredicateCondition::IsNull, 0);
+
+  EXPECT_THROW(OperatorPipeline({scan_a, scan_b}), std::logic_error);
+}
+
+}  // namespace opossum
@@ -12,6 +12,9 @@
 #include "operators/projection.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/topology.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
@@ -226,6 +229,26 @@ TEST_F(OperatorsProjectionTest, DivisionByZero) {
   EXPECT_THROW(projection_literal->execute(), std::runtime_error);
 }
 
+TEST_F(OperatorsProjectionTest, DivisionByZeroWithScheduler) {
+  // The exception is thrown in a job on a Worker, but has to reach the caller
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(Topology::create_fake_numa_topology(4, 2)));
+
+  auto projection = std::make_shared<Projection>(_table_wrapper_int_zero, _div_a_b_expr);
+  EXPECT_THROW(projection->execute(), std::runtime_error);
+
+  CurrentScheduler::get()->finish();
+}
+
+TEST_F(OperatorsProjectionTest, DivisionByNull) {
+  // NULL divisors do not cause a division by zero, the result is NULL instead
+  std::shared_ptr<Table> expected_result = load_table("src/test/tables/int_int_int_division_null.tbl", 2);
+
+  auto projection = std::make_shared<Projection>(_table_wrapper_int_null, _div_a_b_expr);
+  projection->execute();
+
+  EXPECT_TABLE_EQ_UNORDERED(projection->get_output(), expected_result);
+}
+
 TEST_F(OperatorsProjectionTest, AddNull) {
   std::shared_ptr<Table> expected_result = load_table("src/test/tables/string_concatenated_null.tbl", 2);
 
@@ -14,6 +14,7 @@
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
+#include "utils/filesystem.hpp"
 
 namespace opossum {
 
@@ -214,4 +215,60 @@ TEST_P(OperatorsSortTest, DescendingSortOfOneDictColumn) {
   EXPECT_TABLE_EQ_ORDERED(sort->get_output(), expected_result);
 }
 
+TEST_P(OperatorsSortTest, ExternalSortMatchesInMemorySort) {
+  auto table_wrapper =
+      std::make_shared<TableWrapper>(load_table("src/test/tables/sqlite/mixed_types_null_100.tbl", 10));
+  table_wrapper->execute();
+
+  for (ColumnID column_id{0}; column_id < table_wrapper->get_output()->column_count(); ++column_id) {
+    for (const auto order_by_mode : {OrderByMode::Ascending, OrderByMode::Descending, OrderByMode::AscendingNullsLast,
+                                     OrderByMode::DescendingNullsLast}) {
+      auto in_memory_sort = std::make_shared<Sort>(table_wrapper, column_id, order_by_mode, 7u);
+      in_memory_sort->execute();
+
+      // A budget of 256 bytes forces the Sort to spill a run every few rows
+      auto external_sort = std::make_shared<Sort>(table_wrapper, column_id, order_by_mode, 7u, 256u);
+      external_sort->execute();
+
+      EXPECT_TABLE_EQ_ORDERED(external_sort->get_output(), in_memory_sort->get_output());
+      EXPECT_EQ(external_sort->get_output()->max_chunk_size(), 7u);
+      EXPECT_EQ(external_sort->get_output()->chunk_count(), 15u);
+    }
+  }
+}
+
+TEST_P(OperatorsSortTest, ExternalSortRemovesRuns) {
+  const auto spill_directory = filesystem::temp_directory_path() / "hyrise_sort_test_runs";
+  filesystem::create_directory(spill_directory);
+
+  auto sort =
+      std::make_shared<Sort>(_table_wrapper, ColumnID{0}, OrderByMode::Descending, 2u, 1u, spill_directory.string());
+  sort->execute();
+
+  EXPECT_TABLE_EQ_ORDERED(sort->get_output(), load_table("src/test/tables/int_float_reverse.tbl", 2));
+  EXPECT_TRUE(filesystem::is_empty(spill_directory));
+
+  filesystem::remove_all(spill_directory);
+}
+
+TEST_P(OperatorsSortTest, ExternalSortSpillsNullRows) {
+  const auto spill_directory = filesystem::temp_directory_path() / "hyrise_sort_test_null_runs";
+  filesystem::create_directory(spill_directory);
+
+  for (const auto order_by_mode : {OrderByMode::Ascending, OrderByMode::AscendingNullsLast}) {
+    auto in_memory_sort = std::make_shared<Sort>(_table_wrapper_null, ColumnID{0}, order_by_mode, 2u);
+    in_memory_sort->execute();
+
+    // NULL rows count towards the budget as well, so every row is spilled
+    auto external_sort =
+        std::make_shared<Sort>(_table_wrapper_null, ColumnID{0}, order_by_mode, 2u, 1u, spill_directory.string());
+    external_sort->execute();
+
+    EXPECT_TABLE_EQ_ORDERED(external_sort->get_output(), in_memory_sort->get_output());
+    EXPECT_TRUE(filesystem::is_empty(spill_directory));
+  }
+
+  filesystem::remove_all(spill_directory);
+}
+
 }  // namespace opossum
@@ -0,0 +1,85 @@
+#include <memory>
+#include <utility>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/limit.hpp"
+#include "operators/sort.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/top_n.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class OperatorsTopNTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table_wrapper = std::make_shared<TableWrapper>(load_table("src/test/tables/sqlite/mixed_types_null_100.tbl", 10));
+    _table_wrapper->execute();
+
+    auto table_dict = load_table("src/test/tables/sqlite/mixed_types_null_100.tbl", 10);
+    ChunkEncoder::encode_all_chunks(table_dict);
+    _table_wrapper_dict = std::make_shared<TableWrapper>(std::move(table_dict));
+    _table_wrapper_dict->execute();
+  }
+
+  // TopN has to return exactly what Sort followed by Limit returns
+  void test_against_sort_and_limit(const std::shared_ptr<const AbstractOperator>& input) {
+    for (ColumnID column_id{0}; column_id < input->get_output()->column_count(); ++column_id) {
+      for (const auto order_by_mode : {OrderByMode::Ascending, OrderByMode::Descending,
+                                       OrderByMode::AscendingNullsLast, OrderByMode::DescendingNullsLast}) {
+        for (const auto num_rows : {size_t{0}, size_t{1}, size_t{7}, size_t{25}, size_t{200}}) {
+          auto sort = std::make_shared<Sort>(input, column_id, order_by_mode);
+          sort->execute();
+          auto limit = std::make_shared<Limit>(sort, num_rows);
+          limit->execute();
+
+          auto top_n = std::make_shared<TopN>(input, column_id, order_by_mode, num_rows, 4u);
+          top_n->execute();
+
+          EXPECT_TABLE_EQ_ORDERED(top_n->get_output(), limit->get_output());
+        }
+      }
+    }
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper, _table_wrapper_dict;
+};
+
+TEST_F(OperatorsTopNTest, ValueColumns) { test_against_sort_and_limit(_table_wrapper); }
+
+TEST_F(OperatorsTopNTest, EncodedColumnsWithStatistics) { test_against_sort_and_limit(_table_wrapper_dict); }
+
+TEST_F(OperatorsTopNTest, ReferenceColumns) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper_dict, ColumnID{1}, PredicateCondition::GreaterThan, 20);
+  scan->execute();
+
+  test_against_sort_and_limit(scan);
+}
+
+TEST_F(OperatorsTopNTest, EmptyInput) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{1}, PredicateCondition::LessThan, -1);
+  scan->execute();
+
+  auto top_n = std::make_shared<TopN>(scan, ColumnID{0}, OrderByMode::Ascending, 10u);
+  top_n->execute();
+
+  EXPECT_EQ(top_n->get_output()->row_count(), 0u);
+  EXPECT_EQ(top_n->get_output()->column_count(), 4u);
+}
+
+TEST_F(OperatorsTopNTest, Recreate) {
+  auto top_n = std::make_shared<TopN>(_table_wrapper, ColumnID{1}, OrderByMode::DescendingNullsLast, 3u);
+  const auto recreated = std::dynamic_pointer_cast<TopN>(top_n->recreate());
+
+  ASSERT_TRUE(recreated);
+  EXPECT_EQ(recreated->column_id(), ColumnID{1});
+  EXPECT_EQ(recreated->order_by_mode(), OrderByMode::DescendingNullsLast);
+  EXPECT_EQ(recreated->num_rows(), 3u);
+}
+
+}  // namespace opossum
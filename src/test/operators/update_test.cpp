@@ -7,9 +7,11 @@
 
 #include "concurrency/transaction_manager.hpp"
 #include "operators/get_table.hpp"
+#include "operators/insert.hpp"
 #include "operators/pqp_expression.hpp"
 #include "operators/projection.hpp"
 #include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
 #include "operators/update.hpp"
 #include "operators/validate.hpp"
 #include "statistics/table_statistics.hpp"
@@ -170,4 +172,100 @@ TEST_F(OperatorsUpdateTest, MissingChunks) {
   // MVCC commit.
   t_context->commit();
 }
+
+TEST_F(OperatorsUpdateTest, RepeatedUpdateInTransaction) {
+  auto t_context = TransactionManager::get().new_transaction_context();
+
+  const auto update_row = [&](const int32_t new_value) {
+    auto gt = std::make_shared<GetTable>(_table_name);
+    auto validate = std::make_shared<Validate>(gt);
+    auto table_scan = std::make_shared<TableScan>(validate, ColumnID{0}, PredicateCondition::Equals, 123);
+    auto fields_to_update = std::make_shared<Projection>(
+        table_scan, Projection::ColumnExpressions({PQPExpression::create_column(ColumnID{1})}));
+    auto update_values = std::make_shared<Projection>(
+        table_scan, Projection::ColumnExpressions({PQPExpression::create_literal(new_value, {"b"})}));
+    auto update = std::make_shared<Update>(_table_name, fields_to_update, update_values);
+
+    for (const auto& op : std::vector<std::shared_ptr<AbstractOperator>>{gt, validate, table_scan, fields_to_update,
+                                                                         update_values, update}) {
+      op->set_transaction_context(t_context);
+      op->execute();
+    }
+    EXPECT_FALSE(update->execute_failed());
+  };
+
+  // The first update creates a new version of the row, which is updated in place by the second one
+  update_row(10);
+  EXPECT_EQ(StorageManager::get().get_table(_table_name)->row_count(), 4u);
+  update_row(20);
+  EXPECT_EQ(StorageManager::get().get_table(_table_name)->row_count(), 4u);
+
+  t_context->commit();
+
+  auto expected_result = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int}, {"b", DataType::Int}},
+                                                 TableType::Data);
+  expected_result->append({12345, 1});
+  expected_result->append({123, 20});
+  expected_result->append({1234, 3});
+
+  t_context = TransactionManager::get().new_transaction_context();
+  auto gt = std::make_shared<GetTable>(_table_name);
+  gt->execute();
+  auto validate = std::make_shared<Validate>(gt);
+  validate->set_transaction_context(t_context);
+  validate->execute();
+
+  EXPECT_TABLE_EQ_UNORDERED(validate->get_output(), expected_result);
+}
+
+TEST_F(OperatorsUpdateTest, UpdateOwnInsertWithNewVersion) {
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int}, {"b", DataType::String}};
+  StorageManager::get().add_table(
+      "stringTable", std::make_shared<Table>(column_definitions, TableType::Data, Chunk::MAX_SIZE, UseMvcc::Yes));
+
+  auto t_context = TransactionManager::get().new_transaction_context();
+
+  auto values_to_insert = std::make_shared<Table>(column_definitions, TableType::Data);
+  values_to_insert->append({1, "one"});
+  values_to_insert->append({2, "two"});
+  auto table_wrapper = std::make_shared<TableWrapper>(values_to_insert);
+  table_wrapper->execute();
+  auto insert = std::make_shared<Insert>("stringTable", table_wrapper);
+  insert->set_transaction_context(t_context);
+  insert->execute();
+
+  // String columns cannot be updated in place, so the inserted row gets a new version, although Delete cannot lock it
+  auto gt = std::make_shared<GetTable>("stringTable");
+  auto validate = std::make_shared<Validate>(gt);
+  auto table_scan = std::make_shared<TableScan>(validate, ColumnID{0}, PredicateCondition::Equals, 2);
+  auto fields_to_update = std::make_shared<Projection>(
+      table_scan, Projection::ColumnExpressions({PQPExpression::create_column(ColumnID{1})}));
+  auto update_values = std::make_shared<Projection>(
+      table_scan, Projection::ColumnExpressions({PQPExpression::create_literal(std::string{"zwei"}, {"b"})}));
+  auto update = std::make_shared<Update>("stringTable", fields_to_update, update_values);
+
+  for (const auto& op : std::vector<std::shared_ptr<AbstractOperator>>{gt, validate, table_scan, fields_to_update,
+                                                                       update_values, update}) {
+    op->set_transaction_context(t_context);
+    op->execute();
+  }
+  EXPECT_FALSE(update->execute_failed());
+  EXPECT_EQ(StorageManager::get().get_table("stringTable")->row_count(), 3u);
+
+  t_context->commit();
+
+  auto expected_result = std::make_shared<Table>(column_definitions, TableType::Data);
+  expected_result->append({1, "one"});
+  expected_result->append({2, "zwei"});
+
+  t_context = TransactionManager::get().new_transaction_context();
+  gt = std::make_shared<GetTable>("stringTable");
+  gt->execute();
+  validate = std::make_shared<Validate>(gt);
+  validate->set_transaction_context(t_context);
+  validate->execute();
+
+  EXPECT_TABLE_EQ_UNORDERED(validate->get_output(), expected_result);
+}
+
 }  // namespace opossum
@@ -7,11 +7,19 @@
 #include "gtest/gtest.h"
 
 #include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
 #include "operators/abstract_read_only_operator.hpp"
+#include "operators/delete.hpp"
+#include "operators/get_table.hpp"
 #include "operators/print.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
 #include "operators/validate.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/operator_task.hpp"
+#include "scheduler/topology.hpp"
+#include "storage/chunk_encoder.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
@@ -45,11 +53,14 @@ void OperatorsValidateTest::set_all_records_visible(Table& table) {
       mvcc_columns->begin_cids[i] = 0u;
       mvcc_columns->end_cids[i] = MvccColumns::MAX_COMMIT_ID;
     }
+    mvcc_columns->update_summary();
   }
 }
 
 void OperatorsValidateTest::set_record_invisible_for(Table& table, RowID row, CommitID end_cid) {
-  table.get_chunk(row.chunk_id)->mvcc_columns()->end_cids[row.chunk_offset] = end_cid;
+  auto mvcc_columns = table.get_chunk(row.chunk_id)->mvcc_columns();
+  mvcc_columns->end_cids[row.chunk_offset] = end_cid;
+  mvcc_columns->update_summary();
 }
 
 TEST_F(OperatorsValidateTest, SimpleValidate) {
@@ -80,4 +91,158 @@ TEST_F(OperatorsValidateTest, ScanValidate) {
   EXPECT_TABLE_EQ_UNORDERED(validate->get_output(), expected_result);
 }
 
+TEST_F(OperatorsValidateTest, ParallelValidate) {
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(Topology::create_fake_numa_topology(8, 4)));
+
+  auto context = std::make_shared<TransactionContext>(1u, 3u);
+
+  std::shared_ptr<Table> expected_result = load_table("src/test/tables/validate_output_validated.tbl", 2u);
+
+  auto validate = std::make_shared<Validate>(_table_wrapper);
+  validate->set_transaction_context(context);
+
+  auto task = std::make_shared<OperatorTask>(validate);
+  task->schedule();
+  CurrentScheduler::get()->finish();
+
+  // Chunks are validated by parallel jobs, but the output keeps the order of the input
+  EXPECT_TABLE_EQ_ORDERED(validate->get_output(), expected_result);
+  CurrentScheduler::set(nullptr);
+}
+
+TEST_F(OperatorsValidateTest, MvccSummary) {
+  const auto table = _table_wrapper->get_output();
+
+  // Only the first row of the second chunk has been deleted, with commit id 2
+  const auto first_mvcc_columns = table->get_chunk(ChunkID{0})->mvcc_columns();
+  EXPECT_FALSE(first_mvcc_columns->has_deletes());
+  EXPECT_TRUE(first_mvcc_columns->is_fully_visible(0u));
+  EXPECT_TRUE(first_mvcc_columns->is_fully_visible(3u));
+
+  const auto second_mvcc_columns = table->get_chunk(ChunkID{1})->mvcc_columns();
+  EXPECT_TRUE(second_mvcc_columns->has_deletes());
+  EXPECT_EQ(second_mvcc_columns->min_end_cid(), 2u);
+  EXPECT_TRUE(second_mvcc_columns->is_fully_visible(1u));
+  EXPECT_FALSE(second_mvcc_columns->is_fully_visible(2u));
+}
+
+TEST_F(OperatorsValidateTest, OwnDeleteInFullyVisibleChunk) {
+  const auto table = load_table("src/test/tables/validate_input.tbl", 2u);
+  StorageManager::get().add_table("validate_input", table);
+
+  const auto context = TransactionManager::get().new_transaction_context();
+  EXPECT_TRUE(table->get_chunk(ChunkID{0})->mvcc_columns()->is_fully_visible(context->snapshot_commit_id()));
+
+  const auto get_table = std::make_shared<GetTable>("validate_input");
+  get_table->execute();
+  const auto validate = std::make_shared<Validate>(get_table);
+  validate->set_transaction_context(context);
+  validate->execute();
+  const auto table_scan = std::make_shared<TableScan>(validate, ColumnID{0}, PredicateCondition::Equals, 1);
+  table_scan->execute();
+  const auto delete_op = std::make_shared<Delete>("validate_input", table_scan);
+  delete_op->set_transaction_context(context);
+  delete_op->execute();
+  ASSERT_FALSE(delete_op->execute_failed());
+
+  // The locked rows are still visible to other transactions, but not to the deleting transaction itself
+  EXPECT_FALSE(table->get_chunk(ChunkID{0})->mvcc_columns()->is_fully_visible(context->snapshot_commit_id()));
+
+  const auto other_context = TransactionManager::get().new_transaction_context();
+  const auto other_validate = std::make_shared<Validate>(get_table);
+  other_validate->set_transaction_context(other_context);
+  other_validate->execute();
+  EXPECT_EQ(other_validate->get_output()->row_count(), table->row_count());
+
+  const auto own_validate = std::make_shared<Validate>(get_table);
+  own_validate->set_transaction_context(context);
+  own_validate->execute();
+  EXPECT_EQ(own_validate->get_output()->row_count(), table->row_count() - table_scan->get_output()->row_count());
+
+  context->commit();
+  const auto mvcc_columns = table->get_chunk(ChunkID{0})->mvcc_columns();
+  EXPECT_TRUE(mvcc_columns->has_deletes());
+  EXPECT_FALSE(mvcc_columns->is_fully_visible(context->commit_id()));
+  EXPECT_TRUE(mvcc_columns->is_fully_visible(context->snapshot_commit_id()));
+}
+
+TEST_F(OperatorsValidateTest, ContiguousMvccColumns) {
+  const auto table = load_table("src/test/tables/validate_input.tbl", 2u);
+  ChunkEncoder::encode_all_chunks(table);
+  StorageManager::get().add_table("validate_input", table);
+  EXPECT_TRUE(table->get_chunk(ChunkID{0})->mvcc_columns()->is_contiguous());
+
+  const auto get_table = std::make_shared<GetTable>("validate_input");
+  get_table->execute();
+
+  const auto validated_row_count = [&](const std::shared_ptr<TransactionContext>& context) {
+    const auto validate = std::make_shared<Validate>(get_table);
+    validate->set_transaction_context(context);
+    validate->execute();
+    return validate->get_output()->row_count();
+  };
+
+  const auto old_context = TransactionManager::get().new_transaction_context();
+
+  const auto context = TransactionManager::get().new_transaction_context();
+  const auto validate = std::make_shared<Validate>(get_table);
+  validate->set_transaction_context(context);
+  validate->execute();
+  const auto table_scan = std::make_shared<TableScan>(validate, ColumnID{0}, PredicateCondition::LessThan, 5);
+  table_scan->execute();
+  const auto delete_op = std::make_shared<Delete>("validate_input", table_scan);
+  delete_op->set_transaction_context(context);
+  delete_op->execute();
+  ASSERT_FALSE(delete_op->execute_failed());
+
+  const auto deleted_row_count = table_scan->get_output()->row_count();
+  EXPECT_EQ(validated_row_count(context), table->row_count() - deleted_row_count);
+  context->commit();
+
+  EXPECT_EQ(validated_row_count(TransactionManager::get().new_transaction_context()),
+            table->row_count() - deleted_row_count);
+  EXPECT_EQ(validated_row_count(old_context), table->row_count());
+}
+
+TEST_F(OperatorsValidateTest, ReadOnlyTransaction) {
+  for (const auto encode : {false, true}) {
+    StorageManager::reset();
+    const auto table = load_table("src/test/tables/validate_input.tbl", 2u);
+    if (encode) ChunkEncoder::encode_all_chunks(table);
+    StorageManager::get().add_table("validate_input", table);
+
+    const auto get_table = std::make_shared<GetTable>("validate_input");
+    get_table->execute();
+
+    const auto validated_row_count = [&](const std::shared_ptr<TransactionContext>& context) {
+      const auto validate = std::make_shared<Validate>(get_table);
+      validate->set_transaction_context(context);
+      validate->execute();
+      return validate->get_output()->row_count();
+    };
+
+    const auto context = TransactionManager::get().new_transaction_context();
+    const auto validate = std::make_shared<Validate>(get_table);
+    validate->set_transaction_context(context);
+    validate->execute();
+    const auto table_scan = std::make_shared<TableScan>(validate, ColumnID{0}, PredicateCondition::LessThan, 5);
+    table_scan->execute();
+    const auto delete_op = std::make_shared<Delete>("validate_input", table_scan);
+    delete_op->set_transaction_context(context);
+    delete_op->execute();
+    ASSERT_FALSE(delete_op->execute_failed());
+
+    // Rows locked by another transaction are still visible
+    const auto read_only_context = TransactionManager::get().new_read_only_transaction_context();
+    EXPECT_EQ(validated_row_count(read_only_context), table->row_count());
+
+    context->commit();
+
+    const auto deleted_row_count = table_scan->get_output()->row_count();
+    EXPECT_EQ(validated_row_count(TransactionManager::get().new_read_only_transaction_context()),
+              table->row_count() - deleted_row_count);
+    EXPECT_EQ(validated_row_count(read_only_context), table->row_count());
+  }
+}
+
 }  // namespace opossum
@@ -30,6 +30,7 @@
 #include "operators/projection.hpp"
 #include "operators/sort.hpp"
 #include "operators/table_scan.hpp"
+#include "operators/top_n.hpp"
 #include "operators/union_positions.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/index/group_key/group_key_index.hpp"
@@ -257,6 +258,12 @@ TEST_F(LQPTranslatorTest, SortNode) {
   ASSERT_TRUE(sort_op);
   EXPECT_EQ(sort_op->column_id(), ColumnID{0});
   EXPECT_EQ(sort_op->order_by_mode(), OrderByMode::Ascending);
+  EXPECT_EQ(sort_op->memory_budget(), std::nullopt);
+
+  // The memory budget of the translator is passed on to the Sort
+  const auto budgeted_sort_op = std::dynamic_pointer_cast<Sort>(LQPTranslator{1024u}.translate_node(sort_node));
+  ASSERT_TRUE(budgeted_sort_op);
+  EXPECT_EQ(budgeted_sort_op->memory_budget(), 1024u);
 }
 
 TEST_F(LQPTranslatorTest, JoinNode) {
@@ -469,6 +476,34 @@ TEST_F(LQPTranslatorTest, LimitNode) {
   EXPECT_EQ(limit_op->num_rows(), num_rows);
 }
 
+TEST_F(LQPTranslatorTest, LimitNodeOnSortNode) {
+  /**
+   * Build LQP and translate to PQP
+   */
+  const auto stored_table_node = StoredTableNode::make("table_int_float");
+  auto sort_node = SortNode::make(
+      std::vector<OrderByDefinition>{{LQPColumnReference(stored_table_node, ColumnID{1}), OrderByMode::Descending}});
+  sort_node->set_left_input(stored_table_node);
+
+  const auto num_rows = 2u;
+  auto limit_node = LimitNode::make(num_rows);
+  limit_node->set_left_input(sort_node);
+
+  /**
+   * Check PQP
+   */
+  const auto op = LQPTranslator{}.translate_node(limit_node);
+  const auto top_n_op = std::dynamic_pointer_cast<TopN>(op);
+  ASSERT_TRUE(top_n_op);
+  EXPECT_EQ(top_n_op->column_id(), ColumnID{1});
+  EXPECT_EQ(top_n_op->order_by_mode(), OrderByMode::Descending);
+  EXPECT_EQ(top_n_op->num_rows(), num_rows);
+
+  const auto get_table_op = std::dynamic_pointer_cast<const GetTable>(top_n_op->input_left());
+  ASSERT_TRUE(get_table_op);
+  EXPECT_EQ(get_table_op->table_name(), "table_int_float");
+}
+
 TEST_F(LQPTranslatorTest, DiamondShapeSimple) {
   /**
    * Test that
@@ -521,6 +556,90 @@ TEST_F(LQPTranslatorTest, DiamondShapeSimple) {
   EXPECT_EQ(pqp->input_left()->input_left()->input_left(), pqp->input_right()->input_left()->input_left());
 }
 
+TEST_F(LQPTranslatorTest, CommonSubplansAreShared) {
+  /**
+   * The two subplans below the join are separate LQPs, but equal. They are translated into a single operator subtree
+   * that is only executed once. The third subplan uses a different predicate and gets its own operators.
+   */
+  const auto make_subplan = [](const auto value) {
+    auto table_node = StoredTableNode::make("table_int_float2");
+    return PredicateNode::make(LQPColumnReference{table_node, ColumnID{0}}, PredicateCondition::GreaterThan, value,
+                               table_node);
+  };
+
+  const auto subplan_a = make_subplan(100);
+  const auto subplan_b = make_subplan(100);
+  const auto subplan_c = make_subplan(200);
+
+  const auto join_node =
+      JoinNode::make(JoinMode::Inner,
+                     LQPColumnReferencePair{LQPColumnReference{subplan_a, ColumnID{0}},
+                                            LQPColumnReference{subplan_b, ColumnID{0}}},
+                     PredicateCondition::Equals, subplan_a, subplan_b);
+
+  LQPTranslator lqp_translator;
+  const auto pqp = lqp_translator.translate_node(join_node);
+  const auto other_pqp = lqp_translator.translate_node(subplan_c);
+
+  ASSERT_NE(pqp->input_left(), nullptr);
+  EXPECT_EQ(pqp->input_left(), pqp->input_right());
+  EXPECT_NE(other_pqp, pqp->input_left());
+  EXPECT_EQ(other_pqp->input_left(), pqp->input_left()->input_left());
+}
+
+TEST_F(LQPTranslatorTest, PredicatesWithNearValuesAreNotShared) {
+  // shallow_equals() considers the two predicates equal, but they select different rows
+  const auto table_node = StoredTableNode::make("table_int_float2");
+  const auto predicate_a =
+      PredicateNode::make(LQPColumnReference{table_node, ColumnID{1}}, PredicateCondition::LessThan, 0.5, table_node);
+  const auto predicate_b = PredicateNode::make(LQPColumnReference{table_node, ColumnID{1}},
+                                               PredicateCondition::LessThan, 0.5005, table_node);
+  ASSERT_TRUE(predicate_a->shallow_equals(*predicate_b));
+
+  LQPTranslator lqp_translator;
+  const auto pqp_a = lqp_translator.translate_node(predicate_a);
+  const auto pqp_b = lqp_translator.translate_node(predicate_b);
+
+  EXPECT_NE(pqp_a, pqp_b);
+  EXPECT_EQ(pqp_a->input_left(), pqp_b->input_left());
+}
+
+TEST_F(LQPTranslatorTest, ExpressionsWithDifferentLiteralsAreNotShared) {
+  // shallow_equals() considers any two literals equal, but `a + 1` and `a + 2` compute different values
+  const auto table_node = StoredTableNode::make("table_int_float2");
+  const auto column_a = LQPColumnReference{table_node, ColumnID{0}};
+
+  const auto make_projection = [&](const auto value) {
+    const auto a_plus_value = LQPExpression::create_binary_operator(
+        ExpressionType::Addition, LQPExpression::create_column(column_a), LQPExpression::create_literal(value));
+    return ProjectionNode::make(std::vector<std::shared_ptr<LQPExpression>>{a_plus_value}, table_node);
+  };
+
+  const auto make_aggregate = [&](const auto value) {
+    const auto sum_expression = LQPExpression::create_aggregate_function(
+        AggregateFunction::Sum,
+        {LQPExpression::create_binary_operator(ExpressionType::Multiplication, LQPExpression::create_column(column_a),
+                                               LQPExpression::create_literal(value))});
+    return AggregateNode::make(std::vector<std::shared_ptr<LQPExpression>>{sum_expression},
+                               std::vector<LQPColumnReference>{column_a}, table_node);
+  };
+
+  const auto projection_a = make_projection(1);
+  const auto projection_b = make_projection(2);
+  const auto aggregate_a = make_aggregate(1);
+  const auto aggregate_b = make_aggregate(2);
+  ASSERT_TRUE(projection_a->shallow_equals(*projection_b));
+  ASSERT_TRUE(aggregate_a->shallow_equals(*aggregate_b));
+
+  LQPTranslator lqp_translator;
+  EXPECT_NE(lqp_translator.translate_node(projection_a), lqp_translator.translate_node(projection_b));
+  EXPECT_NE(lqp_translator.translate_node(aggregate_a), lqp_translator.translate_node(aggregate_b));
+
+  // Identical expressions are still shared
+  EXPECT_EQ(lqp_translator.translate_node(make_projection(1)), lqp_translator.translate_node(projection_a));
+  EXPECT_EQ(lqp_translator.translate_node(make_aggregate(2)), lqp_translator.translate_node(aggregate_b));
+}
+
 TEST_F(LQPTranslatorTest, ProjectionWithSubselect) {
   auto table_node = std::make_shared<StoredTableNode>("table_int_float2");
   auto subselect_node = std::make_shared<StoredTableNode>("table_int_float");
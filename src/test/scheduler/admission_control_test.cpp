@@ -0,0 +1,171 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "../base_test.hpp"
+
+#include "operators/get_table.hpp"
+#include "scheduler/admission_control.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/operator_task.hpp"
+#include "scheduler/topology.hpp"
+
+namespace opossum {
+
+class AdmissionControlTest : public BaseTest {};
+
+TEST_F(AdmissionControlTest, EstimateCost) {
+  StorageManager::get().add_table("table_a", load_table("src/test/tables/int_float.tbl", 2));
+
+  const auto get_table = std::make_shared<GetTable>("table_a");
+  const auto tasks = OperatorTask::make_tasks_from_operator(get_table);
+
+  EXPECT_FLOAT_EQ(AdmissionControl::estimate_cost(tasks), 3.0f);
+}
+
+TEST_F(AdmissionControlTest, CheapQueriesAreNotLimited) {
+  auto& admission_control = AdmissionControl::get();
+  admission_control.set_cheap_query_cost_threshold(100.0f);
+  admission_control.set_max_concurrent_expensive_queries(1);
+
+  const auto expensive_admission = admission_control.admit(1000.0f);
+  EXPECT_EQ(expensive_admission->priority(), SchedulePriority::Normal);
+  EXPECT_EQ(admission_control.num_running_expensive_queries(), 1u);
+
+  // Does not block even though the only expensive slot is taken
+  const auto cheap_admission = admission_control.admit(10.0f);
+  EXPECT_EQ(cheap_admission->priority(), SchedulePriority::High);
+  EXPECT_NE(cheap_admission->query_id(), expensive_admission->query_id());
+  EXPECT_EQ(admission_control.num_running_expensive_queries(), 1u);
+}
+
+TEST_F(AdmissionControlTest, ExpensiveQueriesWaitForSlot) {
+  auto& admission_control = AdmissionControl::get();
+  admission_control.set_cheap_query_cost_threshold(100.0f);
+  admission_control.set_max_concurrent_expensive_queries(1);
+
+  auto first_admission = admission_control.admit(1000.0f);
+
+  std::atomic_bool second_admitted{false};
+  auto second_query = std::thread([&]() {
+    const auto second_admission = admission_control.admit(1000.0f);
+    second_admitted = true;
+  });
+
+  while (admission_control.num_waiting_expensive_queries() == 0) std::this_thread::yield();
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  EXPECT_FALSE(second_admitted);
+
+  first_admission.reset();
+  second_query.join();
+
+  EXPECT_TRUE(second_admitted);
+  EXPECT_EQ(admission_control.num_running_expensive_queries(), 0u);
+  EXPECT_EQ(admission_control.num_waiting_expensive_queries(), 0u);
+}
+
+TEST_F(AdmissionControlTest, TasksInheritQueryID) {
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(Topology::create_fake_numa_topology(4, 2)));
+
+  auto inner_query_id = std::atomic<QueryID>{INVALID_QUERY_ID};
+  auto inner_task = std::shared_ptr<AbstractTask>{};
+
+  auto outer_task = std::make_shared<JobTask>([&]() {
+    inner_task = std::make_shared<JobTask>([]() {});
+    inner_task->schedule();
+    CurrentScheduler::wait_for_tasks(std::vector<std::shared_ptr<AbstractTask>>{inner_task});
+    inner_query_id = inner_task->query_id();
+  });
+  outer_task->set_query(QueryID{42});
+  outer_task->schedule();
+  outer_task->join();
+
+  CurrentScheduler::get()->finish();
+
+  EXPECT_EQ(inner_query_id, QueryID{42});
+}
+
+TEST_F(AdmissionControlTest, ExpensiveQueriesShareCpusByWeight) {
+  // The number of CPUs of the fake topology depends on the machine
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(Topology::create_fake_numa_topology(8, 2)));
+  const auto num_cpus = static_cast<uint32_t>(CurrentScheduler::get()->topology()->num_cpus());
+
+  auto& admission_control = AdmissionControl::get();
+  admission_control.set_cheap_query_cost_threshold(100.0f);
+
+  const auto first_admission = admission_control.admit(1000.0f, 1);
+  ASSERT_NE(first_admission->task_limit(), nullptr);
+  EXPECT_EQ(first_admission->task_limit()->max_concurrent_tasks(), num_cpus);
+
+  auto second_admission = admission_control.admit(1000.0f, 3);
+  EXPECT_EQ(first_admission->task_limit()->max_concurrent_tasks(), std::max(1u, num_cpus / 4));
+  EXPECT_EQ(second_admission->task_limit()->max_concurrent_tasks(), std::max(1u, num_cpus * 3 / 4));
+
+  // Cheap queries are not limited and do not take a share
+  const auto cheap_admission = admission_control.admit(10.0f, 4);
+  EXPECT_EQ(cheap_admission->task_limit(), nullptr);
+  EXPECT_EQ(first_admission->task_limit()->max_concurrent_tasks(), std::max(1u, num_cpus / 4));
+
+  second_admission.reset();
+  EXPECT_EQ(first_admission->task_limit()->max_concurrent_tasks(), num_cpus);
+
+  CurrentScheduler::get()->finish();
+}
+
+TEST_F(AdmissionControlTest, QueryTaskLimitDefersTasks) {
+  auto task_limit = QueryTaskLimit{1, 1};
+  const auto first_task = std::make_shared<JobTask>([]() {});
+  const auto second_task = std::make_shared<JobTask>([]() {});
+
+  EXPECT_TRUE(task_limit.try_start_task(first_task));
+  EXPECT_FALSE(task_limit.try_start_task(second_task));
+  EXPECT_EQ(task_limit.num_running_tasks(), 1u);
+
+  // The deferred task takes the slot of the finished one
+  const auto startable_tasks = task_limit.finish_task();
+  ASSERT_EQ(startable_tasks.size(), 1u);
+  EXPECT_EQ(startable_tasks[0], second_task);
+  EXPECT_EQ(task_limit.num_running_tasks(), 1u);
+
+  EXPECT_TRUE(task_limit.finish_task().empty());
+  EXPECT_EQ(task_limit.num_running_tasks(), 0u);
+}
+
+TEST_F(AdmissionControlTest, WorkersRespectQueryTaskLimit) {
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(Topology::create_fake_numa_topology(4, 2)));
+
+  const auto task_limit = std::make_shared<QueryTaskLimit>(1, 1);
+  auto num_running_tasks = std::atomic_uint32_t{0};
+  auto max_num_running_tasks = std::atomic_uint32_t{0};
+  auto num_executed_tasks = std::atomic_uint32_t{0};
+
+  auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto task_idx = 0; task_idx < 20; ++task_idx) {
+    const auto task = std::make_shared<JobTask>([&]() {
+      const auto num_running = ++num_running_tasks;
+      auto max_num_running = max_num_running_tasks.load();
+      while (num_running > max_num_running &&
+             !max_num_running_tasks.compare_exchange_weak(max_num_running, num_running)) {
+      }
+      std::this_thread::sleep_for(std::chrono::microseconds(100));
+      --num_running_tasks;
+      ++num_executed_tasks;
+    });
+    task->set_query(QueryID{42}, SchedulePriority::Normal, task_limit);
+    tasks.push_back(task);
+  }
+
+  for (const auto& task : tasks) task->schedule();
+  CurrentScheduler::wait_for_tasks(tasks);
+  CurrentScheduler::get()->finish();
+
+  EXPECT_EQ(num_executed_tasks, 20u);
+  EXPECT_EQ(max_num_running_tasks, 1u);
+  EXPECT_EQ(task_limit->num_running_tasks(), 0u);
+}
+
+}  // namespace opossum
@@ -0,0 +1,110 @@
+#include <chrono>
+#include <memory>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include "../base_test.hpp"
+
+#include "json.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/scheduler_statistics.hpp"
+#include "scheduler/task_tracer.hpp"
+#include "scheduler/topology.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+
+namespace opossum {
+
+class SchedulerStatisticsTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(Topology::create_fake_numa_topology(4, 2)));
+  }
+
+  void schedule_and_wait_for_jobs(size_t num_jobs) {
+    std::vector<std::shared_ptr<JobTask>> jobs;
+    for (auto job_idx = size_t{0}; job_idx < num_jobs; ++job_idx) {
+      jobs.emplace_back(std::make_shared<JobTask>([]() {}));
+    }
+    CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+  }
+};
+
+TEST_F(SchedulerStatisticsTest, CountsExecutedTasks) {
+  schedule_and_wait_for_jobs(100);
+
+  const auto count_executed_tasks = [](const Table& table) {
+    auto num_executed_tasks = int64_t{0};
+    const auto executed_tasks_column_id = table.column_id_by_name("executed_tasks");
+    for (auto row_idx = size_t{0}; row_idx < table.row_count(); ++row_idx) {
+      num_executed_tasks += table.get_value<int64_t>(executed_tasks_column_id, row_idx);
+    }
+    return num_executed_tasks;
+  };
+
+  // A Worker counts a task only after waking up the waiting thread, so the last tasks might not be counted yet
+  auto table = generate_scheduler_statistics_table();
+  const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds{1};
+  while (count_executed_tasks(*table) < 100 && std::chrono::steady_clock::now() < deadline) {
+    std::this_thread::yield();
+    table = generate_scheduler_statistics_table();
+  }
+
+  EXPECT_GE(table->row_count(), CurrentScheduler::get()->topology()->num_cpus());
+  EXPECT_EQ(count_executed_tasks(*table), 100);
+
+  // The rows are visible to every transaction
+  EXPECT_TRUE(table->get_chunk(ChunkID{0})->mvcc_columns()->is_fully_visible(CommitID{0}));
+
+  CurrentScheduler::get()->finish();
+}
+
+TEST_F(SchedulerStatisticsTest, MetaTable) {
+  EXPECT_TRUE(StorageManager::get().has_table("meta_scheduler"));
+  EXPECT_TRUE(StorageManager::is_meta_table("meta_scheduler"));
+  EXPECT_FALSE(StorageManager::is_meta_table("meta_scheduler_2"));
+  EXPECT_TRUE(StorageManager::get().table_names().empty());
+
+  auto sql_pipeline = SQLPipelineBuilder{"SELECT node_id, worker_id FROM meta_scheduler WHERE node_id = 0"}
+                          .create_pipeline();
+  const auto table = sql_pipeline.get_result_table();
+
+  // The first node has at least one Worker on each of its CPUs
+  const auto& topology_node = CurrentScheduler::get()->topology()->nodes()[0];
+  ASSERT_GE(table->row_count(), topology_node.cpus.size());
+  for (auto row_idx = size_t{0}; row_idx < table->row_count(); ++row_idx) {
+    EXPECT_EQ(table->get_value<int32_t>(ColumnID{0}, row_idx), 0);
+  }
+
+  CurrentScheduler::get()->finish();
+}
+
+TEST_F(SchedulerStatisticsTest, ChromeTrace) {
+  const auto num_nodes = CurrentScheduler::get()->queues().size();
+
+  auto& task_tracer = TaskTracer::get();
+  task_tracer.enable();
+  schedule_and_wait_for_jobs(10);
+  task_tracer.disable();
+  schedule_and_wait_for_jobs(10);
+
+  CurrentScheduler::get()->finish();
+
+  ASSERT_EQ(task_tracer.events().size(), 10u);
+
+  std::stringstream stream;
+  task_tracer.write_chrome_trace(stream);
+
+  nlohmann::json trace;
+  stream >> trace;
+
+  ASSERT_EQ(trace["traceEvents"].size(), 10u);
+  for (const auto& trace_event : trace["traceEvents"]) {
+    EXPECT_EQ(trace_event["ph"].get<std::string>(), "X");
+    EXPECT_GE(trace_event["dur"].get<double>(), 0.0);
+    EXPECT_LT(trace_event["pid"].get<size_t>(), num_nodes);
+  }
+}
+
+}  // namespace opossum
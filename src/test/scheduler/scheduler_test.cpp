@@ -1,4 +1,6 @@
+#include <chrono>
 #include <memory>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -10,6 +12,8 @@
 #include "scheduler/job_task.hpp"
 #include "scheduler/node_queue_scheduler.hpp"
 #include "scheduler/operator_task.hpp"
+#include "scheduler/processing_unit.hpp"
+#include "scheduler/task_queue.hpp"
 #include "scheduler/topology.hpp"
 #include "storage/storage_manager.hpp"
 
@@ -121,6 +125,118 @@ TEST_F(SchedulerTest, BasicTest) {
   CurrentScheduler::set(nullptr);
 }
 
+TEST_F(SchedulerTest, TasksWakeParkedWorkers) {
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(Topology::create_fake_numa_topology(8, 4)));
+
+  // Give the idle workers time to stop spinning and park in their queues
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+  std::atomic_uint counter{0};
+
+  const auto num_queues = CurrentScheduler::get()->queues().size();
+  for (auto node_id = NodeID{0}; node_id < num_queues; ++node_id) {
+    auto task = std::make_shared<JobTask>([&]() { counter++; });
+    task->schedule(node_id);
+  }
+
+  CurrentScheduler::get()->finish();
+
+  ASSERT_EQ(counter, num_queues);
+
+  CurrentScheduler::set(nullptr);
+}
+
+TEST_F(SchedulerTest, UnknownPreferredNode) {
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(Topology::create_fake_numa_topology(8, 4)));
+
+  std::atomic_uint counter{0};
+
+  // E.g., jobs for chunks whose location is unknown
+  auto task = std::make_shared<JobTask>([&]() { counter++; });
+  task->schedule(INVALID_NODE_ID);
+
+  auto outer_task = std::make_shared<JobTask>([&]() {
+    auto inner_task = std::make_shared<JobTask>([&]() { counter++; });
+    inner_task->schedule(INVALID_NODE_ID);
+    inner_task->join();
+  });
+  outer_task->schedule();
+
+  CurrentScheduler::get()->finish();
+
+  ASSERT_EQ(counter, 2u);
+
+  CurrentScheduler::set(nullptr);
+}
+
+TEST_F(SchedulerTest, StealHalfOfTasks) {
+  auto victim_queue = TaskQueue{NodeID{0}};
+  auto thief_queue = TaskQueue{NodeID{1}};
+
+  for (auto task_idx = 0; task_idx < 10; ++task_idx) {
+    victim_queue.push(std::make_shared<JobTask>([]() {}), static_cast<uint32_t>(SchedulePriority::Normal));
+  }
+  victim_queue.push(std::make_shared<JobTask>([]() {}), static_cast<uint32_t>(SchedulePriority::Unstealable));
+
+  const auto stolen_task = victim_queue.steal(thief_queue);
+  ASSERT_TRUE(stolen_task);
+  EXPECT_EQ(stolen_task->node_id(), NodeID{1});
+
+  EXPECT_EQ(victim_queue.size(), 6u);
+  EXPECT_EQ(thief_queue.size(), 4u);
+  EXPECT_EQ(thief_queue.pull()->node_id(), NodeID{1});
+
+  // Unstealable tasks stay where they are
+  while (victim_queue.steal(thief_queue)) {
+  }
+  EXPECT_EQ(victim_queue.size(), 1u);
+  EXPECT_EQ(thief_queue.size(), 4u);
+}
+
+TEST_F(SchedulerTest, StealFromRemoteNodesInOrder) {
+  auto scheduler = std::make_shared<NodeQueueScheduler>(Topology::create_fake_numa_topology(8, 2));
+  CurrentScheduler::set(scheduler);
+
+  const auto num_nodes = scheduler->queues().size();
+  for (const auto& processing_unit : scheduler->processing_units()) {
+    const auto& remote_queues = processing_unit->remote_queues();
+    ASSERT_EQ(remote_queues.size(), num_nodes - 1);
+    if (remote_queues.empty()) continue;
+
+    // With equal distances, each node starts with the next one
+    const auto node_id = processing_unit->workers().front()->queue()->node_id();
+    EXPECT_EQ(remote_queues.front()->node_id(), (node_id + 1) % num_nodes);
+  }
+
+  CurrentScheduler::get()->finish();
+}
+
+TEST_F(SchedulerTest, NestedWaitsExecuteOtherTasks) {
+  // More nested waits than there are workers. Waiting workers have to execute the inner jobs themselves.
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(Topology::create_fake_numa_topology(2, 1)));
+
+  std::atomic_uint counter{0};
+
+  std::vector<std::shared_ptr<JobTask>> outer_jobs;
+  for (auto outer_job_idx = 0; outer_job_idx < 20; ++outer_job_idx) {
+    outer_jobs.emplace_back(std::make_shared<JobTask>([&]() {
+      std::vector<std::shared_ptr<JobTask>> inner_jobs;
+      for (auto inner_job_idx = 0; inner_job_idx < 10; ++inner_job_idx) {
+        inner_jobs.emplace_back(std::make_shared<JobTask>([&]() { counter++; }));
+        inner_jobs.back()->schedule();
+      }
+      CurrentScheduler::wait_for_tasks(inner_jobs);
+    }));
+  }
+
+  CurrentScheduler::schedule_and_wait_for_tasks(outer_jobs);
+  CurrentScheduler::get()->finish();
+
+  ASSERT_EQ(counter, 200u);
+
+  CurrentScheduler::set(nullptr);
+}
+
 TEST_F(SchedulerTest, BasicTestWithoutScheduler) {
   std::atomic_uint counter{0};
   increment_counter_in_subtasks(counter);
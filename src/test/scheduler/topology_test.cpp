@@ -0,0 +1,126 @@
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+
+#include "scheduler/topology.hpp"
+#include "utils/filesystem.hpp"
+
+namespace opossum {
+
+class TopologyTest : public BaseTest {
+ protected:
+  /**
+   * Creates a sysfs tree for two NUMA nodes with two L3 domains each. Every L3 domain has two physical cores with two
+   * hardware threads each. As on Linux, CPU n and CPU n + 8 are SMT siblings.
+   */
+  void SetUp() override {
+    _sysfs_cpu_path = test_data_path + "sysfs_cpu";
+    filesystem::create_directories(_sysfs_cpu_path);
+    _write_file(_sysfs_cpu_path + "/online", "0-15");
+
+    for (auto cpu_id = 0; cpu_id < 16; ++cpu_id) {
+      const auto core_id = cpu_id % 8;
+      const auto cpu_path = _sysfs_cpu_path + "/cpu" + std::to_string(cpu_id);
+      const auto first_l3_core_id = core_id / 2 * 2;
+
+      filesystem::create_directories(cpu_path + "/topology");
+      filesystem::create_directories(cpu_path + "/node" + std::to_string(core_id / 4));
+      filesystem::create_directories(cpu_path + "/cache/index2");
+      filesystem::create_directories(cpu_path + "/cache/index3");
+
+      _write_file(cpu_path + "/topology/thread_siblings_list",
+                  std::to_string(core_id) + "," + std::to_string(core_id + 8));
+      _write_file(cpu_path + "/cache/index2/level", "2");
+      _write_file(cpu_path + "/cache/index2/shared_cpu_list",
+                  std::to_string(core_id) + "," + std::to_string(core_id + 8));
+      _write_file(cpu_path + "/cache/index3/level", "3");
+      _write_file(cpu_path + "/cache/index3/shared_cpu_list",
+                  std::to_string(first_l3_core_id) + "-" + std::to_string(first_l3_core_id + 1) + "," +
+                      std::to_string(first_l3_core_id + 8) + "-" + std::to_string(first_l3_core_id + 9));
+    }
+  }
+
+  void TearDown() override { filesystem::remove_all(_sysfs_cpu_path); }
+
+  static void _write_file(const std::string& path, const std::string& content) {
+    auto file = std::ofstream{path};
+    file << content << std::endl;
+  }
+
+  static std::vector<CpuID> _cpu_ids(const TopologyNode& node) {
+    std::vector<CpuID> cpu_ids;
+    for (const auto& cpu : node.cpus) {
+      cpu_ids.emplace_back(cpu.cpu_id);
+    }
+    return cpu_ids;
+  }
+
+  std::string _sysfs_cpu_path;
+};
+
+TEST_F(TopologyTest, NodePerNUMANode) {
+  const auto topology = Topology::create_topology({}, _sysfs_cpu_path);
+
+  ASSERT_EQ(topology->nodes().size(), 2u);
+  EXPECT_EQ(topology->num_cpus(), 16u);
+  EXPECT_TRUE(topology->reserved_cpus().empty());
+
+  EXPECT_EQ(topology->nodes()[0].numa_node_id, NodeID{0});
+  EXPECT_EQ(_cpu_ids(topology->nodes()[0]), std::vector<CpuID>({CpuID{0}, CpuID{1}, CpuID{2}, CpuID{3}, CpuID{8},
+                                                                CpuID{9}, CpuID{10}, CpuID{11}}));
+  EXPECT_EQ(topology->nodes()[1].numa_node_id, NodeID{1});
+  EXPECT_EQ(topology->nodes()[1].cpus.size(), 8u);
+}
+
+TEST_F(TopologyTest, OneWorkerPerCore) {
+  auto options = TopologyOptions{};
+  options.one_worker_per_core = true;
+  const auto topology = Topology::create_topology(options, _sysfs_cpu_path);
+
+  ASSERT_EQ(topology->nodes().size(), 2u);
+  EXPECT_EQ(_cpu_ids(topology->nodes()[0]), std::vector<CpuID>({CpuID{0}, CpuID{1}, CpuID{2}, CpuID{3}}));
+  EXPECT_EQ(_cpu_ids(topology->nodes()[1]), std::vector<CpuID>({CpuID{4}, CpuID{5}, CpuID{6}, CpuID{7}}));
+}
+
+TEST_F(TopologyTest, NodePerL3Cache) {
+  auto options = TopologyOptions{};
+  options.node_per_l3_cache = true;
+  const auto topology = Topology::create_topology(options, _sysfs_cpu_path);
+
+  ASSERT_EQ(topology->nodes().size(), 4u);
+  EXPECT_EQ(_cpu_ids(topology->nodes()[0]), std::vector<CpuID>({CpuID{0}, CpuID{1}, CpuID{8}, CpuID{9}}));
+  EXPECT_EQ(_cpu_ids(topology->nodes()[3]), std::vector<CpuID>({CpuID{6}, CpuID{7}, CpuID{14}, CpuID{15}}));
+
+  // L3 domains of the same NUMA node are closer to each other than to those of the other NUMA node
+  EXPECT_EQ(topology->nodes()[1].numa_node_id, NodeID{0});
+  EXPECT_EQ(topology->nodes()[2].numa_node_id, NodeID{1});
+}
+
+TEST_F(TopologyTest, ReservedCores) {
+  auto options = TopologyOptions{};
+  options.num_reserved_cores = 1;
+  options.max_num_cores = 10;
+  const auto topology = Topology::create_topology(options, _sysfs_cpu_path);
+
+  EXPECT_EQ(topology->reserved_cpus(), std::vector<CpuID>({CpuID{7}, CpuID{15}}));
+
+  auto num_cpus = size_t{0};
+  for (const auto& node : topology->nodes()) {
+    num_cpus += node.cpus.size();
+    for (const auto& cpu : node.cpus) {
+      EXPECT_NE(cpu.cpu_id, CpuID{7});
+      EXPECT_NE(cpu.cpu_id, CpuID{15});
+    }
+  }
+  EXPECT_EQ(num_cpus, 10u);
+}
+
+TEST_F(TopologyTest, FallbackWithoutSysfs) {
+  const auto topology = Topology::create_topology({}, test_data_path + "does_not_exist");
+
+  EXPECT_FALSE(topology->nodes().empty());
+}
+
+}  // namespace opossum
@@ -0,0 +1,86 @@
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "../base_test.hpp"
+
+#include "scheduler/job_task.hpp"
+#include "scheduler/work_stealing_deque.hpp"
+
+namespace opossum {
+
+class WorkStealingDequeTest : public BaseTest {};
+
+TEST_F(WorkStealingDequeTest, PopLifoStealFifo) {
+  WorkStealingDeque deque;
+  EXPECT_TRUE(deque.empty());
+
+  auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto task_idx = 0; task_idx < 4; ++task_idx) {
+    tasks.emplace_back(std::make_shared<JobTask>([]() {}));
+    EXPECT_TRUE(deque.push(tasks.back()));
+  }
+
+  EXPECT_FALSE(deque.empty());
+  EXPECT_EQ(deque.pop(), tasks[3]);
+  EXPECT_EQ(deque.steal(), tasks[0]);
+  EXPECT_EQ(deque.pop(), tasks[2]);
+  EXPECT_EQ(deque.steal(), tasks[1]);
+
+  EXPECT_TRUE(deque.empty());
+  EXPECT_EQ(deque.pop(), nullptr);
+  EXPECT_EQ(deque.steal(), nullptr);
+}
+
+TEST_F(WorkStealingDequeTest, PushFailsWhenFull) {
+  WorkStealingDeque deque;
+  auto task = std::make_shared<JobTask>([]() {});
+
+  for (auto task_idx = int64_t{0}; task_idx < WorkStealingDeque::CAPACITY; ++task_idx) {
+    ASSERT_TRUE(deque.push(task));
+  }
+  EXPECT_FALSE(deque.push(task));
+
+  EXPECT_EQ(deque.steal(), task);
+  EXPECT_TRUE(deque.push(task));
+}
+
+TEST_F(WorkStealingDequeTest, ConcurrentStealing) {
+  // Every task must be taken exactly once, either by the owner or by one of the thieves
+  constexpr auto NUM_TASKS = 100'000;
+  constexpr auto NUM_THIEVES = 4;
+
+  WorkStealingDeque deque;
+  std::atomic_uint num_executed_tasks{0};
+  std::atomic_bool owner_done{false};
+
+  auto thieves = std::vector<std::thread>{};
+  for (auto thief_idx = 0; thief_idx < NUM_THIEVES; ++thief_idx) {
+    thieves.emplace_back([&]() {
+      while (!owner_done || !deque.empty()) {
+        if (auto task = deque.steal()) task->execute();
+      }
+    });
+  }
+
+  for (auto task_idx = 0; task_idx < NUM_TASKS; ++task_idx) {
+    auto task = std::make_shared<JobTask>([&]() { ++num_executed_tasks; });
+    while (!deque.push(task)) {
+      if (auto popped_task = deque.pop()) popped_task->execute();
+    }
+
+    if (task_idx % 3 == 0) {
+      if (auto popped_task = deque.pop()) popped_task->execute();
+    }
+  }
+
+  while (auto task = deque.pop()) task->execute();
+  owner_done = true;
+
+  for (auto& thief : thieves) thief.join();
+
+  EXPECT_EQ(num_executed_tasks, static_cast<unsigned>(NUM_TASKS));
+}
+
+}  // namespace opossum
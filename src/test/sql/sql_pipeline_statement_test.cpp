@@ -205,6 +205,19 @@ TEST_F(SQLPipelineStatementTest, ConstructorCombinations) {
   EXPECT_EQ(sql_pipeline6.get_sql_string(), _select_query_a);
 }
 
+TEST_F(SQLPipelineStatementTest, SortMemoryBudget) {
+  const auto sql = std::string{"SELECT * FROM table_a ORDER BY a DESC"};
+  const auto expected_result = SQLPipelineBuilder{sql}.create_pipeline_statement().get_result_table();
+
+  // Every row is spilled to a run of its own
+  auto sql_pipeline = SQLPipelineBuilder{sql}.with_sort_memory_budget(1u).create_pipeline_statement();
+  EXPECT_TABLE_EQ_ORDERED(sql_pipeline.get_result_table(), expected_result);
+
+  auto builder =
+      SQLPipelineBuilder{sql}.with_sort_memory_budget(1u).with_lqp_translator(std::make_shared<LQPTranslator>());
+  EXPECT_THROW(builder.create_pipeline_statement(), std::logic_error);
+}
+
 TEST_F(SQLPipelineStatementTest, GetParsedSQL) {
   auto sql_pipeline = SQLPipelineBuilder{_select_query_a}.create_pipeline_statement();
   const auto& parsed_sql = sql_pipeline.get_parsed_sql_statement();
@@ -371,6 +384,17 @@ TEST_F(SQLPipelineStatementTest, GetQueryPlanWithMVCC) {
   EXPECT_NE(plan->tree_roots().at(0)->transaction_context(), nullptr);
 }
 
+TEST_F(SQLPipelineStatementTest, GetQueryPlanWithReadOnlyTransactionContext) {
+  auto sql_pipeline = SQLPipelineBuilder{_select_query_a}.create_pipeline_statement();
+  sql_pipeline.get_result_table();
+
+  // Auto-commit SELECTs only read
+  const auto& transaction_context = sql_pipeline.transaction_context();
+  ASSERT_NE(transaction_context, nullptr);
+  EXPECT_TRUE(transaction_context->is_read_only());
+  EXPECT_EQ(transaction_context->phase(), TransactionPhase::Committed);
+}
+
 TEST_F(SQLPipelineStatementTest, GetQueryPlanWithoutMVCC) {
   auto sql_pipeline = SQLPipelineBuilder{_select_query_a}.disable_mvcc().create_pipeline_statement();
   const auto& plan = sql_pipeline.get_query_plan();
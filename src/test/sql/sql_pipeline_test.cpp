@@ -1,5 +1,7 @@
+#include <chrono>
 #include <memory>
 #include <string>
+#include <thread>
 #include <utility>
 #include "../base_test.hpp"
 
@@ -518,4 +520,53 @@ TEST_F(SQLPipelineTest, CacheQueryPlanTwice) {
   EXPECT_TRUE(cache.has("INSERT INTO table_a VALUES (11, 11.11);"));
 }
 
+TEST_F(SQLPipelineTest, CancelledPipelineIsRolledBack) {
+  auto sql_pipeline = SQLPipelineBuilder{_multi_statement_query}.create_pipeline();
+  sql_pipeline.cancel();
+
+  EXPECT_THROW(sql_pipeline.get_result_table(), std::runtime_error);
+
+  // The INSERT was not executed
+  EXPECT_EQ(_table_a->row_count(), 3u);
+}
+
+TEST_F(SQLPipelineTest, TimedOutPipelineThrows) {
+  auto sql_pipeline = SQLPipelineBuilder{_join_query}.with_timeout(std::chrono::microseconds{0}).create_pipeline();
+
+  EXPECT_THROW(sql_pipeline.get_result_table(), std::runtime_error);
+}
+
+TEST_F(SQLPipelineTest, TimeoutStartsWithExecution) {
+  auto sql_pipeline = SQLPipelineBuilder{_join_query}.with_timeout(std::chrono::milliseconds{500}).create_pipeline();
+  sql_pipeline.get_tasks();
+
+  // Compiling and waiting before the execution do not count towards the timeout
+  std::this_thread::sleep_for(std::chrono::milliseconds{600});
+  EXPECT_NO_THROW(sql_pipeline.get_result_table());
+}
+
+TEST_F(SQLPipelineTest, CachedPlansDoNotShareTheCancellationToken) {
+  auto sql_pipeline = SQLPipelineBuilder{_select_query_a}.create_pipeline();
+  sql_pipeline.get_result_table();
+
+  const auto cached_plan = SQLQueryCache<SQLQueryPlan>::get().try_get(_select_query_a);
+  ASSERT_TRUE(cached_plan);
+  const auto& cached_root = cached_plan->tree_roots().front();
+  EXPECT_NE(cached_root, sql_pipeline.get_query_plans().front()->tree_roots().front());
+  EXPECT_EQ(cached_root->cancellation_token(), nullptr);
+  EXPECT_EQ(cached_root->get_output(), nullptr);
+}
+
+TEST_F(SQLPipelineTest, CancelledOperatorsAreNotExecuted) {
+  auto sql_pipeline = SQLPipelineBuilder{_join_query}.create_pipeline();
+  const auto& tasks = sql_pipeline.get_tasks().front();
+
+  sql_pipeline.cancel();
+  CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+
+  for (const auto& task : tasks) {
+    EXPECT_EQ(task->get_operator()->get_output(), nullptr);
+  }
+}
+
 }  // namespace opossum
@@ -167,6 +167,11 @@ TEST_F(StorageChunkTest, GetIndicesByColumnPointers) {
   EXPECT_EQ(std::find(ind_col_1.cbegin(), ind_col_1.cend(), index_int_str), ind_col_1.cend());
 }
 
+TEST_F(StorageChunkTest, NUMANodeIDOfDefaultAllocatedChunk) {
+  // The chunk was not allocated from a NUMAMemoryResource, so its location is unknown
+  EXPECT_EQ(c->numa_node_id(), INVALID_NODE_ID);
+}
+
 TEST_F(StorageChunkTest, RemoveIndex) {
   c = std::make_shared<Chunk>(ChunkColumns({dc_int, dc_str}));
   auto index_int = c->create_index<GroupKeyIndex>(std::vector<std::shared_ptr<const BaseColumn>>{dc_int});
@@ -165,4 +165,23 @@ TEST_F(CountingQuotientFilterTest, MultipleMembershipString) {
   EXPECT_TRUE(filter.count("100") >= 1);
 }
 
+TEST_F(CountingQuotientFilterTest, SerializeAndDeserialize) {
+  for (const auto remainder_bits : {2, 4, 8, 16, 32}) {
+    auto filter = CountingQuotientFilter<int>(8, remainder_bits);
+    for (auto value = 0; value < 100; ++value) {
+      filter.insert(value, value % 3 + 1);
+    }
+
+    const auto data = filter.serialize();
+    const auto restored_filter = CountingQuotientFilter<int>::deserialize(8, remainder_bits, data.data(), data.size());
+    EXPECT_EQ(restored_filter->load_factor(), filter.load_factor());
+    for (auto value = 0; value < 200; ++value) {
+      EXPECT_EQ(restored_filter->count(value), filter.count(value));
+    }
+
+    EXPECT_THROW(CountingQuotientFilter<int>::deserialize(8, remainder_bits, data.data(), data.size() - 1),
+                 std::logic_error);
+  }
+}
+
 } // namespace opossum
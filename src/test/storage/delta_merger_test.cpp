@@ -0,0 +1,137 @@
+#include <chrono>
+#include <memory>
+#include <thread>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "operators/get_table.hpp"
+#include "operators/insert.hpp"
+#include "storage/delta_merger.hpp"
+#include "storage/dictionary_column.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "storage/value_column.hpp"
+
+namespace opossum {
+
+class DeltaMergerTest : public BaseTest {
+ protected:
+  // Chunks: [1, 24, 234, 25], [23, 4, 2, 5], [234, 234]
+  void SetUp() override {
+    _table = load_table("src/test/tables/10_ints.tbl", 4);
+    StorageManager::get().add_table("table_a", _table);
+  }
+
+  bool _is_dictionary_encoded(const ChunkID chunk_id) const {
+    return std::dynamic_pointer_cast<const DictionaryColumn<int>>(
+               _table->get_chunk(chunk_id)->get_column(ColumnID{0})) != nullptr;
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(DeltaMergerTest, MergesCompletedChunks) {
+  const auto delta_chunk = _table->get_chunk(ChunkID{0});
+
+  // The last chunk is neither full nor completed
+  EXPECT_EQ(DeltaMerger::get().merge(), 2u);
+  EXPECT_TRUE(_is_dictionary_encoded(ChunkID{0}));
+  EXPECT_TRUE(_is_dictionary_encoded(ChunkID{1}));
+  EXPECT_FALSE(_is_dictionary_encoded(ChunkID{2}));
+
+  const auto main_chunk = _table->get_chunk(ChunkID{0});
+  EXPECT_NE(main_chunk, delta_chunk);
+  EXPECT_NE(main_chunk->statistics(), nullptr);
+  EXPECT_TRUE(main_chunk->mvcc_columns()->is_contiguous());
+
+  // Readers of the delta chunk are not affected
+  EXPECT_NE(std::dynamic_pointer_cast<const ValueColumn<int>>(delta_chunk->get_column(ColumnID{0})), nullptr);
+  EXPECT_EQ(delta_chunk->size(), 4u);
+
+  EXPECT_TABLE_EQ_ORDERED(_table, load_table("src/test/tables/10_ints.tbl", 4));
+
+  // Main chunks are not merged again
+  EXPECT_EQ(DeltaMerger::get().merge(), 0u);
+}
+
+TEST_F(DeltaMergerTest, SkipsChunksWithUncommittedRows) {
+  StorageManager::get().add_table("table_b", load_table("src/test/tables/int.tbl", 4));
+
+  // The three rows fill the last chunk and start a new one
+  const auto get_table = std::make_shared<GetTable>("table_b");
+  get_table->execute();
+  const auto insert = std::make_shared<Insert>("table_a", get_table);
+  const auto context = TransactionManager::get().new_transaction_context();
+  insert->set_transaction_context(context);
+  insert->execute();
+  ASSERT_EQ(_table->chunk_count(), 4u);
+  ASSERT_EQ(_table->get_chunk(ChunkID{2})->size(), 4u);
+
+  EXPECT_EQ(DeltaMerger::get().merge(), 2u);
+  EXPECT_FALSE(_is_dictionary_encoded(ChunkID{2}));
+
+  context->commit();
+  EXPECT_EQ(DeltaMerger::get().merge(), 1u);
+  EXPECT_TRUE(_is_dictionary_encoded(ChunkID{2}));
+  EXPECT_FALSE(_is_dictionary_encoded(ChunkID{3}));
+  EXPECT_EQ(_table->row_count(), 13u);
+}
+
+TEST_F(DeltaMergerTest, BuildsIndexesAndFilters) {
+  _table->get_chunk(ChunkID{0})->populate_quotient_filter(ColumnID{0}, DataType::Int, 4, 8)->execute();
+
+  auto merge_spec = DeltaMergeSpec{};
+  merge_spec.art_index_column_ids = {ColumnID{0}};
+  DeltaMerger::get().set_merge_spec("table_a", merge_spec);
+
+  EXPECT_EQ(DeltaMerger::get().merge(), 2u);
+  EXPECT_NE(_table->get_chunk(ChunkID{0})->get_art_index(ColumnID{0}), nullptr);
+  EXPECT_NE(_table->get_chunk(ChunkID{1})->get_art_index(ColumnID{0}), nullptr);
+
+  // Filters of the delta chunk are built for its main chunk as well
+  const auto filter = _table->get_chunk(ChunkID{0})->get_filter(ColumnID{0});
+  ASSERT_NE(filter, nullptr);
+  EXPECT_EQ(filter->quotient_bits(), 4u);
+  EXPECT_EQ(_table->get_chunk(ChunkID{1})->get_filter(ColumnID{0}), nullptr);
+
+  // Filters can also be requested for all main chunks
+  merge_spec.quotient_filter_specs = {{ColumnID{0}, 4, 8}};
+  DeltaMerger::get().set_merge_spec("table_a", merge_spec);
+  StorageManager::get().add_table("table_b", load_table("src/test/tables/10_ints.tbl", 4));
+  DeltaMerger::get().set_merge_spec("table_b", merge_spec);
+
+  EXPECT_EQ(DeltaMerger::get().merge(), 2u);
+  const auto table_b = StorageManager::get().get_table("table_b");
+  EXPECT_NE(table_b->get_chunk(ChunkID{0})->get_filter(ColumnID{0}), nullptr);
+  EXPECT_NE(table_b->get_chunk(ChunkID{1})->get_filter(ColumnID{0}), nullptr);
+}
+
+TEST_F(DeltaMergerTest, RejectsUnencodedMainChunks) {
+  auto merge_spec = DeltaMergeSpec{};
+  merge_spec.column_encoding_spec = EncodingType::Unencoded;
+  EXPECT_THROW(DeltaMerger::get().set_merge_spec("table_a", merge_spec), std::logic_error);
+
+  merge_spec.column_encoding_spec = EncodingType::RunLength;
+  merge_spec.art_index_column_ids = {ColumnID{0}};
+  EXPECT_THROW(DeltaMerger::get().set_merge_spec("table_a", merge_spec), std::logic_error);
+}
+
+TEST_F(DeltaMergerTest, RunsInBackground) {
+  auto& delta_merger = DeltaMerger::get();
+  delta_merger.start({std::chrono::milliseconds{1}, 1u});
+  EXPECT_TRUE(delta_merger.is_running());
+
+  for (auto attempt = 0; attempt < 1000 && !_is_dictionary_encoded(ChunkID{1}); ++attempt) {
+    std::this_thread::sleep_for(std::chrono::milliseconds{1});
+  }
+  EXPECT_TRUE(_is_dictionary_encoded(ChunkID{0}));
+  EXPECT_TRUE(_is_dictionary_encoded(ChunkID{1}));
+
+  delta_merger.stop();
+  EXPECT_FALSE(delta_merger.is_running());
+}
+
+}  // namespace opossum
@@ -103,6 +103,18 @@ TEST_F(NUMAPlacementTest, ChunkMigration) {
   }
 }
 
+TEST_F(NUMAPlacementTest, ChunkNodeID) {
+  const auto& table = StorageManager::get().get_table("table");
+  const auto chunk = table->get_chunk(ChunkID{0});
+
+  EXPECT_EQ(chunk->numa_node_id(), NodeID{0});
+
+  const auto target_node_id = static_cast<int>(_node_count - 1);
+  chunk->migrate(NUMAPlacementManager::get().get_memory_resource(target_node_id));
+
+  EXPECT_EQ(chunk->numa_node_id(), NodeID{static_cast<NodeID::base_type>(target_node_id)});
+}
+
 // Tests the integrated loop of NUMAPlacementManager.
 TEST_F(NUMAPlacementTest, IntegratedLoopTest) {
   const auto& table = StorageManager::get().get_table("table");
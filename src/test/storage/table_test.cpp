@@ -113,12 +113,15 @@ TEST_F(StorageTableTest, ShrinkingMvccColumnsHasNoSideEffects) {
 
   const auto previous_size = chunk->size();
 
-  chunk->mvcc_columns()->shrink();
+  EXPECT_FALSE(chunk->mvcc_columns()->is_contiguous());
+  chunk->shrink_mvcc_columns();
 
   ASSERT_EQ(previous_size, chunk->size());
   ASSERT_TRUE(chunk->has_mvcc_columns());
 
   auto new_mvcc_columns = chunk->mvcc_columns();
+  EXPECT_TRUE(new_mvcc_columns->is_contiguous());
+  EXPECT_EQ(new_mvcc_columns->size(), previous_size);
 
   for (auto i = 0u; i < chunk->size(); ++i) {
     EXPECT_EQ(new_mvcc_columns->tids[i], values[i]);
@@ -8,9 +8,17 @@
 #include "operators/abstract_join_operator.hpp"
 #include "operators/get_table.hpp"
 #include "operators/join_hash.hpp"
+#include "operators/limit.hpp"
+#include "operators/operator_pipeline.hpp"
+#include "operators/pqp_expression.hpp"
+#include "operators/projection.hpp"
 #include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
 #include "operators/union_positions.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
 #include "scheduler/operator_task.hpp"
+#include "scheduler/topology.hpp"
 #include "storage/storage_manager.hpp"
 
 namespace opossum {
@@ -96,4 +104,128 @@ TEST_F(OperatorTaskTest, MakeDiamondShape) {
   std::vector<std::shared_ptr<AbstractTask>> expected_successors_4{};
   EXPECT_EQ(tasks[4]->successors(), expected_successors_4);
 }
+
+TEST_F(OperatorTaskTest, MakePipelinedTasks) {
+  auto gt_a = std::make_shared<GetTable>("table_a");
+  auto scan_a = std::make_shared<TableScan>(gt_a, ColumnID{0}, PredicateCondition::GreaterThanEquals, 1234);
+  auto scan_b = std::make_shared<TableScan>(scan_a, ColumnID{1}, PredicateCondition::LessThan, 500.0f);
+  auto limit = std::make_shared<Limit>(scan_b, 2);
+
+  auto tasks = OperatorTask::make_tasks_from_operator(limit, UsePipelining::Yes);
+
+  ASSERT_EQ(tasks.size(), 2u);
+  EXPECT_EQ(tasks[0]->get_operator(), gt_a);
+  EXPECT_EQ(tasks[0]->get_pipeline(), nullptr);
+  EXPECT_EQ(tasks[1]->get_operator(), limit);
+  ASSERT_NE(tasks[1]->get_pipeline(), nullptr);
+
+  const auto expected_pipelined_operators = std::vector<std::shared_ptr<AbstractOperator>>{scan_a, scan_b, limit};
+  EXPECT_EQ(tasks[1]->get_pipeline()->operators(), expected_pipelined_operators);
+
+  std::vector<std::shared_ptr<AbstractTask>> expected_successors_0({tasks[1]});
+  EXPECT_EQ(tasks[0]->successors(), expected_successors_0);
+
+  CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+
+  const auto expected_tasks = OperatorTask::make_tasks_from_operator(limit->recreate());
+  CurrentScheduler::schedule_and_wait_for_tasks(expected_tasks);
+
+  EXPECT_TABLE_EQ_ORDERED(tasks.back()->get_operator()->get_output(),
+                          expected_tasks.back()->get_operator()->get_output());
+}
+
+TEST_F(OperatorTaskTest, ProjectionEndsPipeline) {
+  // The join resolves the rows of all chunks of its inputs through a single referenced table
+  const auto make_input = [](const std::string& table_name) {
+    auto gt = std::make_shared<GetTable>(table_name);
+    auto scan_a = std::make_shared<TableScan>(gt, ColumnID{0}, PredicateCondition::GreaterThan, 0);
+    auto a_plus_one = PQPExpression::create_binary_operator(
+        ExpressionType::Addition, PQPExpression::create_column(ColumnID{0}), PQPExpression::create_literal(1));
+    auto projection = std::make_shared<Projection>(
+        scan_a, Projection::ColumnExpressions{a_plus_one, PQPExpression::create_column(ColumnID{1})});
+    return std::make_shared<TableScan>(projection, ColumnID{0}, PredicateCondition::LessThan, 20000);
+  };
+
+  const auto join = std::make_shared<JoinHash>(make_input("table_a"), make_input("table_b"), JoinMode::Inner,
+                                               ColumnIDPair(ColumnID{0}, ColumnID{0}), PredicateCondition::Equals);
+
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(Topology::create_fake_numa_topology(4, 2)));
+
+  const auto tasks = OperatorTask::make_tasks_from_operator(join, UsePipelining::Yes);
+  for (const auto& task : tasks) {
+    if (const auto& pipeline = task->get_pipeline()) {
+      EXPECT_EQ(pipeline->operators().back()->type(), OperatorType::Projection);
+    }
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+
+  const auto expected_tasks = OperatorTask::make_tasks_from_operator(join->recreate());
+  CurrentScheduler::schedule_and_wait_for_tasks(expected_tasks);
+
+  CurrentScheduler::get()->finish();
+
+  EXPECT_GT(join->get_output()->row_count(), 0u);
+  EXPECT_TABLE_EQ_UNORDERED(join->get_output(), expected_tasks.back()->get_operator()->get_output());
+}
+
+TEST_F(OperatorTaskTest, DoNotPipelineOperatorsWithMultipleConsumers) {
+  auto gt_a = std::make_shared<GetTable>("table_a");
+  auto scan_a = std::make_shared<TableScan>(gt_a, ColumnID{0}, PredicateCondition::GreaterThanEquals, 1234);
+  auto scan_b = std::make_shared<TableScan>(scan_a, ColumnID{1}, PredicateCondition::LessThan, 1000);
+  auto scan_c = std::make_shared<TableScan>(scan_a, ColumnID{1}, PredicateCondition::GreaterThan, 2000);
+  auto union_positions = std::make_shared<UnionPositions>(scan_b, scan_c);
+
+  auto tasks = OperatorTask::make_tasks_from_operator(union_positions, UsePipelining::Yes);
+
+  ASSERT_EQ(tasks.size(), 5u);
+  for (const auto& task : tasks) {
+    EXPECT_EQ(task->get_pipeline(), nullptr);
+  }
+}
+
+TEST_F(OperatorTaskTest, SubselectsArePredecessors) {
+  auto gt_a = std::make_shared<GetTable>("table_a");
+  auto single_value_table = std::make_shared<TableWrapper>(load_table("src/test/tables/int_single.tbl", 1));
+  auto projection = std::make_shared<Projection>(
+      gt_a, Projection::ColumnExpressions{PQPExpression::create_column(ColumnID{0}),
+                                          PQPExpression::create_subselect(single_value_table)});
+
+  auto tasks = OperatorTask::make_tasks_from_operator(projection);
+
+  // The subselect does not depend on the input of the Projection and can be executed concurrently
+  ASSERT_EQ(tasks.size(), 3u);
+  EXPECT_EQ(tasks[0]->get_operator(), gt_a);
+  EXPECT_EQ(tasks[1]->get_operator(), single_value_table);
+  EXPECT_EQ(tasks[2]->get_operator(), projection);
+
+  std::vector<std::shared_ptr<AbstractTask>> expected_successors({tasks[2]});
+  EXPECT_EQ(tasks[0]->successors(), expected_successors);
+  EXPECT_EQ(tasks[1]->successors(), expected_successors);
+
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(Topology::create_fake_numa_topology(4, 2)));
+  CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+  CurrentScheduler::get()->finish();
+
+  const auto& output = projection->get_output();
+  ASSERT_EQ(output->row_count(), _test_table_a->row_count());
+  EXPECT_EQ(output->get_value<int32_t>(ColumnID{1}, 0u), single_value_table->get_output()->get_value<int32_t>(
+                                                            ColumnID{0}, 0u));
+}
+
+TEST_F(OperatorTaskTest, SharedOperatorsOfMultipleTrees) {
+  auto gt_a = std::make_shared<GetTable>("table_a");
+  auto scan_a = std::make_shared<TableScan>(gt_a, ColumnID{0}, PredicateCondition::GreaterThanEquals, 1234);
+  auto scan_b = std::make_shared<TableScan>(gt_a, ColumnID{1}, PredicateCondition::LessThan, 1000);
+
+  auto tasks = OperatorTask::make_tasks_from_operators({scan_a, scan_b});
+
+  ASSERT_EQ(tasks.size(), 3u);
+  EXPECT_EQ(tasks[0]->get_operator(), gt_a);
+  EXPECT_EQ(tasks[1]->get_operator(), scan_a);
+  EXPECT_EQ(tasks[2]->get_operator(), scan_b);
+
+  std::vector<std::shared_ptr<AbstractTask>> expected_successors_0({tasks[1], tasks[2]});
+  EXPECT_EQ(tasks[0]->successors(), expected_successors_0);
+}
+
 }  // namespace opossum